@@ -38,7 +38,7 @@
 *       [rtextures] stb_image_write (Sean Barret) for image writing (BMP, TGA, PNG, JPG)
 *       [rtextures] stb_image_resize (Sean Barret) for image resizing algorithms
 *       [rtext] stb_truetype (Sean Barret) for ttf fonts loading
-*       [rtext] stb_rect_pack (Sean Barret) for rectangles packing
+*       [rtext][rtextures] stb_rect_pack (Sean Barret) for rectangles packing
 *       [raudio] dr_wav (David Reid) for WAV audio file loading
 *       [raudio] dr_flac (David Reid) for FLAC audio file loading
 *       [raudio] dr_mp3 (David Reid) for MP3 audio file loading
@@ -257,6 +257,16 @@ typedef struct RenderTexture {
 // RenderTexture2D, same as RenderTexture
 typedef RenderTexture RenderTexture2D;
 
+// RenderTexturePoolStats, transient render textures pool statistics
+typedef struct RenderTexturePoolStats {
+    int count;              // Render textures in pool (acquired and idle)
+    int inUse;              // Render textures acquired, not released yet
+    int hits;               // Acquisitions served by an idle pooled render texture
+    int misses;             // Acquisitions requiring a new render texture
+    int evictions;          // Idle render textures unloaded
+    int memory;             // Pool render textures memory in bytes (color and depth, estimated)
+} RenderTexturePoolStats;
+
 // NPatchInfo, n-patch layout info
 typedef struct NPatchInfo {
     Rectangle source;       // Texture source rectangle
@@ -286,6 +296,100 @@ typedef struct Font {
     GlyphInfo *glyphs;      // Glyphs info data
 } Font;
 
+// AtlasSprite, image packed into an atlas page texture
+typedef struct AtlasSprite {
+    Texture2D texture;      // Atlas page texture containing the sprite
+    Rectangle source;       // Sprite rectangle in atlas page texture
+} AtlasSprite;
+
+// Atlas, runtime texture atlas, images are packed into one or several page textures
+typedef struct Atlas {
+    int width;              // Atlas pages width
+    int height;             // Atlas pages height
+    int padding;            // Empty pixels between sprites
+    int extrude;            // Sprite border pixels repeated around sprites (avoids filtering bleeding)
+    int pageCount;          // Number of atlas pages
+    Texture2D *pages;       // Atlas pages textures
+    void *packers;          // Atlas pages packing state (internal, allows incremental packing)
+} Atlas;
+
+// Tilemap, grid of tileset tiles drawn from static GPU vertex buffers (baked by chunks)
+typedef struct Tilemap {
+    int width;              // Tilemap width (tiles)
+    int height;             // Tilemap height (tiles)
+    int tileWidth;          // Tile width (pixels)
+    int tileHeight;         // Tile height (pixels)
+    Texture2D tileset;      // Tileset texture, tiles indexed left to right, top to bottom
+    int *tiles;             // Tiles tileset indices (row-major, -1 for empty tiles), use Tilemap_SetTile() to modify
+    void *chunks;           // Tilemap chunks buffers and animations (internal)
+} Tilemap;
+
+// ParticleEmitter, emission parameters of a particles burst
+typedef struct ParticleEmitter {
+    Vector2 position;       // Emission area center
+    Vector2 area;           // Emission area size (particles emitted at random positions inside)
+    Vector2 velocity;       // Initial velocity (pixels per second)
+    float spread;           // Velocity direction random spread (degrees)
+    float speedVariation;   // Velocity speed random variation (fraction of speed, 0.0f for none)
+    float lifetime;         // Particles lifetime (seconds)
+    float sizeStart;        // Particles size at emission (pixels)
+    float sizeEnd;          // Particles size at end of lifetime (pixels)
+    Color colorStart;       // Particles color at emission
+    Color colorEnd;         // Particles color at end of lifetime
+} ParticleEmitter;
+
+// ParticleSystem, particles simulated and recycled by compute shader (OpenGL 4.3) or CPU
+typedef struct ParticleSystem {
+    int maxParticles;       // Maximum number of particles (oldest particles are recycled on emission)
+    Texture2D texture;      // Particles texture (drawn on each particle quad)
+    Vector2 gravity;        // Particles acceleration (pixels per second squared)
+    void *data;             // Particles buffers and pending emissions (internal)
+} ParticleSystem;
+
+// SpriteBatch, sprites stored as structure of arrays (modify arrays directly), quads generated in one pass
+typedef struct SpriteBatch {
+    int count;              // Number of sprites
+    int capacity;           // Maximum number of sprites
+    float *x;               // Sprites position x (rotation origin)
+    float *y;               // Sprites position y (rotation origin)
+    float *rotation;        // Sprites rotation (degrees)
+    float *scale;           // Sprites scale
+    unsigned short *source; // Sprites source rectangle index
+    Color *tint;            // Sprites tint
+    Texture2D texture;      // Sprites texture
+    int sourceCount;        // Number of source rectangles
+    float *sources;         // Source rectangles quad data: corners relative to origin and texcoords (internal)
+} SpriteBatch;
+
+// PostFX, post-processing chain: scene drawn offscreen once, passes run through ping-pong render textures
+typedef struct PostFX {
+    int passCount;          // Number of passes
+    int stageCount;         // Number of full screen passes run, consecutive per-pixel passes are fused (updated on PostFX_End())
+    int format;             // Render textures pixel format (PixelFormat type, R8G8B8A8 by default)
+    void *data;             // Passes, fused shaders and scene render texture (internal)
+} PostFX;
+
+// Camera2D, defines position/orientation in 2d space
+typedef struct Camera2D {
+    Vector2 offset;         // Camera offset (displacement from target, i.e. screen center)
+    Vector2 target;         // Camera target (rotation and zoom origin)
+    float rotation;         // Camera rotation in degrees
+    float zoom;             // Camera zoom (scaling), should be 1.0f by default
+} Camera2D;
+
+// CommandList, draws recorded once into static GPU buffers to be drawn several times
+typedef struct CommandList {
+    int segmentCount;       // Number of segments (vertex buffers)
+    int drawCount;          // Number of draw calls (texture/mode changes)
+    void *segments;         // Segments buffers and draw calls (internal)
+} CommandList;
+
+// ShapeMesh, shape tessellated once to be drawn several times
+typedef struct ShapeMesh {
+    int vertexCount;        // Number of vertices (3 per triangle)
+    float *vertices;        // Vertex position (XY - 2 components per vertex)
+} ShapeMesh;
+
 // Shader
 typedef struct Shader {
     unsigned int id;        // Shader program id
@@ -369,7 +473,9 @@ typedef enum {
     FLAG_WINDOW_TRANSPARENT = 0x00000010,   // Set to allow transparent framebuffer
     FLAG_WINDOW_HIGHDPI     = 0x00002000,   // Set to support HighDPI
     FLAG_MSAA_4X_HINT       = 0x00000020,   // Set to try enabling MSAA 4X
-    FLAG_INTERLACED_HINT    = 0x00010000    // Set to try enabling interlaced video format (for V3D)
+    FLAG_INTERLACED_HINT    = 0x00010000,   // Set to try enabling interlaced video format (for V3D)
+    FLAG_RENDER_THREAD      = 0x00020000,   // Set to submit OpenGL commands from a dedicated render thread (only on init, PLATFORM_DESKTOP)
+    FLAG_PREMULTIPLIED_ALPHA = 0x00040000   // Set to use premultiplied alpha (only on init), alpha and additive blending share batch
 } ConfigFlags;
 
 // Trace log level
@@ -713,6 +819,18 @@ typedef enum {
     BLEND_CUSTOM                    // Belnd textures using custom src/dst factors (use rlSetBlendMode())
 } BlendMode;
 
+// Depth layers drawing modes (Buffer_BeginLayers())
+typedef enum {
+    LAYERS_OPAQUE = 0,              // Opaque and alpha tested sprites (alpha < 0.5 discarded), any submission order (i.e. by texture)
+    LAYERS_TRANSLUCENT              // Translucent sprites, hidden by nearer opaque sprites, submission order kept
+} LayersMode;
+
+// Dynamic resolution scene upscale filters (Buffer_SetUpscaleFilter())
+typedef enum {
+    UPSCALE_FILTER_BILINEAR = 0,    // Bilinear filtering
+    UPSCALE_FILTER_SHARPEN          // Bilinear filtering with contrast adaptive sharpening (OpenGL 2.1+/ES2)
+} UpscaleFilter;
+
 // Gesture
 // NOTE: It could be used as flags to enable only some gestures
 typedef enum {
@@ -759,6 +877,16 @@ typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, unsigned
 typedef char *(*LoadFileTextCallback)(const char *fileName);       // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, char *text);     // FileIO: Save text data
 
+// Job system
+typedef void (*JobFunc)(void *data);                                   // Job: Run one task
+typedef void (*JobRangeFunc)(void *data, int start, int end);         // Job: Run items [start, end) of a parallel for
+
+// Job counter, tracks completion of a group of jobs
+// NOTE: Must be zero-initialized before first use, do not modify while jobs are pending
+typedef struct JobCounter {
+    volatile int pending;           // Number of jobs not completed yet
+} JobCounter;
+
 //------------------------------------------------------------------------------------
 // Global Variables Definition
 //------------------------------------------------------------------------------------
@@ -847,6 +975,43 @@ ASCAPI void Buffer_BeginBlend(int mode);                              // Begin b
 ASCAPI void Buffer_UpdateBlend(void);                                    // End blending mode (reset to default: alpha blending)
 ASCAPI void Buffer_BeginScissor(int x, int y, int width, int height); // Begin scissor mode (define screen area for following drawing)
 ASCAPI void Buffer_EndScissor(void);                                  // End scissor mode
+ASCAPI void Buffer_EnableCulling(void);                               // Enable view culling (sprites, shapes and text out of screen/scissor are not drawn)
+ASCAPI void Buffer_DisableCulling(void);                              // Disable view culling
+ASCAPI int Buffer_GetCulledCount(void);                               // Get number of quads culled on last frame
+ASCAPI void Buffer_SetBatchCapacity(int elements, int drawCalls);     // Set internal render batch capacity (quads and draw calls, applied on next frame)
+ASCAPI int Buffer_GetBatchCapacity(void);                             // Get internal render batch capacity (quads)
+ASCAPI void Buffer_EnableAdaptiveBatch(void);                         // Enable internal render batch capacity adapted to frame load
+ASCAPI void Buffer_DisableAdaptiveBatch(void);                        // Disable internal render batch adaptive capacity
+ASCAPI void Buffer_BeginLayers(int mode);                             // Begin depth layers mode (depth tested drawing, see LayersMode)
+ASCAPI void Buffer_EndLayers(void);                                   // End depth layers mode (submission order drawing)
+ASCAPI void Buffer_SetLayer(int layer);                               // Set depth layer for following drawing (higher drawn over lower, -1 for submission order)
+ASCAPI void Buffer_EnableDynamicResolution(float minScale, float maxScale, float targetFPS); // Enable scene resolution scale adapted to frame time (see Buffer_BeginScene())
+ASCAPI void Buffer_DisableDynamicResolution(void);                    // Disable dynamic resolution (scene drawn at native resolution)
+ASCAPI float Buffer_GetResolutionScale(void);                         // Get current scene resolution scale (1.0f if disabled)
+ASCAPI void Buffer_SetUpscaleFilter(int filter, float sharpness);     // Set scene upscale filter (see UpscaleFilter), sharpness in [0.0f..1.0f]
+ASCAPI void Buffer_BeginScene(void);                                  // Begin drawing scene at dynamic resolution (into scaled render texture)
+ASCAPI void Buffer_EndScene(void);                                    // End drawing scene, upscale it to screen (following drawing at native resolution)
+ASCAPI void Camera_Begin(Camera2D camera);                            // Begin 2D camera mode (following drawing in world space)
+ASCAPI void Camera_End(void);                                         // End 2D camera mode
+
+// Camera 2D functions
+ASCAPI Matrix Camera_GetMatrix(Camera2D camera);                      // Get camera view matrix (world to screen transform)
+ASCAPI Vector2 Camera_GetWorldToScreen(Vector2 position, Camera2D camera);    // Get screen position for a world position
+ASCAPI Vector2 Camera_GetScreenToWorld(Vector2 position, Camera2D camera);    // Get world position for a screen position
+ASCAPI Rectangle Camera_GetScreenToWorldRec(Rectangle rec, Camera2D camera);  // Get world bounds of a screen rectangle (i.e. visible area)
+
+// Thread recording functions
+// NOTE: Thread recording requires RLGL_ENABLE_THREAD_BATCHES and is not available on OpenGL 1.1
+ASCAPI void Buffer_BeginRecord(int slot);                             // Begin recording draws from calling thread into slot (any thread)
+ASCAPI void Buffer_EndRecord(void);                                   // End recording draws from calling thread
+ASCAPI void Buffer_DrawRecords(void);                                 // Draw recorded slots in slot order (called on Buffer_Update())
+
+// Command list functions
+// NOTE: Command lists are not available on OpenGL 1.1
+ASCAPI void CommandList_Begin(CommandList *list);                     // Begin recording draws into command list (main thread)
+ASCAPI void CommandList_End(void);                                    // End recording draws, recorded geometry is uploaded to GPU
+ASCAPI void CommandList_Draw(CommandList list, Matrix transform, Color tint); // Draw command list with transform and tint
+ASCAPI void CommandList_Free(CommandList list);                       // Unload command list from GPU memory (VRAM)
 
 // Shader management functions
 // NOTE: Shader functionality is not available on OpenGL 1.1
@@ -947,6 +1112,16 @@ ASCAPI Vector2 Touch_GetPos(int index);                    // Get touch position
 ASCAPI int Touch_GetID(int index);                         // Get touch point identifier for given index
 ASCAPI int Touch_Count(void);                           // Get number of touch points
 
+//------------------------------------------------------------------------------------
+// Job System Functions (Module: jobs)
+//------------------------------------------------------------------------------------
+ASCAPI void Job_Submit(JobFunc func, void *data, JobCounter *counter);   // Queue a job, counter (optional) is incremented until job completes
+ASCAPI void Job_ParallelFor(JobRangeFunc func, void *data, int count, int batchSize, JobCounter *counter); // Split [0, count) in batches, blocks until done if counter is NULL
+ASCAPI void Job_Wait(JobCounter *counter);                         // Wait for counter jobs to complete, calling thread runs queued jobs meanwhile
+ASCAPI bool Job_IsDone(JobCounter *counter);                       // Check if counter jobs are completed (non-blocking)
+ASCAPI int Job_GetWorkerCount(void);                               // Get number of threads running jobs (including main thread)
+ASCAPI int Job_GetWorkerIndex(void);                               // Get calling thread index [0, Job_GetWorkerCount()), main thread is 0
+
 //------------------------------------------------------------------------------------
 // Basic Shapes Drawing Functions (Module: shapes)
 //------------------------------------------------------------------------------------
@@ -959,13 +1134,26 @@ ASCAPI void Shape_SetTexture(Texture2D texture, Rectangle source);       // Set
 ASCAPI void Shape_DrawLine(int startPosX, int startPosY, int endPosX, int endPosY, Color color);                // Draw a line
 ASCAPI void Shape_DrawLineV(Vector2 startPos, Vector2 endPos, Color color);                                     // Draw a line (Vector version)
 ASCAPI void Shape_DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color);                       // Draw a line defining thickness
+ASCAPI void Shape_DrawLines(Vector2 *points, int pointCount, float thick, Color color);                         // Draw lines sequence defining thickness (shared joins)
 ASCAPI void Shape_DrawRec(int posX, int posY, int width, int height, Color color);                        // Draw a color-filled rectangle
 ASCAPI void Shape_DrawRecV(Vector2 position, Vector2 size, Color color);                                  // Draw a color-filled rectangle (Vector version)
 ASCAPI void Shape_DrawRecRec(Rectangle rec, Color color);                                                 // Draw a color-filled rectangle
 ASCAPI void Shape_DrawRecPro(Rectangle rec, Vector2 origin, float rotation, Color color);                 // Draw a color-filled rectangle with pro parameters
+ASCAPI void Shape_DrawRecRounded(Rectangle rec, float roundness, Color color);                          // Draw a color-filled rectangle with rounded corners
+ASCAPI void Shape_DrawCircle(int centerX, int centerY, float radius, Color color);                        // Draw a color-filled circle
+ASCAPI void Shape_DrawCircleV(Vector2 center, float radius, Color color);                                 // Draw a color-filled circle (Vector version)
+ASCAPI void Shape_DrawEllipse(Vector2 center, float radiusH, float radiusV, Color color);                 // Draw a color-filled ellipse
+ASCAPI void Shape_DrawRing(Vector2 center, float innerRadius, float outerRadius, Color color);            // Draw a color-filled ring
+ASCAPI void Shape_DrawCapsule(Vector2 startPos, Vector2 endPos, float radius, Color color);               // Draw a color-filled capsule (line with rounded ends)
 ASCAPI void Shape_DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color);                                // Draw a color-filled triangle (vertex in counter-clockwise order!)
 ASCAPI void Shape_DrawTriangleStrip(Vector2 *points, int pointCount, Color color);                              // Draw a triangle strip defined by points
-ASCAPI void Shape_DrawPoly(Vector2 center, int sides, float radius, float rotation, Color color);               // Draw a regular polygon (Vector version)
+ASCAPI void Shape_DrawPoly(Vector2 center, int sides, float radius, float rotation, Color color);               // Draw a regular polygon (Vector version), sides computed from radius if 0
+
+// Shape meshes functions (tessellated once, drawn as raw vertex ranges)
+ASCAPI ShapeMesh Shape_LoadPoly(int sides, float radius, float rotation);                                 // Load regular polygon mesh centered at origin, sides computed from radius if 0
+ASCAPI ShapeMesh Shape_LoadTriangleStrip(Vector2 *points, int pointCount);                               // Load triangle strip mesh defined by points
+ASCAPI void Shape_UnloadMesh(ShapeMesh mesh);                                                           // Unload shape mesh from memory (RAM)
+ASCAPI void Shape_DrawMesh(ShapeMesh mesh, Vector2 position, Color color);                              // Draw shape mesh at position
 
 //------------------------------------------------------------------------------------
 // Texture Loading and Drawing Functions (Module: textures)
@@ -1036,6 +1224,12 @@ ASCAPI RenderTexture2D RenderTexture_Load(int width, int height);
 ASCAPI void Texture_Free(Texture2D texture);                                                             // Unload texture from GPU memory (VRAM)
 ASCAPI void RenderTexture_Free(RenderTexture2D target);                                                  // Unload render texture from GPU memory (VRAM)
 
+// Transient render textures pool functions
+// NOTE: Released render textures are reused by size and format, idle ones are unloaded after some frames
+ASCAPI RenderTexture2D RenderTexture_Acquire(int width, int height, int format);                          // Get render texture from pool (loaded if no idle one matches), contents not cleared
+ASCAPI void RenderTexture_Release(RenderTexture2D target);                                                // Return render texture to pool (unloaded if not pooled)
+ASCAPI RenderTexturePoolStats RenderTexture_GetPoolStats(void);                                           // Get transient render textures pool statistics
+
 // Texture configuration functions
 ASCAPI void Texture_GenMipmaps(Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
 ASCAPI void Texture_SetFilter(Texture2D texture, int filter);                                              // Set texture scaling filter mode
@@ -1048,6 +1242,53 @@ ASCAPI void Texture_DrawEx(Texture2D texture, Vector2 position, float rotation,
 ASCAPI void Texture_DrawRec(Texture2D texture, Rectangle source, Vector2 position, Color tint);            // Draw a part of a texture defined by a rectangle
 ASCAPI void Texture_DrawPro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint);           // Draw a part of a texture defined by a rectangle with 'pro' parameters
 
+// Texture atlas functions
+// NOTE: Images are packed into R8G8B8A8 pages textures, sprites can also be drawn with Texture_DrawRec()/Texture_DrawPro()
+ASCAPI Atlas Atlas_Load(int width, int height, int padding, int extrude);                                   // Load an empty texture atlas (pages size, pixels between sprites, border pixels repeated)
+ASCAPI void Atlas_Free(Atlas atlas);                                                                     // Unload texture atlas pages from GPU memory (VRAM)
+ASCAPI AtlasSprite Atlas_AddImage(Atlas *atlas, Image image);                                              // Pack image into atlas (sprite texture id is 0 if not packed)
+ASCAPI int Atlas_AddImages(Atlas *atlas, const Image *images, int count, AtlasSprite *sprites);             // Pack images into atlas, returns number of sprites packed
+ASCAPI int Atlas_AddFiles(Atlas *atlas, const char **fileNames, int count, AtlasSprite *sprites);           // Load images from files and pack them into atlas, returns number of sprites packed
+ASCAPI void Atlas_DrawSprite(AtlasSprite sprite, Vector2 position, Color tint);                            // Draw an atlas sprite
+ASCAPI void Atlas_DrawSpritePro(AtlasSprite sprite, Rectangle dest, Vector2 origin, float rotation, Color tint);    // Draw an atlas sprite with 'pro' parameters
+
+// Tilemap functions
+// NOTE: Tiles are baked by chunks into static vertex buffers, only visible chunks are drawn (one draw call each)
+ASCAPI Tilemap Tilemap_Load(Texture2D tileset, int tileWidth, int tileHeight, const int *tiles, int width, int height);  // Load tilemap (tiles can be NULL, all tiles empty)
+ASCAPI void Tilemap_Free(Tilemap tilemap);                                                                 // Unload tilemap tiles and chunks buffers from GPU memory (VRAM)
+ASCAPI void Tilemap_SetTile(Tilemap *tilemap, int x, int y, int tile);                                     // Set tilemap tile (-1 for empty tile), baked chunk is patched
+ASCAPI int Tilemap_GetTile(Tilemap tilemap, int x, int y);                                                 // Get tilemap tile (-1 if empty or out of tilemap)
+ASCAPI bool Tilemap_SetAnimation(Tilemap *tilemap, int tile, int frameCount, float frameTime);             // Animate tile through following tileset tiles (frameCount < 2 removes animation)
+ASCAPI void Tilemap_Draw(Tilemap tilemap, Vector2 position, Color tint);                                   // Draw tilemap visible chunks
+
+// Particle system functions
+// NOTE: With compute shaders support, particles live in GPU buffers and are drawn instanced (no CPU work per particle)
+ASCAPI ParticleSystem ParticleSystem_Load(int maxParticles, Texture2D texture);                             // Load particle system (GPU simulated if compute shaders supported)
+ASCAPI void ParticleSystem_Free(ParticleSystem system);                                                     // Unload particle system buffers
+ASCAPI void ParticleSystem_Emit(ParticleSystem *system, ParticleEmitter emitter, int count);                // Emit particles burst (applied on next update on GPU)
+ASCAPI void ParticleSystem_Update(ParticleSystem *system, float deltaTime);                                 // Update particles: emit pending bursts, integrate and age particles
+ASCAPI void ParticleSystem_Draw(ParticleSystem system, Color tint);                                         // Draw alive particles
+ASCAPI bool ParticleSystem_IsGPU(ParticleSystem system);                                                    // Check if particle system is simulated on GPU
+
+// Sprite batch functions
+// NOTE: Sprites quads are generated for all sprites at once (SIMD, approximated rotation), no per sprite calls
+ASCAPI SpriteBatch SpriteBatch_Load(Texture2D texture, const Rectangle *sources, int sourceCount, Vector2 origin, int capacity);   // Load sprite batch (whole texture as only source if NULL, origin normalized to source size)
+ASCAPI void SpriteBatch_Free(SpriteBatch batch);                                                            // Unload sprite batch arrays
+ASCAPI int SpriteBatch_Add(SpriteBatch *batch, Vector2 position, float rotation, float scale, int source, Color tint);   // Add sprite, returns sprite index (-1 if full or source not valid)
+ASCAPI void SpriteBatch_Remove(SpriteBatch *batch, int index);                                              // Remove sprite, last sprite moved into its index
+ASCAPI void SpriteBatch_Clear(SpriteBatch *batch);                                                          // Remove all sprites
+ASCAPI void SpriteBatch_Draw(SpriteBatch batch);                                                            // Draw all sprites (drawn in array order)
+
+// Post-processing functions
+// NOTE: Per-pixel passes are GLSL code: body of vec4 function(vec4 color, vec2 uv, vec4 params), returning new color
+ASCAPI PostFX PostFX_Load(void);                                                                            // Load post-processing chain (no passes, scene drawn as is)
+ASCAPI void PostFX_Free(PostFX fx);                                                                         // Unload post-processing chain fused shaders (passes shaders not unloaded)
+ASCAPI int PostFX_AddPass(PostFX *fx, Shader shader);                                                       // Add full screen shader pass (texture0 is previous pass result), returns pass index (-1 if full)
+ASCAPI int PostFX_AddPixelPass(PostFX *fx, const char *code);                                               // Add per-pixel pass (fused with adjacent per-pixel passes), returns pass index (-1 if full)
+ASCAPI void PostFX_SetParams(PostFX *fx, int pass, Vector4 params);                                         // Set per-pixel pass params
+ASCAPI void PostFX_Begin(PostFX *fx);                                                                       // Begin drawing scene into post-processing render texture
+ASCAPI void PostFX_End(PostFX *fx);                                                                         // End drawing scene, run passes and draw result to screen
+
 // Color/pixel related functions
 ASCAPI Color Color_Fade(Color color, float alpha);                                 // Get color with alpha applied, alpha goes from 0.0f to 1.0f
 ASCAPI Color Color_AlphaBlend(Color dst, Color src, Color tint);              // Get src alpha-blended into dst color with tint
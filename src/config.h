@@ -36,6 +36,12 @@
 //#define SUPPORT_EVENTS_AUTOMATION     1
 #define SUPPORT_MONITOR_CONTROLS    1
 #define SUPPORT_GAMEPAD_CONTROLS    1
+// Support dedicated render thread (FLAG_RENDER_THREAD), OpenGL submission overlaps next frame update
+// NOTE: Only PLATFORM_DESKTOP, uses Win32 threads on Windows, POSIX threads (-lpthread) elsewhere
+#define SUPPORT_RENDER_THREAD       1
+// Support shader programs binaries cache, linked programs are saved into SHADER_CACHE_PATH and loaded on next launch
+// NOTE: Requires OpenGL 4.1 or GL_ARB_get_program_binary, programs are compiled from source otherwise
+#define SUPPORT_SHADER_CACHE        1
 
 // core: Configuration values
 //------------------------------------------------------------------------------------
@@ -50,6 +56,24 @@
 #define MAX_GAMEPAD_BUTTONS           32
 #define MAX_TOUCH_POINTS               8
 #define MAX_KEY_PRESSED_QUEUE         16
+#define MAX_RECORD_SLOTS              64      // Maximum number of slots for draws recorded by other threads (Buffer_BeginRecord())
+#define SHADER_CACHE_PATH   "shadercache"     // Directory for shader programs binaries cache (created if required)
+#define DYNAMIC_RESOLUTION_HISTORY    16      // Frames averaged to adjust dynamic resolution scale (Buffer_EnableDynamicResolution())
+#define DYNAMIC_RESOLUTION_STEP     0.05f     // Dynamic resolution scale quantization step (render textures sizes reused from pool)
+#define DYNAMIC_RESOLUTION_MARGIN   0.10f     // Frame time margin around target before scale is changed
+#define DYNAMIC_RESOLUTION_PROBE_FRAMES  120  // Frames on target before scale is increased one step (doubled on every failed increase)
+
+//------------------------------------------------------------------------------------
+// Module: jobs - Configuration Flags
+//------------------------------------------------------------------------------------
+// Support job system with worker threads (one per core minus main thread), initialized with window
+// NOTE: If disabled or no worker threads available, jobs run serially on calling thread
+#define SUPPORT_JOB_SYSTEM          1
+
+// jobs: Configuration values
+//------------------------------------------------------------------------------------
+#define MAX_JOB_WORKERS               16      // Maximum number of worker threads
+#define MAX_JOB_QUEUE_SIZE          1024      // Maximum jobs queued per thread (must be power of 2), jobs run inline when full
 
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
@@ -58,6 +82,10 @@
 // Enable OpenGL Debug Context (only available on OpenGL 4.3)
 //#define RLGL_ENABLE_OPENGL_DEBUG_CONTEXT       1
 
+// Enable thread batches, draws can be recorded by job threads (Buffer_BeginRecord()) and command lists
+// NOTE: rlgl internal state is accessed through a thread-local pointer (every rlgl call pays a TLS lookup)
+//#define RLGL_ENABLE_THREAD_BATCHES             1
+
 // Show OpenGL extensions and capabilities detailed logs on init
 //#define RLGL_SHOW_GL_DETAILS_INFO              1
 
@@ -65,8 +93,15 @@
 #define RL_DEFAULT_BATCH_BUFFERS               1      // Default number of batch buffers (multi-buffering)
 #define RL_DEFAULT_BATCH_DRAWCALLS           256      // Default number of batch draw calls (by state changes: mode, texture)
 #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS     4      // Maximum number of textures units that can be activated on batch drawing (Shader_SetValueTexture())
+#define RL_DEFAULT_BATCH_DRAW_TEXTURES         8      // Maximum number of textures a draw call can sample on default shader (multi-texture batching, max 8)
+#define RL_BATCH_ADAPTIVE_MIN_ELEMENTS      1024      // Minimum internal render batch elements on adaptive capacity (Buffer_EnableAdaptiveBatch())
+#define RL_BATCH_ADAPTIVE_MAX_ELEMENTS     65536      // Maximum internal render batch elements on adaptive capacity (16384 on OpenGL ES 2.0)
+#define RL_BATCH_ADAPTIVE_MIN_DRAWCALLS       64      // Minimum internal render batch draw calls on adaptive capacity
+#define RL_BATCH_ADAPTIVE_MAX_DRAWCALLS     4096      // Maximum internal render batch draw calls on adaptive capacity
+#define RL_BATCH_ADAPTIVE_SHRINK_FRAMES      300      // Frames under a quarter of capacity before adaptive capacity is halved
 
 #define RL_MAX_MATRIX_STACK_SIZE              32      // Maximum size of internal Matrix stack
+#define RL_MAX_DEPTH_LAYERS                 1024      // Maximum number of depth layers (Buffer_SetLayer())
 
 #define RL_MAX_SHADER_LOCATIONS               32      // Maximum number of shader locations supported
 
@@ -99,6 +134,9 @@
 // Use QUADS instead of TRIANGLES for drawing when possible
 // Some lines-based shapes could still use lines
 #define SUPPORT_QUADS_DRAW_MODE     1
+// Draw 1 pixel lines as thin quads instead of LINES, avoids breaking the batch
+// when lines are mixed with other shapes or sprites (new draw call on every mode change)
+#define SUPPORT_LINES_AS_QUADS      1
 
 
 //------------------------------------------------------------------------------------
@@ -123,6 +161,11 @@
 #define SUPPORT_IMAGE_MANIPULATION  1
 #define SUPPORT_IMAGE_DRAWING       1
 
+// textures: Configuration values
+//------------------------------------------------------------------------------------
+#define RENDER_TEXTURE_POOL_SIZE            32      // Maximum render textures kept in transient pool (RenderTexture_Acquire())
+#define RENDER_TEXTURE_POOL_IDLE_FRAMES     60      // Frames a released render texture is kept idle in pool before being unloaded
+
 //------------------------------------------------------------------------------------
 // Module: text - Configuration Flags
 //------------------------------------------------------------------------------------
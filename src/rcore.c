@@ -131,11 +131,13 @@
     #include <direct.h>             // Required for: _getch(), _chdir()
     #define GETCWD _getcwd          // NOTE: MSDN recommends not to use getcwd(), chdir()
     #define CHDIR _chdir
+    #define MKDIR(dir) _mkdir(dir)
     #include <io.h>                 // Required for: _access() [Used in File_Exists()]
 #else
     #include <unistd.h>             // Required for: getch(), chdir() (POSIX), access()
     #define GETCWD getcwd
     #define CHDIR chdir
+    #define MKDIR(dir) mkdir(dir, 0777)
 #endif
 
 #if defined(PLATFORM_DESKTOP)
@@ -257,6 +259,18 @@
 #ifndef MAX_CHAR_PRESSED_QUEUE
     #define MAX_CHAR_PRESSED_QUEUE        16        // Maximum number of characters in the char input queue
 #endif
+#ifndef DYNAMIC_RESOLUTION_HISTORY
+    #define DYNAMIC_RESOLUTION_HISTORY    16        // Frames averaged to adjust dynamic resolution scale
+#endif
+#ifndef DYNAMIC_RESOLUTION_STEP
+    #define DYNAMIC_RESOLUTION_STEP     0.05f       // Dynamic resolution scale quantization step
+#endif
+#ifndef DYNAMIC_RESOLUTION_MARGIN
+    #define DYNAMIC_RESOLUTION_MARGIN   0.10f       // Frame time margin around target before scale is changed
+#endif
+#ifndef DYNAMIC_RESOLUTION_PROBE_FRAMES
+    #define DYNAMIC_RESOLUTION_PROBE_FRAMES  120    // Frames on target before scale is increased one step
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -318,6 +332,9 @@ typedef struct CoreData {
         Size render;                        // Framebuffer width and height (render area, including black bars if required)
         Point renderOffset;                 // Offset from render area (must be divided by 2)
         Matrix screenScale;                 // Matrix to scale screen (framebuffer rendering)
+        int culledCount;                    // Quads culled on last frame (view culling)
+        int batchElements;                  // Render batch elements capacity requested (applied on Buffer_Update(), 0 if none)
+        int batchDrawCalls;                 // Render batch draw calls capacity requested
 
         char **dropFilesPath;               // Store dropped files paths as strings
         int dropFileCount;                  // Count dropped files strings
@@ -403,6 +420,7 @@ typedef struct CoreData {
         double draw;                        // Time measure for frame draw
         double frame;                       // Time measure for one frame
         double realframe;
+        double wait;                        // Time measure waiting on Time_Wait()/Events_Wait() (not frame work)
         float fps;
         float realfps;
         bool unreal;
@@ -411,6 +429,47 @@ typedef struct CoreData {
 #endif
         unsigned int frameCounter;          // Frame counter
     } Time;
+    struct {
+        bool enabled;                       // Dynamic resolution enabled (Buffer_EnableDynamicResolution())
+        float scale;                        // Current scene resolution scale
+        float minScale;                     // Minimum scene resolution scale
+        float maxScale;                     // Maximum scene resolution scale
+        double target;                      // Target frame time
+        double history[DYNAMIC_RESOLUTION_HISTORY]; // Frame work times history (measured since last scale change)
+        int historyCount;                   // Frame work times stored in history
+        int historyIndex;                   // Next frame work time history index
+        int stableFrames;                   // Frames on target since last scale change
+        int probeFrames;                    // Frames on target required to increase scale
+        bool probing;                       // Last scale change was an increase on target (reverted if target is missed)
+        int filter;                         // Scene upscale filter (UpscaleFilter)
+        float sharpness;                    // Scene upscale sharpening amount
+        Shader sharpen;                     // Scene upscale sharpening shader (loaded on first use)
+        int sharpenLocs[2];                 // Sharpening shader locations: texel size, sharpness
+        RenderTexture2D scene;              // Scene render texture (from pool, between Buffer_BeginScene() and Buffer_EndScene())
+    } Resolution;
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+    struct {
+        rlThreadBatch batches[MAX_RECORD_SLOTS];    // Thread batches recorded by any thread, one per slot
+        bool pending[MAX_RECORD_SLOTS];             // Slot has geometry recorded, waiting for submission
+        rlThreadBatch listBatch;                    // Thread batch recording command lists (main thread)
+        CommandList *list;                          // Command list being recorded (NULL if none)
+    } Record;
+#endif
+#if defined(PLATFORM_DESKTOP) && defined(SUPPORT_RENDER_THREAD)
+    struct {
+        bool active;                        // Render thread is running (FLAG_RENDER_THREAD)
+        Thread thread;                      // Render thread
+        Mutex mutex;                        // Render thread state mutex
+        Condition signal;                   // Render thread state change signal
+        rlCommandBuffer commands[2];        // Frame commands double buffer (recording and submitting)
+        int recordIndex;                    // Frame commands buffer being recorded by main thread
+        bool framePending;                  // Frame recorded, waiting for render thread submission
+        bool contextOwned;                  // OpenGL context is current on render thread
+        bool contextRequested;              // OpenGL context requested by main thread
+        bool contextOnMain;                 // OpenGL context is current on main thread
+        bool shouldClose;                   // Render thread exit requested
+    } RenderThread;
+#endif
     MTRand mtrand;
 } CoreData;
 
@@ -517,6 +576,13 @@ static bool eventsRecording = false;    // Record events
 extern void LoadFontDefault(void);          // [Module: text] Loads default font on InitWindow()
 extern void UnloadFontDefault(void);        // [Module: text] Unloads default font from GPU memory
 #endif
+#if defined(SUPPORT_JOB_SYSTEM)
+extern void InitJobSystem(void);            // [Module: jobs] Starts job worker threads on InitWindow()
+extern void CloseJobSystem(void);           // [Module: jobs] Stops job worker threads on CloseWindow()
+#endif
+extern void LoadShapesTables(void);         // [Module: shapes] Computes unit polygon tables on InitWindow()
+extern void UpdateRenderTexturePool(void);  // [Module: textures] Unloads idle pooled render textures on Buffer_Update()
+extern void UnloadRenderTexturePool(void);  // [Module: textures] Unloads pooled render textures on CloseWindow()
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -525,6 +591,19 @@ static void InitTimer(void);                            // Initialize timer (hi-
 static bool InitGraphicsDevice(int width, int height);  // Initialize graphics device
 static void SetupFramebuffer(int width, int height);    // Setup main framebuffer
 static void SetupViewport(int width, int height);       // Set viewport for a provided width and height
+static void UpdateDynamicResolution(double frameTime);  // Adjust dynamic resolution scale from frame work time
+static Shader LoadUpscaleShader(void);                  // Load scene upscale sharpening shader
+
+#if defined(SUPPORT_SHADER_CACHE)
+static unsigned char *LoadShaderCache(const char *key, int *dataSize);          // Load shader program binary from cache directory
+static void SaveShaderCache(const char *key, const unsigned char *data, int dataSize); // Save shader program binary into cache directory
+#endif
+
+#if defined(PLATFORM_DESKTOP)
+static void InitRenderThread(void);                     // Initialize render thread (FLAG_RENDER_THREAD), OpenGL context is handed to it
+static void CloseRenderThread(void);                    // Close render thread, OpenGL context is returned to main thread
+static void RequestRenderContext(void);                 // Make OpenGL context current on main thread, waiting for render thread
+#endif
 
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
 static void ErrorCallback(int error, const char *description);                             // GLFW3 Error Callback, runs on GLFW3 error
@@ -631,6 +710,12 @@ void Window_Init(size_t width, size_t height, const char *title)
     CORE.Input.Mouse.cursor = MOUSE_CURSOR_ARROW;
     CORE.Input.Gamepad.lastButtonPressed = -1;
 
+#if defined(SUPPORT_JOB_SYSTEM)
+    // Start job worker threads, available for resources loading from now on
+    // NOTE: External function (defined in module: jobs)
+    InitJobSystem();
+#endif
+
 #if defined(PLATFORM_ANDROID)
     CORE.Window.screen.width = width;
     CORE.Window.screen.height = height;
@@ -710,6 +795,9 @@ void Window_Init(size_t width, size_t height, const char *title)
     // Initialize hi-res timer
     InitTimer();
 
+    // Compute shapes tables before any thread can draw
+    LoadShapesTables();
+
     // Initialize random seed
     srand((unsigned int)time(NULL));
 
@@ -769,6 +857,11 @@ void Window_Init(size_t width, size_t height, const char *title)
     CORE.Input.Mouse.currentPosition.x = (float)CORE.Window.screen.width/2.0f;
     CORE.Input.Mouse.currentPosition.y = (float)CORE.Window.screen.height/2.0f;
 
+#if defined(PLATFORM_DESKTOP)
+    // Move OpenGL submission to a dedicated thread, main thread only records frame commands
+    if ((CORE.Window.flags & FLAG_RENDER_THREAD) > 0) InitRenderThread();
+#endif
+
 #if defined(SUPPORT_EVENTS_AUTOMATION)
     events = (AutomationEvent *)malloc(MAX_CODE_AUTOMATION_EVENTS*sizeof(AutomationEvent));
     CORE.Time.frameCounter = 0;
@@ -781,11 +874,26 @@ void Window_Init(size_t width, size_t height, const char *title)
 // Close window and unload OpenGL context
 void Window_Close(void)
 {
+#if defined(PLATFORM_DESKTOP)
+    CloseRenderThread();        // Get OpenGL context back on main thread (if required)
+#endif
+
+#if defined(SUPPORT_JOB_SYSTEM)
+    CloseJobSystem();           // Complete queued jobs and stop worker threads
+#endif
 
 #if defined(SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();
 #endif
 
+    UnloadRenderTexturePool();
+    if (CORE.Resolution.sharpen.locs != NULL) Shader_Free(CORE.Resolution.sharpen);
+
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+    for (int i = 0; i < MAX_RECORD_SLOTS; i++) rlUnloadThreadBatch(&CORE.Record.batches[i]);
+    rlUnloadThreadBatch(&CORE.Record.listBatch);
+#endif
+
     rlglClose();                // De-init rlgl
 
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
@@ -1061,7 +1169,11 @@ void Window_ToggleFullscreen(void)
 
     // Try to enable GPU V-Sync, so frames are limited to screen refresh rate (60Hz -> 60 FPS)
     // NOTE: V-Sync can be enabled by graphic driver configuration
-    if (CORE.Window.flags & FLAG_VSYNC_HINT) glfwSwapInterval(1);
+    if (CORE.Window.flags & FLAG_VSYNC_HINT)
+    {
+        RequestRenderContext();
+        glfwSwapInterval(1);
+    }
 #endif
 #if defined(PLATFORM_WEB)
     EM_ASM
@@ -1172,6 +1284,7 @@ void Window_SetFlags(unsigned int flags)
     // State change: FLAG_VSYNC_HINT
     if (((CORE.Window.flags & FLAG_VSYNC_HINT) != (flags & FLAG_VSYNC_HINT)) && ((flags & FLAG_VSYNC_HINT) > 0))
     {
+        RequestRenderContext();
         glfwSwapInterval(1);
         CORE.Window.flags |= FLAG_VSYNC_HINT;
     }
@@ -1275,6 +1388,7 @@ void Window_ResetFlags(unsigned int flags)
     // State change: FLAG_VSYNC_HINT
     if (((CORE.Window.flags & FLAG_VSYNC_HINT) > 0) && ((flags & FLAG_VSYNC_HINT) > 0))
     {
+        RequestRenderContext();
         glfwSwapInterval(0);
         CORE.Window.flags &= ~FLAG_VSYNC_HINT;
     }
@@ -1829,6 +1943,8 @@ void Buffer_Begin(void)
     rlLoadIdentity();                   // Reset current matrix (modelview)
     rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling
 
+    rlSyncThreadBatchState();           // Draws recorded by other threads use frame start state
+
     //rlTranslatef(0.375, 0.375, 0);    // HACK to have 2D pixel-perfect drawing on OpenGL 1.1
                                         // NOTE: Not required with OpenGL 3.3+
 }
@@ -1913,8 +2029,17 @@ void Buffer_BeginScissor(int x, int y, int width, int height)
     {
         Vector2 scale = Window_GetDPI();
 
+        if (CORE.Resolution.scene.id > 0) scale = Vector2Scale(scale, CORE.Resolution.scale);
+
         rlScissor((int)(x*scale.x), (int)(CORE.Window.currentFbo.height - (y + height)*scale.y), (int)(width*scale.x), (int)(height*scale.y));
     }
+    else if (CORE.Resolution.scene.id > 0)
+    {
+        // Scene drawn at dynamic resolution, scissor rectangle scaled to render texture
+        float scale = CORE.Resolution.scale;
+
+        rlScissor((int)(x*scale), (int)(CORE.Window.currentFbo.height - (y + height)*scale), (int)(width*scale), (int)(height*scale));
+    }
     else
     {
         rlScissor(x, CORE.Window.currentFbo.height - (y + height), width, height);
@@ -1928,6 +2053,414 @@ void Buffer_EndScissor(void)
     rlDisableScissorTest();
 }
 
+// Enable view culling
+// NOTE: Quads out of current viewport (or scissor area) are rejected before being added to render batch,
+// considering current transformation (camera, matrix stack)
+void Buffer_EnableCulling(void)
+{
+    rlEnableViewCulling();
+}
+
+// Disable view culling
+void Buffer_DisableCulling(void)
+{
+    rlDisableViewCulling();
+}
+
+// Get number of quads culled on last frame
+int Buffer_GetCulledCount(void)
+{
+    return CORE.Window.culledCount;
+}
+
+// Set internal render batch capacity: elements (quads) per vertex buffer and draw calls (state changes)
+// NOTE: Buffers are reloaded on next Buffer_Update(), when not in use by the frame
+void Buffer_SetBatchCapacity(int elements, int drawCalls)
+{
+    CORE.Window.batchElements = elements;
+    CORE.Window.batchDrawCalls = drawCalls;
+}
+
+// Get internal render batch capacity, elements (quads) per vertex buffer
+int Buffer_GetBatchCapacity(void)
+{
+    return rlGetRenderBatchElements();
+}
+
+// Enable internal render batch capacity adapted to observed load
+// NOTE: Capacity grows x2 when a frame overflows it and is halved after
+// some time under a quarter of it, within RL_BATCH_ADAPTIVE_* limits
+void Buffer_EnableAdaptiveBatch(void)
+{
+    rlEnableRenderBatchAdaptive();
+}
+
+// Disable internal render batch adaptive capacity, current capacity is kept
+void Buffer_DisableAdaptiveBatch(void)
+{
+    rlDisableRenderBatchAdaptive();
+}
+
+// Begin depth layers mode, layering is resolved by depth test (see Buffer_SetLayer())
+// NOTE: Opaque layers can be drawn in any order (i.e. grouped by texture for batching), quads are drawn front to back,
+// translucent layers must be drawn after opaque ones in back to front order, depth buffer is cleared on Buffer_Clear()
+void Buffer_BeginLayers(int mode)
+{
+    rlDrawRenderBatchActive();      // Update and draw internal render batch
+
+    rlEnableDepthTest();
+
+    if (mode == LAYERS_OPAQUE)
+    {
+        rlEnableDepthMask();
+        rlEnableOpaqueMode();
+    }
+    else
+    {
+        rlDisableDepthMask();       // Translucent sprites do not hide other sprites
+        rlDisableOpaqueMode();
+    }
+}
+
+// End depth layers mode
+void Buffer_EndLayers(void)
+{
+    rlDrawRenderBatchActive();      // Update and draw internal render batch
+
+    rlDisableOpaqueMode();
+    rlEnableDepthMask();
+    rlDisableDepthTest();
+    rlSetDepthLayer(-1);
+}
+
+// Set depth layer for following drawing, higher layers are drawn over lower ones on depth layers mode
+// NOTE: Layers are in [0..RL_MAX_DEPTH_LAYERS - 1], -1 (default) for submission order
+void Buffer_SetLayer(int layer)
+{
+    rlSetDepthLayer(layer);
+}
+
+// Enable dynamic resolution, scene drawn between Buffer_BeginScene() and Buffer_EndScene() is rendered
+// at a scale adapted to frame time and upscaled to screen, drawing after Buffer_EndScene() keeps native resolution (UI)
+// NOTE: Frame work time excludes Time_Wait()/Events_Wait() waits but includes vsync waits on buffers swap,
+// so scale is increased one step at a time once frames have been on target for a while
+void Buffer_EnableDynamicResolution(float minScale, float maxScale, float targetFPS)
+{
+    if (targetFPS <= 0.0f)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Dynamic resolution requires a target FPS");
+        return;
+    }
+
+    if (maxScale > 1.0f) maxScale = 1.0f;
+    if (maxScale < DYNAMIC_RESOLUTION_STEP) maxScale = DYNAMIC_RESOLUTION_STEP;
+    if (minScale < DYNAMIC_RESOLUTION_STEP) minScale = DYNAMIC_RESOLUTION_STEP;
+    if (minScale > maxScale) minScale = maxScale;
+
+    CORE.Resolution.enabled = true;
+    CORE.Resolution.minScale = minScale;
+    CORE.Resolution.maxScale = maxScale;
+    CORE.Resolution.scale = maxScale;
+    CORE.Resolution.target = 1.0/targetFPS;
+    CORE.Resolution.historyCount = 0;
+    CORE.Resolution.historyIndex = 0;
+    CORE.Resolution.stableFrames = 0;
+    CORE.Resolution.probeFrames = DYNAMIC_RESOLUTION_PROBE_FRAMES;
+    CORE.Resolution.probing = false;
+}
+
+// Disable dynamic resolution, scene is drawn straight to screen
+void Buffer_DisableDynamicResolution(void)
+{
+    CORE.Resolution.enabled = false;
+}
+
+// Get current scene resolution scale
+float Buffer_GetResolutionScale(void)
+{
+    return CORE.Resolution.enabled? CORE.Resolution.scale : 1.0f;
+}
+
+// Set scene upscale filter, sharpness only used by UPSCALE_FILTER_SHARPEN
+void Buffer_SetUpscaleFilter(int filter, float sharpness)
+{
+    if (sharpness < 0.0f) sharpness = 0.0f;
+    else if (sharpness > 1.0f) sharpness = 1.0f;
+
+    CORE.Resolution.filter = filter;
+    CORE.Resolution.sharpness = sharpness;
+}
+
+// Begin drawing scene at dynamic resolution, drawing coordinates are the same as screen ones
+// NOTE: Scene is drawn straight to screen if dynamic resolution is disabled or at full scale
+void Buffer_BeginScene(void)
+{
+    if (!CORE.Resolution.enabled || (CORE.Resolution.scale >= 1.0f) || (CORE.Resolution.scene.id > 0)) return;
+
+    int width = (int)(CORE.Window.render.width*CORE.Resolution.scale + 0.5f);
+    int height = (int)(CORE.Window.render.height*CORE.Resolution.scale + 0.5f);
+
+    CORE.Resolution.scene = RenderTexture_Acquire(width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    if (CORE.Resolution.scene.id == 0) return;      // Render textures not available, scene drawn to screen
+
+    // NOTE: Filter is set on every acquire, pooled render textures are shared and could be set another filter
+    Texture_SetFilter(CORE.Resolution.scene.texture, TEXTURE_FILTER_BILINEAR);
+
+    RenderTexture_Begin(CORE.Resolution.scene);
+
+    // Projection keeps framebuffer size, render texture viewport scales scene down
+    rlMatrixMode(RL_PROJECTION);
+    rlLoadIdentity();
+    rlOrtho(0, CORE.Window.render.width, CORE.Window.render.height, 0, 0.0f, 1.0f);
+    rlMatrixMode(RL_MODELVIEW);
+    rlLoadIdentity();
+    rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling
+}
+
+// End drawing scene, scene is upscaled to screen replacing its contents (blending disabled)
+void Buffer_EndScene(void)
+{
+    if (CORE.Resolution.scene.id == 0) return;
+
+    RenderTexture_Update();
+
+    Texture2D texture = CORE.Resolution.scene.texture;
+    bool sharpen = (CORE.Resolution.filter == UPSCALE_FILTER_SHARPEN) && (CORE.Resolution.sharpness > 0.0f);
+
+    if (sharpen && (CORE.Resolution.sharpen.locs == NULL))
+    {
+        CORE.Resolution.sharpen = LoadUpscaleShader();
+        CORE.Resolution.sharpenLocs[0] = Shader_GetLoc(CORE.Resolution.sharpen, "texelSize");
+        CORE.Resolution.sharpenLocs[1] = Shader_GetLoc(CORE.Resolution.sharpen, "sharpness");
+    }
+
+    // Sharpening not available (OpenGL 1.1 or shader failed), bilinear filtering used
+    if ((CORE.Resolution.sharpen.id == 0) || (CORE.Resolution.sharpen.id == rlGetShaderIdDefault())) sharpen = false;
+
+    if (sharpen)
+    {
+        Vector2 texelSize = { 1.0f/texture.width, 1.0f/texture.height };
+
+        Shader_SetValue(CORE.Resolution.sharpen, CORE.Resolution.sharpenLocs[0], &texelSize, SHADER_UNIFORM_VEC2);
+        Shader_SetValue(CORE.Resolution.sharpen, CORE.Resolution.sharpenLocs[1], &CORE.Resolution.sharpness, SHADER_UNIFORM_FLOAT);
+        Shader_Begin(CORE.Resolution.sharpen);
+    }
+
+    rlDisableColorBlend();
+
+    // NOTE: Render texture is vertically flipped, source height is negative
+    Texture_DrawPro(texture, (Rectangle){ 0, 0, (float)texture.width, -(float)texture.height },
+        (Rectangle){ 0, 0, (float)CORE.Window.render.width, (float)CORE.Window.render.height }, (Vector2){ 0, 0 }, 0.0f, WHITE);
+
+    rlDrawRenderBatchActive();      // Scene drawn before blending is enabled again
+    rlEnableColorBlend();
+
+    if (sharpen) Shader_Update();
+
+    RenderTexture_Release(CORE.Resolution.scene);
+    CORE.Resolution.scene = (RenderTexture2D){ 0 };
+
+    rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling (as Buffer_Begin())
+}
+
+// Begin 2D camera mode
+// NOTE: Camera transform is set as modelview matrix, applied on GPU with MVP uniform on batch drawing,
+// vertex are added to render batch untransformed (world space), view culling considers camera
+void Camera_Begin(Camera2D camera)
+{
+    rlDrawRenderBatchActive();      // Update and draw internal render batch
+
+    rlLoadIdentity();               // Reset current matrix (modelview)
+
+    // Apply 2d camera transformation to modelview
+    rlMultMatrixf(MatrixToFloat(Camera_GetMatrix(camera)));
+
+    // Apply screen scaling if required
+    rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale));
+
+    rlSyncThreadBatchState();       // Draws recorded by other threads use camera
+}
+
+// End 2D camera mode
+void Camera_End(void)
+{
+    rlDrawRenderBatchActive();      // Update and draw internal render batch
+
+    rlLoadIdentity();               // Reset current matrix (modelview)
+    rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling if required
+
+    rlSyncThreadBatchState();       // Draws recorded by other threads stop using camera
+}
+
+// Get camera view matrix (world to screen transform)
+// NOTE: World is translated to target, rotated and zoomed around it and moved to offset
+Matrix Camera_GetMatrix(Camera2D camera)
+{
+    Matrix matOrigin = MatrixTranslate(-camera.target.x, -camera.target.y, 0.0f);
+    Matrix matRotation = MatrixRotate((Vector3){ 0.0f, 0.0f, 1.0f }, camera.rotation*DEG2RAD);
+    Matrix matScale = MatrixScale(camera.zoom, camera.zoom, 1.0f);
+    Matrix matTranslation = MatrixTranslate(camera.offset.x, camera.offset.y, 0.0f);
+
+    return MatrixMultiply(MatrixMultiply(matOrigin, MatrixMultiply(matScale, matRotation)), matTranslation);
+}
+
+// Get screen position for a world position
+Vector2 Camera_GetWorldToScreen(Vector2 position, Camera2D camera)
+{
+    Vector3 transform = Vector3Transform((Vector3){ position.x, position.y, 0.0f }, Camera_GetMatrix(camera));
+
+    return (Vector2){ transform.x, transform.y };
+}
+
+// Get world position for a screen position
+Vector2 Camera_GetScreenToWorld(Vector2 position, Camera2D camera)
+{
+    Vector3 transform = Vector3Transform((Vector3){ position.x, position.y, 0.0f }, MatrixInvert(Camera_GetMatrix(camera)));
+
+    return (Vector2){ transform.x, transform.y };
+}
+
+// Get world bounds of a screen rectangle
+// NOTE: Useful to skip world objects out of screen (i.e. visible tiles),
+// bounds include the full rotated rectangle
+Rectangle Camera_GetScreenToWorldRec(Rectangle rec, Camera2D camera)
+{
+    Matrix matInvCamera = MatrixInvert(Camera_GetMatrix(camera));
+    Vector2 corners[4] = {
+        { rec.x, rec.y }, { rec.x + rec.width, rec.y },
+        { rec.x, rec.y + rec.height }, { rec.x + rec.width, rec.y + rec.height }
+    };
+
+    Vector2 min = { 0 };
+    Vector2 max = { 0 };
+
+    for (int i = 0; i < 4; i++)
+    {
+        Vector3 world = Vector3Transform((Vector3){ corners[i].x, corners[i].y, 0.0f }, matInvCamera);
+
+        if ((i == 0) || (world.x < min.x)) min.x = world.x;
+        if ((i == 0) || (world.y < min.y)) min.y = world.y;
+        if ((i == 0) || (world.x > max.x)) max.x = world.x;
+        if ((i == 0) || (world.y > max.y)) max.y = world.y;
+    }
+
+    return (Rectangle){ min.x, min.y, max.x - min.x, max.y - min.y };
+}
+
+// Begin recording draws from calling thread into a slot (any thread, i.e. job system workers)
+// NOTE: Only geometry drawing functions (shapes, textures, text) can be used while recording,
+// every slot must be recorded by a single thread at a time, slots are drawn in order on Buffer_DrawRecords().
+// Recording starts from main thread state at last Buffer_Begin(), Camera_Begin() or Camera_End(),
+// those must not be called while other threads are recording. Shader uniform values can not be set
+// while recording, recorded geometry uses the values set when Buffer_DrawRecords() is called
+void Buffer_BeginRecord(int slot)
+{
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+    if ((slot < 0) || (slot >= MAX_RECORD_SLOTS))
+    {
+        TRACELOG(LOG_WARNING, "RECORD: Slot %i out of bounds (MAX_RECORD_SLOTS: %i)", slot, MAX_RECORD_SLOTS);
+        return;
+    }
+
+    if (CORE.Record.batches[slot].context == NULL) CORE.Record.batches[slot] = rlLoadThreadBatch();
+
+    rlBeginThreadBatch(&CORE.Record.batches[slot]);
+    CORE.Record.pending[slot] = true;
+#else
+    static bool warned = false;
+
+    // NOTE: Draws go straight to main state, only safe from main thread
+    if (!warned) TRACELOG(LOG_WARNING, "RECORD: Thread batches not enabled (RLGL_ENABLE_THREAD_BATCHES), draws are not recorded");
+    warned = true;
+#endif
+}
+
+// End recording draws from calling thread
+void Buffer_EndRecord(void)
+{
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+    rlEndThreadBatch();
+#endif
+}
+
+// Draw recorded slots in slot order (main thread)
+// NOTE: Called on Buffer_Update(), call it before to draw other geometry on top of recorded one
+void Buffer_DrawRecords(void)
+{
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+    for (int i = 0; i < MAX_RECORD_SLOTS; i++)
+    {
+        if (CORE.Record.pending[i])
+        {
+            rlDrawThreadBatch(&CORE.Record.batches[i]);
+            CORE.Record.pending[i] = false;
+        }
+    }
+#endif
+}
+
+// Begin recording draws into a command list (main thread)
+// NOTE: Only geometry drawing functions (shapes, textures, text) and blend modes are recorded, geometry is
+// kept in world space: current view (camera) is applied on CommandList_Draw(), view culling is disabled.
+// List must be initialized to zero before first recording, previous content is replaced on CommandList_End()
+void CommandList_Begin(CommandList *list)
+{
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+    if (CORE.Record.list != NULL)
+    {
+        TRACELOG(LOG_WARNING, "COMMANDLIST: Already recording a command list");
+        return;
+    }
+
+    if (CORE.Record.listBatch.context == NULL) CORE.Record.listBatch = rlLoadThreadBatch();
+
+    CORE.Record.list = list;
+    rlSyncThreadBatchState();
+    rlBeginThreadBatch(&CORE.Record.listBatch);
+    rlDisableViewCulling();     // Recorded geometry could be drawn anywhere
+#else
+    TRACELOG(LOG_WARNING, "COMMANDLIST: Thread batches not enabled (RLGL_ENABLE_THREAD_BATCHES), draws are not recorded");
+#endif
+}
+
+// End recording draws into command list, recorded geometry is uploaded into static GPU buffers
+void CommandList_End(void)
+{
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+    if (CORE.Record.list == NULL) return;
+
+    rlEndThreadBatch();
+
+    CommandList_Free(*CORE.Record.list);
+
+    rlStaticBatch batch = rlLoadStaticBatch(&CORE.Record.listBatch);
+    CORE.Record.list->segmentCount = batch.segmentCount;
+    CORE.Record.list->drawCount = batch.drawCount;
+    CORE.Record.list->segments = batch.segments;
+    CORE.Record.list = NULL;
+#endif
+}
+
+// Draw command list with transform (applied before current view) and tint
+// NOTE: No vertex data is uploaded, one draw call per recorded texture/mode change
+void CommandList_Draw(CommandList list, Matrix transform, Color tint)
+{
+    rlStaticBatch batch = { list.segmentCount, list.drawCount, list.segments };
+    float color[4] = { 0 };
+    rlGetDiffuseColor(tint.r, tint.g, tint.b, tint.a, color);
+
+    rlDrawStaticBatch(batch, transform, color);
+}
+
+// Unload command list GPU buffers
+void CommandList_Free(CommandList list)
+{
+    rlStaticBatch batch = { list.segmentCount, list.drawCount, list.segments };
+
+    rlUnloadStaticBatch(&batch);
+}
+
 // Load shader from files and bind default locations
 // NOTE: If shader string is NULL, using default vertex/fragment shaders
 Shader Shader_Load(const char *vsFileName, const char *fsFileName)
@@ -1957,7 +2490,11 @@ Shader Shader_LoadData(const char *vsCode, const char *fsCode)
     // NOTE: All locations must be reseted to -1 (no location)
     for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
 
+#if defined(SUPPORT_TRACELOG)
+    double loadTime = Time_Get();
+#endif
     shader.id = rlLoadShaderCode(vsCode, fsCode);
+    TRACELOG(LOG_INFO, "SHADER: [ID %i] Shader program loaded in %.2f ms", shader.id, (Time_Get() - loadTime)*1000.0);
 
     // After shader loading, we TRY to set default location names
     if (shader.id > 0)
@@ -2026,19 +2563,16 @@ void Shader_SetValue(Shader shader, int locIndex, const void *value, int uniform
 }
 
 // Set shader uniform value vector
+// NOTE: Value is only updated if it changed, batch is not flushed otherwise
 void Shader_SetValueV(Shader shader, int locIndex, const void *value, int uniformType, int count)
 {
-    rlEnableShader(shader.id);
-    rlSetUniform(locIndex, value, uniformType, count);
-    //rlDisableShader();      // Avoid reseting current shader program, in case other uniforms are set
+    rlSetShaderUniform(shader.id, locIndex, value, uniformType, count);
 }
 
 // Set shader uniform value (matrix 4x4)
 void Shader_SetValueMatrix(Shader shader, int locIndex, Matrix mat)
 {
-    rlEnableShader(shader.id);
-    rlSetUniformMatrix(locIndex, mat);
-    //rlDisableShader();
+    rlSetShaderUniformMatrix(shader.id, locIndex, mat);
 }
 
 // Set shader uniform value for texture
@@ -2144,8 +2678,10 @@ void Time_Wait(float targetFPS)
     if(extratime<0-targetwaittime*5.0f&&extratime<-0.1f)extratime=0;
     if(extratime>targetwaittime*5.0f&&extratime>0.1f)extratime=0;
     double wait=(waittime+extratime)*1000.0f;
+    double sleeptime=Time_Get();
     Time_Sleep(wait);
     double currenttime=Time_Get();
+    CORE.Time.wait+=currenttime-sleeptime;
     extratime=previoustime+targetwaittime+extratime-currenttime;
 
     if(curframetime<targetwaittime){
@@ -3566,6 +4102,11 @@ static bool InitGraphicsDevice(int width, int height)
     }
 #endif  // PLATFORM_ANDROID || PLATFORM_RPI || PLATFORM_DRM
 
+#if defined(SUPPORT_SHADER_CACHE)
+    // Shader programs binaries are cached on disk, default shader included
+    rlSetShaderCacheCallbacks(LoadShaderCache, SaveShaderCache);
+#endif
+
     // Load OpenGL extensions
     // NOTE: GL procedures address loader is required to load extensions
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
@@ -3576,7 +4117,14 @@ static bool InitGraphicsDevice(int width, int height)
 
     // Initialize OpenGL context (states and resources)
     // NOTE: CORE.Window.currentFbo.width and CORE.Window.currentFbo.height not used, just stored as globals in rlgl
+#if defined(SUPPORT_TRACELOG)
+    double initTime = Time_Get();
+#endif
     rlglInit(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
+    TRACELOG(LOG_INFO, "RLGL: Default state and shader initialized in %.2f ms", (Time_Get() - initTime)*1000.0);
+
+    // Premultiplied alpha must be enabled before any texture is loaded (default font included)
+    if ((CORE.Window.flags & FLAG_PREMULTIPLIED_ALPHA) > 0) rlEnablePremultipliedAlpha();
 
     // Setup default viewport
     // NOTE: It updated CORE.Window.render.width and CORE.Window.render.height
@@ -3699,6 +4247,152 @@ static void SetupFramebuffer(int width, int height)
     }
 }
 
+// Adjust dynamic resolution scale from frame work time, averaged over a full history at current scale
+// NOTE: Scale is quantized to DYNAMIC_RESOLUTION_STEP, so render textures sizes are reused from pool
+static void UpdateDynamicResolution(double frameTime)
+{
+    CORE.Resolution.history[CORE.Resolution.historyIndex] = frameTime;
+    CORE.Resolution.historyIndex = (CORE.Resolution.historyIndex + 1)%DYNAMIC_RESOLUTION_HISTORY;
+
+    if (CORE.Resolution.historyCount < DYNAMIC_RESOLUTION_HISTORY) CORE.Resolution.historyCount++;
+    if (CORE.Resolution.historyCount < DYNAMIC_RESOLUTION_HISTORY) return;
+
+    double average = 0.0;
+    for (int i = 0; i < DYNAMIC_RESOLUTION_HISTORY; i++) average += CORE.Resolution.history[i];
+    average /= DYNAMIC_RESOLUTION_HISTORY;
+
+    double target = CORE.Resolution.target;
+    int level = (int)(CORE.Resolution.scale/DYNAMIC_RESOLUTION_STEP + 0.5f);
+    int newLevel = level;
+    bool probing = CORE.Resolution.probing;
+
+    CORE.Resolution.probing = false;
+
+    if (average > target*(1.0 + DYNAMIC_RESOLUTION_MARGIN))
+    {
+        if (probing)
+        {
+            // Last increase missed target, it is reverted and next increase waits longer
+            newLevel = level - 1;
+            if (CORE.Resolution.probeFrames < 8*DYNAMIC_RESOLUTION_PROBE_FRAMES) CORE.Resolution.probeFrames *= 2;
+        }
+        else
+        {
+            // Fill rate cost follows pixels count, scale follows square root of frame time ratio
+            newLevel = (int)(CORE.Resolution.scale*sqrt(target/average)/DYNAMIC_RESOLUTION_STEP);
+            if (newLevel >= level) newLevel = level - 1;
+        }
+    }
+    else
+    {
+        if (probing) CORE.Resolution.probeFrames = DYNAMIC_RESOLUTION_PROBE_FRAMES;
+
+        if (average < target*(1.0 - DYNAMIC_RESOLUTION_MARGIN)) newLevel = level + 1;
+        else
+        {
+            // Frame time on target could be bound by vsync, scale is probed one step up after a while
+            CORE.Resolution.stableFrames++;
+            if (CORE.Resolution.stableFrames >= CORE.Resolution.probeFrames) newLevel = level + 1;
+        }
+    }
+
+    float scale = newLevel*DYNAMIC_RESOLUTION_STEP;
+    if (scale < CORE.Resolution.minScale) scale = CORE.Resolution.minScale;
+    if (scale > CORE.Resolution.maxScale) scale = CORE.Resolution.maxScale;
+
+    if (scale != CORE.Resolution.scale)
+    {
+        TRACELOG(LOG_DEBUG, "DISPLAY: Dynamic resolution scale: %.2f (frame time: %.2f ms)", scale, average*1000.0);
+
+        CORE.Resolution.probing = (scale > CORE.Resolution.scale);
+        CORE.Resolution.scale = scale;
+        CORE.Resolution.historyCount = 0;
+        CORE.Resolution.stableFrames = 0;
+    }
+    else if (newLevel > level) CORE.Resolution.stableFrames = 0;    // Already at maximum scale
+}
+
+// Load scene upscale sharpening shader, contrast adaptive: sharpening is reduced where local contrast is high
+// NOTE: Scene texture is bilinear filtered, neighbours sampled one scene texel away
+static Shader LoadUpscaleShader(void)
+{
+    const char *fsCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "#define TEXTURE texture2D          \n"
+    "#define FINAL_COLOR gl_FragColor   \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "#define TEXTURE texture            \n"
+    "#define FINAL_COLOR finalColor     \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "#define TEXTURE texture2D          \n"
+    "#define FINAL_COLOR gl_FragColor   \n"
+#else
+    NULL;
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "uniform vec2 texelSize;            \n"
+    "uniform float sharpness;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 c = TEXTURE(texture0, fragTexCoord);                                  \n"
+    "    vec3 n = TEXTURE(texture0, fragTexCoord - vec2(0.0, texelSize.y)).rgb;     \n"
+    "    vec3 s = TEXTURE(texture0, fragTexCoord + vec2(0.0, texelSize.y)).rgb;     \n"
+    "    vec3 w = TEXTURE(texture0, fragTexCoord - vec2(texelSize.x, 0.0)).rgb;     \n"
+    "    vec3 e = TEXTURE(texture0, fragTexCoord + vec2(texelSize.x, 0.0)).rgb;     \n"
+    "    vec3 minColor = min(c.rgb, min(min(n, s), min(w, e)));                     \n"
+    "    vec3 maxColor = max(c.rgb, max(max(n, s), max(w, e)));                     \n"
+    "    vec3 amount = sqrt(clamp(min(minColor, 1.0 - maxColor)/max(maxColor, 0.0001), 0.0, 1.0)); \n"
+    "    vec3 weight = -amount/mix(8.0, 5.0, sharpness);                            \n"
+    "    vec3 color = (c.rgb + (n + s + w + e)*weight)/(1.0 + 4.0*weight);          \n"
+    "    FINAL_COLOR = vec4(clamp(color, 0.0, 1.0), c.a)*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#endif
+
+    Shader shader = { 0 };
+
+    if (fsCode != NULL) shader = Shader_LoadData(NULL, fsCode);
+
+    return shader;
+}
+
+#if defined(SUPPORT_SHADER_CACHE)
+// Load shader program binary from cache directory
+// NOTE: Returns NULL if not cached, rlgl compiles program from source
+static unsigned char *LoadShaderCache(const char *key, int *dataSize)
+{
+    const char *fileName = Text_Format("%s/%s.bin", SHADER_CACHE_PATH, key);
+
+    if (!File_Exists(fileName)) return NULL;
+
+    unsigned int bytesRead = 0;
+    unsigned char *data = File_Load(fileName, &bytesRead);
+    *dataSize = (int)bytesRead;
+
+    return data;
+}
+
+// Save shader program binary into cache directory (created if required)
+static void SaveShaderCache(const char *key, const unsigned char *data, int dataSize)
+{
+    if (!File_DirExists(SHADER_CACHE_PATH)) MKDIR(SHADER_CACHE_PATH);
+
+    File_Save(Text_Format("%s/%s.bin", SHADER_CACHE_PATH, key), (void *)data, dataSize);
+}
+#endif
+
 // Initialize hi-resolution timer
 static void InitTimer(void)
 {
@@ -3723,14 +4417,209 @@ static void InitTimer(void)
     CORE.Time.previous = Time_Get();     // Get time as double
 }
 
+#if defined(PLATFORM_DESKTOP)
+#if defined(SUPPORT_RENDER_THREAD)
+// Render thread: submits recorded frames to OpenGL and swaps buffers
+// NOTE: Frame N submission overlaps with main thread recording frame N+1
+static void RenderThreadProc(void *arg)
+{
+    (void)arg;
+
+    MutexLock(&CORE.RenderThread.mutex);
+
+    while (true)
+    {
+        while (!CORE.RenderThread.shouldClose && !CORE.RenderThread.framePending &&
+               !(CORE.RenderThread.contextRequested && CORE.RenderThread.contextOwned)) ConditionWait(&CORE.RenderThread.signal, &CORE.RenderThread.mutex);
+
+        // Release OpenGL context if main thread requires it (resources loading)
+        if (CORE.RenderThread.contextRequested && CORE.RenderThread.contextOwned)
+        {
+            glfwMakeContextCurrent(NULL);
+            CORE.RenderThread.contextOwned = false;
+            ConditionBroadcast(&CORE.RenderThread.signal);
+            continue;
+        }
+
+        if (CORE.RenderThread.shouldClose) break;
+
+        if (!CORE.RenderThread.contextOwned)
+        {
+            glfwMakeContextCurrent(CORE.Window.handle);
+            CORE.RenderThread.contextOwned = true;
+        }
+
+        rlCommandBuffer *commands = &CORE.RenderThread.commands[CORE.RenderThread.recordIndex ^ 1];
+        MutexUnlock(&CORE.RenderThread.mutex);
+
+        rlExecuteCommandBuffer(commands);
+        glfwSwapBuffers(CORE.Window.handle);
+
+        MutexLock(&CORE.RenderThread.mutex);
+        CORE.RenderThread.framePending = false;
+        ConditionBroadcast(&CORE.RenderThread.signal);
+    }
+
+    if (CORE.RenderThread.contextOwned) glfwMakeContextCurrent(NULL);
+    CORE.RenderThread.contextOwned = false;
+    ConditionBroadcast(&CORE.RenderThread.signal);
+
+    MutexUnlock(&CORE.RenderThread.mutex);
+}
+
+// Hand recorded frame to render thread and start recording next one
+// NOTE: Only one frame can be in flight, we wait for previous frame submission if required
+static void SubmitRenderFrame(void)
+{
+    MutexLock(&CORE.RenderThread.mutex);
+
+    while (CORE.RenderThread.framePending) ConditionWait(&CORE.RenderThread.signal, &CORE.RenderThread.mutex);
+
+    rlPublishStateCacheStats();     // Render thread is idle, its state cache counters can be read
+
+    // Return OpenGL context to render thread
+    if (CORE.RenderThread.contextOnMain)
+    {
+        glfwMakeContextCurrent(NULL);
+        CORE.RenderThread.contextOnMain = false;
+    }
+
+    CORE.RenderThread.recordIndex ^= 1;
+    CORE.RenderThread.framePending = true;
+    ConditionBroadcast(&CORE.RenderThread.signal);
+
+    MutexUnlock(&CORE.RenderThread.mutex);
+
+    rlSetCommandBuffer(&CORE.RenderThread.commands[CORE.RenderThread.recordIndex]);
+}
+#endif  // SUPPORT_RENDER_THREAD
+
+// Initialize render thread, OpenGL context is handed to it
+static void InitRenderThread(void)
+{
+#if defined(SUPPORT_RENDER_THREAD)
+    CORE.RenderThread.commands[0] = rlLoadCommandBuffer(RL_DEFAULT_COMMAND_BUFFER_SIZE);
+    CORE.RenderThread.commands[1] = rlLoadCommandBuffer(RL_DEFAULT_COMMAND_BUFFER_SIZE);
+    CORE.RenderThread.recordIndex = 0;
+    CORE.RenderThread.framePending = false;
+    CORE.RenderThread.contextRequested = false;
+    CORE.RenderThread.shouldClose = false;
+
+    MutexInit(&CORE.RenderThread.mutex);
+    ConditionInit(&CORE.RenderThread.signal);
+
+    // Release context from main thread, render thread makes it current on first frame
+    rlDrawRenderBatchActive();
+    glfwMakeContextCurrent(NULL);
+    CORE.RenderThread.contextOwned = false;
+    CORE.RenderThread.contextOnMain = false;
+
+    if (!ThreadCreate(&CORE.RenderThread.thread, RenderThreadProc, NULL))
+    {
+        TRACELOG(LOG_WARNING, "THREAD: Failed to create render thread, rendering on main thread");
+
+        glfwMakeContextCurrent(CORE.Window.handle);
+        ConditionDestroy(&CORE.RenderThread.signal);
+        MutexDestroy(&CORE.RenderThread.mutex);
+        rlUnloadCommandBuffer(&CORE.RenderThread.commands[0]);
+        rlUnloadCommandBuffer(&CORE.RenderThread.commands[1]);
+        CORE.Window.flags &= ~FLAG_RENDER_THREAD;
+        return;
+    }
+
+    CORE.RenderThread.active = true;
+    rlSetContextCallback(RequestRenderContext);
+    rlSetCommandBuffer(&CORE.RenderThread.commands[CORE.RenderThread.recordIndex]);
+
+    TRACELOG(LOG_INFO, "THREAD: Render thread initialized successfully");
+#else
+    TRACELOG(LOG_WARNING, "THREAD: Render thread not supported (SUPPORT_RENDER_THREAD), rendering on main thread");
+    CORE.Window.flags &= ~FLAG_RENDER_THREAD;
+#endif
+}
+
+// Close render thread, OpenGL context is returned to main thread
+// NOTE: Commands recorded after last Buffer_Update() are discarded
+static void CloseRenderThread(void)
+{
+#if defined(SUPPORT_RENDER_THREAD)
+    if (!CORE.RenderThread.active) return;
+
+    MutexLock(&CORE.RenderThread.mutex);
+    while (CORE.RenderThread.framePending) ConditionWait(&CORE.RenderThread.signal, &CORE.RenderThread.mutex);
+    CORE.RenderThread.shouldClose = true;
+    ConditionBroadcast(&CORE.RenderThread.signal);
+    MutexUnlock(&CORE.RenderThread.mutex);
+
+    ThreadJoin(&CORE.RenderThread.thread);
+
+    if (!CORE.RenderThread.contextOnMain) glfwMakeContextCurrent(CORE.Window.handle);
+    CORE.RenderThread.contextOnMain = true;
+    CORE.RenderThread.active = false;
+
+    rlSetCommandBuffer(NULL);
+    rlSetContextCallback(NULL);
+    rlUnloadCommandBuffer(&CORE.RenderThread.commands[0]);
+    rlUnloadCommandBuffer(&CORE.RenderThread.commands[1]);
+
+    ConditionDestroy(&CORE.RenderThread.signal);
+    MutexDestroy(&CORE.RenderThread.mutex);
+
+    CORE.Window.flags &= ~FLAG_RENDER_THREAD;
+#endif
+}
+
+// Make OpenGL context current on main thread, waiting for render thread
+// NOTE: Called by rlgl on resources management while recording, context is returned on next Buffer_Update()
+static void RequestRenderContext(void)
+{
+#if defined(SUPPORT_RENDER_THREAD)
+    if (!CORE.RenderThread.active || CORE.RenderThread.contextOnMain) return;
+
+    MutexLock(&CORE.RenderThread.mutex);
+
+    // Wait for frame in flight, so no resource is modified while in use
+    while (CORE.RenderThread.framePending) ConditionWait(&CORE.RenderThread.signal, &CORE.RenderThread.mutex);
+
+    CORE.RenderThread.contextRequested = true;
+    ConditionBroadcast(&CORE.RenderThread.signal);
+    while (CORE.RenderThread.contextOwned) ConditionWait(&CORE.RenderThread.signal, &CORE.RenderThread.mutex);
+    CORE.RenderThread.contextRequested = false;
+
+    glfwMakeContextCurrent(CORE.Window.handle);
+    CORE.RenderThread.contextOnMain = true;
+
+    MutexUnlock(&CORE.RenderThread.mutex);
+#endif
+}
+#endif  // PLATFORM_DESKTOP
+
 // Swap back buffer with front buffer (screen drawing)
 void Buffer_Update(void)
 {
+    Buffer_DrawRecords();           // Draw geometry recorded by other threads
     rlDrawRenderBatchActive();      // Update and draw internal render batch
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+
+    CORE.Window.culledCount = rlGetCulledCount();
+    rlResetCulledCount();
+#if defined(PLATFORM_DESKTOP) && defined(SUPPORT_RENDER_THREAD)
+    // Render thread submits the frame and swaps buffers
+    if (CORE.RenderThread.active) SubmitRenderFrame();
+    else glfwSwapBuffers(CORE.Window.handle);
+#elif defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
     glfwSwapBuffers(CORE.Window.handle);
 #endif
 
+    // Render batch capacity changes are applied between frames
+    if (CORE.Window.batchElements > 0)
+    {
+        rlSetRenderBatchCapacity(CORE.Window.batchElements, CORE.Window.batchDrawCalls);
+        CORE.Window.batchElements = 0;
+    }
+    rlUpdateRenderBatchAdaptive();
+    rlSyncThreadBatchState();       // Batch buffers could have been reloaded
+    UpdateRenderTexturePool();      // Idle render textures unloaded once frame is submitted
+
 #if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
     eglSwapBuffers(CORE.Window.device, CORE.Window.surface);
 
@@ -4203,7 +5092,9 @@ void Events_Wait(void)
 
     CORE.Window.resizedLastFrame = false;
 
+    double waitTime = Time_Get();
     glfwWaitEvents();
+    CORE.Time.wait += Time_Get() - waitTime;
 
 #endif  // PLATFORM_DESKTOP
 
@@ -4359,6 +5250,9 @@ void Events_EndLoop(void){
     CORE.Time.realframe=CORE.Time.current-CORE.Time.previous;
     CORE.Time.previous=CORE.Time.current;
     CORE.Time.frameCounter++;
+
+    if (CORE.Resolution.enabled) UpdateDynamicResolution(CORE.Time.realframe - CORE.Time.wait);
+    CORE.Time.wait=0;
 
     // FPS calculation at the end of each loop
     #define FPS_CAPTURE_FRAMES_COUNT    30
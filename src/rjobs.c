@@ -0,0 +1,438 @@
+/**********************************************************************************************
+*
+*   rjobs - Work-stealing job system
+*
+*   DESCRIPTION:
+*       Every thread running jobs (main thread plus one worker per remaining core) owns a queue.
+*       Jobs are pushed to and popped from the back of the calling thread queue (LIFO, cache warm),
+*       idle threads steal from the front of other queues (FIFO, bigger chunks of work first).
+*       Job_Wait() does not block while jobs are queued, calling thread helps running them.
+*
+*   CONFIGURATION:
+*
+*   #define SUPPORT_JOB_SYSTEM
+*       Start worker threads on Window_Init(). If disabled, or only one core is available,
+*       jobs run serially on the calling thread and Job_Wait() returns immediately.
+*
+*   #define MAX_JOB_WORKERS
+*   #define MAX_JOB_QUEUE_SIZE
+*       Worker threads limit and per-thread queue capacity, a job submitted to a full queue
+*       runs inline on the calling thread.
+*
+*   LICENSE: zlib/libpng
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include "ascede.h"         // Declares module functions
+
+// Check if config flags have been externally provided on compilation line
+#if !defined(EXTERNAL_CONFIG_FLAGS)
+    #include "config.h"     // Defines module configuration flags
+#endif
+
+#include "utils.h"          // Required for: TRACELOG(), Thread, Mutex, Condition
+
+#if defined(_MSC_VER)
+    #include <intrin.h>     // Required for: _InterlockedExchangeAdd(), _InterlockedOr()
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#ifndef MAX_JOB_WORKERS
+    #define MAX_JOB_WORKERS               16    // Maximum number of worker threads
+#endif
+#ifndef MAX_JOB_QUEUE_SIZE
+    #define MAX_JOB_QUEUE_SIZE          1024    // Maximum jobs queued per thread (must be power of 2)
+#endif
+
+#define JOB_QUEUE_MASK      (MAX_JOB_QUEUE_SIZE - 1)
+
+// Atomic operations, sequentially consistent
+#if defined(_MSC_VER)
+    #define JOB_THREAD_LOCAL                __declspec(thread)
+    #define JOB_ATOMIC_ADD(ptr, value)      _InterlockedExchangeAdd((volatile long *)(ptr), (long)(value))
+    #define JOB_ATOMIC_LOAD(ptr)            _InterlockedOr((volatile long *)(ptr), 0)
+#else
+    #define JOB_THREAD_LOCAL                __thread
+    #define JOB_ATOMIC_ADD(ptr, value)      __atomic_fetch_add((ptr), (value), __ATOMIC_SEQ_CST)
+    #define JOB_ATOMIC_LOAD(ptr)            __atomic_load_n((ptr), __ATOMIC_SEQ_CST)
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Queued job, single task (func) or parallel for batch (rangeFunc)
+typedef struct Job {
+    JobFunc func;                   // Task function
+    JobRangeFunc rangeFunc;         // Parallel for batch function
+    void *data;                     // User data
+    int start;                      // Parallel for batch first item
+    int end;                        // Parallel for batch last item (not included)
+    JobCounter *counter;            // Completion counter (optional)
+} Job;
+
+// Per-thread job queue
+// NOTE: Owner pushes and pops at bottom, thieves steal at top
+typedef struct JobQueue {
+    Mutex mutex;                    // Queue access mutex
+    int top;                        // Oldest job index (steal end)
+    int bottom;                     // Next free job index (owner end)
+    Job jobs[MAX_JOB_QUEUE_SIZE];   // Jobs ring buffer
+} JobQueue;
+
+typedef struct JobSystemData {
+    bool ready;                                 // Worker threads running
+    bool shouldClose;                           // Worker threads exit requested
+    int workerCount;                            // Number of worker threads (main thread not included)
+    Thread workers[MAX_JOB_WORKERS];            // Worker threads
+    JobQueue queues[MAX_JOB_WORKERS + 1];       // Job queues, index 0 is main thread
+    Mutex sleepMutex;                           // Idle workers mutex
+    Condition wakeSignal;                       // Idle workers wake up signal
+    volatile int queuedJobs;                    // Jobs in all queues (not started)
+    volatile int sleepingWorkers;               // Workers waiting on wakeSignal
+} JobSystemData;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static JobSystemData JOBS = { 0 };                  // Global job system state
+
+static JOB_THREAD_LOCAL int jobThreadIndex = 0;     // Calling thread queue index (0 for main and external threads)
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+extern void InitJobSystem(void);
+extern void CloseJobSystem(void);
+
+static bool PushJob(Job job);                       // Push job to calling thread queue, returns false if full
+static bool PopJob(int index, Job *job);            // Pop newest job from thread queue
+static bool StealJob(int index, Job *job);          // Steal oldest job from any other thread queue
+static void RunJob(Job *job);                       // Run job and update its counter
+static void WakeWorkers(int count);                 // Wake sleeping workers after jobs have been queued
+#if defined(SUPPORT_JOB_SYSTEM)
+static void WorkerThread(void *arg);                // Worker thread main loop
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Start worker threads, one per core (main thread keeps one)
+// NOTE: Called on Window_Init()
+extern void InitJobSystem(void)
+{
+#if defined(SUPPORT_JOB_SYSTEM)
+    if (JOBS.ready) return;
+
+    int workerCount = GetCpuCoreCount() - 1;
+    if (workerCount > MAX_JOB_WORKERS) workerCount = MAX_JOB_WORKERS;
+
+    if (workerCount <= 0)
+    {
+        TRACELOG(LOG_INFO, "JOBS: Single core available, jobs run on calling thread");
+        return;
+    }
+
+    JOBS.shouldClose = false;
+    JOBS.queuedJobs = 0;
+    JOBS.sleepingWorkers = 0;
+
+    for (int i = 0; i <= workerCount; i++)
+    {
+        MutexInit(&JOBS.queues[i].mutex);
+        JOBS.queues[i].top = 0;
+        JOBS.queues[i].bottom = 0;
+    }
+
+    MutexInit(&JOBS.sleepMutex);
+    ConditionInit(&JOBS.wakeSignal);
+
+    // NOTE: Queues are ready before first worker starts stealing
+    JOBS.ready = true;
+    JOBS.workerCount = 0;
+
+    for (int i = 0; i < workerCount; i++)
+    {
+        // NOTE: Worker queue index is passed as argument (main thread is 0)
+        if (!ThreadCreate(&JOBS.workers[i], WorkerThread, (void *)(size_t)(i + 1)))
+        {
+            TRACELOG(LOG_WARNING, "JOBS: Failed to create worker thread %i", i + 1);
+            break;
+        }
+
+        JOBS.workerCount++;
+    }
+
+    if (JOBS.workerCount == 0) CloseJobSystem();
+    else TRACELOG(LOG_INFO, "JOBS: Job system initialized successfully (%i worker threads)", JOBS.workerCount);
+#endif
+}
+
+// Stop worker threads, queued jobs are completed first
+// NOTE: Called on Window_Close()
+extern void CloseJobSystem(void)
+{
+    if (!JOBS.ready) return;
+
+    // Help draining queues so workers can exit
+    Job job = { 0 };
+    while (PopJob(0, &job) || StealJob(0, &job)) RunJob(&job);
+
+    MutexLock(&JOBS.sleepMutex);
+    JOBS.shouldClose = true;
+    ConditionBroadcast(&JOBS.wakeSignal);
+    MutexUnlock(&JOBS.sleepMutex);
+
+    for (int i = 0; i < JOBS.workerCount; i++) ThreadJoin(&JOBS.workers[i]);
+
+    for (int i = 0; i <= JOBS.workerCount; i++) MutexDestroy(&JOBS.queues[i].mutex);
+    MutexDestroy(&JOBS.sleepMutex);
+    ConditionDestroy(&JOBS.wakeSignal);
+
+    JOBS.ready = false;
+    JOBS.workerCount = 0;
+
+    TRACELOG(LOG_INFO, "JOBS: Job system closed successfully");
+}
+
+// Queue a job, counter (optional) is incremented until job completes
+void Job_Submit(JobFunc func, void *data, JobCounter *counter)
+{
+    Job job = { 0 };
+    job.func = func;
+    job.data = data;
+    job.counter = counter;
+
+    if (counter != NULL) JOB_ATOMIC_ADD(&counter->pending, 1);
+
+    if (!JOBS.ready || !PushJob(job)) RunJob(&job);
+    else WakeWorkers(1);
+}
+
+// Split items range [0, count) in batches of batchSize items and queue them
+// NOTE: If batchSize <= 0 it is computed from worker count, if counter is NULL call blocks until all batches are done
+void Job_ParallelFor(JobRangeFunc func, void *data, int count, int batchSize, JobCounter *counter)
+{
+    if (count <= 0) return;
+
+    if (!JOBS.ready)
+    {
+        func(data, 0, count);
+        return;
+    }
+
+    // Aim for a few batches per thread, so stealing can balance uneven batches
+    if (batchSize <= 0) batchSize = count/((JOBS.workerCount + 1)*4);
+    if (batchSize <= 0) batchSize = 1;
+
+    JobCounter localCounter = { 0 };
+    JobCounter *batchCounter = (counter != NULL)? counter : &localCounter;
+
+    int batchCount = (count + batchSize - 1)/batchSize;
+    JOB_ATOMIC_ADD(&batchCounter->pending, batchCount);
+
+    int queued = 0;
+
+    for (int start = 0; start < count; start += batchSize)
+    {
+        Job job = { 0 };
+        job.rangeFunc = func;
+        job.data = data;
+        job.start = start;
+        job.end = ((start + batchSize) < count)? (start + batchSize) : count;
+        job.counter = batchCounter;
+
+        if (PushJob(job)) queued++;
+        else RunJob(&job);
+    }
+
+    if (queued > 0) WakeWorkers(queued);
+
+    if (counter == NULL) Job_Wait(&localCounter);
+}
+
+// Wait for counter jobs to complete, calling thread runs queued jobs meanwhile
+void Job_Wait(JobCounter *counter)
+{
+    if (counter == NULL) return;
+
+    Job job = { 0 };
+
+    while (JOB_ATOMIC_LOAD(&counter->pending) > 0)
+    {
+        if (PopJob(jobThreadIndex, &job) || StealJob(jobThreadIndex, &job)) RunJob(&job);
+        else ThreadYield();     // Remaining jobs are running on other threads
+    }
+}
+
+// Check if counter jobs are completed (non-blocking)
+bool Job_IsDone(JobCounter *counter)
+{
+    return ((counter == NULL) || (JOB_ATOMIC_LOAD(&counter->pending) <= 0));
+}
+
+// Get number of threads running jobs (including main thread)
+int Job_GetWorkerCount(void)
+{
+    return JOBS.workerCount + 1;
+}
+
+// Get calling thread index [0, Job_GetWorkerCount()), main thread is 0
+// NOTE: Threads not created by the job system also return 0
+int Job_GetWorkerIndex(void)
+{
+    return jobThreadIndex;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Push job to calling thread queue, returns false if full
+static bool PushJob(Job job)
+{
+    JobQueue *queue = &JOBS.queues[jobThreadIndex];
+    bool pushed = false;
+
+    MutexLock(&queue->mutex);
+
+    if ((queue->bottom - queue->top) < MAX_JOB_QUEUE_SIZE)
+    {
+        queue->jobs[queue->bottom & JOB_QUEUE_MASK] = job;
+        queue->bottom++;
+        pushed = true;
+    }
+
+    MutexUnlock(&queue->mutex);
+
+    // NOTE: Counted after push, a worker seeing queuedJobs > 0 will find the job
+    if (pushed) JOB_ATOMIC_ADD(&JOBS.queuedJobs, 1);
+
+    return pushed;
+}
+
+// Pop newest job from thread queue
+static bool PopJob(int index, Job *job)
+{
+    JobQueue *queue = &JOBS.queues[index];
+    bool popped = false;
+
+    MutexLock(&queue->mutex);
+
+    if (queue->bottom > queue->top)
+    {
+        queue->bottom--;
+        *job = queue->jobs[queue->bottom & JOB_QUEUE_MASK];
+        popped = true;
+    }
+
+    MutexUnlock(&queue->mutex);
+
+    if (popped) JOB_ATOMIC_ADD(&JOBS.queuedJobs, -1);
+
+    return popped;
+}
+
+// Steal oldest job from any other thread queue
+static bool StealJob(int index, Job *job)
+{
+    for (int i = 1; i <= JOBS.workerCount; i++)
+    {
+        JobQueue *queue = &JOBS.queues[(index + i)%(JOBS.workerCount + 1)];
+
+        // NOTE: Unlocked check to skip empty queues, confirmed under lock
+        if (queue->bottom == queue->top) continue;
+
+        bool stolen = false;
+
+        MutexLock(&queue->mutex);
+
+        if (queue->bottom > queue->top)
+        {
+            *job = queue->jobs[queue->top & JOB_QUEUE_MASK];
+            queue->top++;
+            stolen = true;
+        }
+
+        MutexUnlock(&queue->mutex);
+
+        if (stolen)
+        {
+            JOB_ATOMIC_ADD(&JOBS.queuedJobs, -1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Run job and update its counter
+static void RunJob(Job *job)
+{
+    if (job->func != NULL) job->func(job->data);
+    else job->rangeFunc(job->data, job->start, job->end);
+
+    if (job->counter != NULL) JOB_ATOMIC_ADD(&job->counter->pending, -1);
+}
+
+// Wake sleeping workers after jobs have been queued
+// NOTE: Workers register as sleeping before checking queuedJobs, so either
+// they see the new jobs or we see them sleeping (sequentially consistent atomics)
+static void WakeWorkers(int count)
+{
+    if (JOB_ATOMIC_LOAD(&JOBS.sleepingWorkers) == 0) return;
+
+    MutexLock(&JOBS.sleepMutex);
+
+    if (count > 1) ConditionBroadcast(&JOBS.wakeSignal);
+    else ConditionSignal(&JOBS.wakeSignal);
+
+    MutexUnlock(&JOBS.sleepMutex);
+}
+
+#if defined(SUPPORT_JOB_SYSTEM)
+// Worker thread main loop
+static void WorkerThread(void *arg)
+{
+    jobThreadIndex = (int)(size_t)arg;
+
+    Job job = { 0 };
+
+    while (true)
+    {
+        if (PopJob(jobThreadIndex, &job) || StealJob(jobThreadIndex, &job))
+        {
+            RunJob(&job);
+            continue;
+        }
+
+        // No jobs available, sleep until new jobs are queued
+        MutexLock(&JOBS.sleepMutex);
+
+        JOB_ATOMIC_ADD(&JOBS.sleepingWorkers, 1);
+        while ((JOB_ATOMIC_LOAD(&JOBS.queuedJobs) == 0) && !JOBS.shouldClose) ConditionWait(&JOBS.wakeSignal, &JOBS.sleepMutex);
+        JOB_ATOMIC_ADD(&JOBS.sleepingWorkers, -1);
+
+        bool closing = (JOBS.shouldClose && (JOB_ATOMIC_LOAD(&JOBS.queuedJobs) == 0));
+
+        MutexUnlock(&JOBS.sleepMutex);
+
+        if (closing) break;
+    }
+}
+#endif  // SUPPORT_JOB_SYSTEM
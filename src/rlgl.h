@@ -31,6 +31,7 @@
 *       Use selected OpenGL graphics backend, should be supported by platform
 *       Those preprocessor defines are only used on rlgl module, if OpenGL version is
 *       required by any other module, use rlGetVersion() to check it
+*       NOTE: On OpenGL 4.3, batch quads draw calls are submitted with multi-draw indirect calls
 *
 *   #define RLGL_IMPLEMENTATION
 *       Generates the implementation of the library into the included file.
@@ -47,6 +48,14 @@
 *   #define RLGL_ENABLE_OPENGL_DEBUG_CONTEXT
 *       Enable debug context (only available on OpenGL 4.3)
 *
+*   #define RLGL_ENABLE_THREAD_BATCHES
+*       Enable thread batches, geometry can be recorded from any thread (rlBeginThreadBatch())
+*       NOTE: Internal state is accessed through a thread-local pointer
+*
+*   Shader programs binaries cache (OpenGL 4.1 or GL_ARB_get_program_binary) is enabled setting
+*   load/save callbacks with rlSetShaderCacheCallbacks() before rlglInit(), programs are keyed
+*   by shaders code and OpenGL vendor/renderer/version, source compilation is used on mismatch
+*
 *   rlgl capabilities could be customized just defining some internal
 *   values before library inclusion (default values listed):
 *
@@ -54,6 +63,14 @@
 *   #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
 *   #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *   #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (Shader_SetValueTexture())
+*   #define RL_DEFAULT_BATCH_DRAW_TEXTURES        8    // Maximum number of textures a draw call can sample on default shader (multi-texture batching, max 8)
+*   #define RL_BATCH_ADAPTIVE_MIN_ELEMENTS     1024    // Minimum default batch elements on adaptive capacity (rlEnableRenderBatchAdaptive())
+*   #define RL_BATCH_ADAPTIVE_MAX_ELEMENTS    65536    // Maximum default batch elements on adaptive capacity (16384 on OpenGL ES 2.0, 16bit indices)
+*   #define RL_BATCH_ADAPTIVE_MIN_DRAWCALLS      64    // Minimum default batch draw calls on adaptive capacity
+*   #define RL_BATCH_ADAPTIVE_MAX_DRAWCALLS    4096    // Maximum default batch draw calls on adaptive capacity
+*   #define RL_BATCH_ADAPTIVE_SHRINK_FRAMES     300    // Frames under a quarter of capacity before adaptive capacity is halved
+*   #define RL_DEFAULT_COMMAND_BUFFER_SIZE  1048576    // Default command buffer initial size in bytes (grows if required)
+*   #define RL_MAX_DEPTH_LAYERS               1024    // Maximum number of depth layers (rlSetDepthLayer())
 *
 *   #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
 *   #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
@@ -215,6 +232,34 @@
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (Shader_SetValueTexture())
 #endif
+#ifndef RL_DEFAULT_BATCH_DRAW_TEXTURES
+    #define RL_DEFAULT_BATCH_DRAW_TEXTURES           8      // Maximum number of textures a draw call can sample on default shader (multi-texture batching)
+#endif
+#if (RL_DEFAULT_BATCH_DRAW_TEXTURES > 8)
+    #undef RL_DEFAULT_BATCH_DRAW_TEXTURES
+    #define RL_DEFAULT_BATCH_DRAW_TEXTURES           8      // Default shader samples up to 8 textures (minimum units available on OpenGL ES 2.0)
+#endif
+#ifndef RL_BATCH_ADAPTIVE_MIN_ELEMENTS
+    #define RL_BATCH_ADAPTIVE_MIN_ELEMENTS        1024      // Minimum default batch elements on adaptive capacity (rlEnableRenderBatchAdaptive())
+#endif
+#ifndef RL_BATCH_ADAPTIVE_MAX_ELEMENTS
+    #define RL_BATCH_ADAPTIVE_MAX_ELEMENTS       65536      // Maximum default batch elements on adaptive capacity (clamped to 16384 on OpenGL ES 2.0)
+#endif
+#ifndef RL_BATCH_ADAPTIVE_MIN_DRAWCALLS
+    #define RL_BATCH_ADAPTIVE_MIN_DRAWCALLS         64      // Minimum default batch draw calls on adaptive capacity
+#endif
+#ifndef RL_BATCH_ADAPTIVE_MAX_DRAWCALLS
+    #define RL_BATCH_ADAPTIVE_MAX_DRAWCALLS       4096      // Maximum default batch draw calls on adaptive capacity
+#endif
+#ifndef RL_BATCH_ADAPTIVE_SHRINK_FRAMES
+    #define RL_BATCH_ADAPTIVE_SHRINK_FRAMES        300      // Frames under a quarter of capacity before adaptive capacity is halved
+#endif
+#ifndef RL_DEFAULT_COMMAND_BUFFER_SIZE
+    #define RL_DEFAULT_COMMAND_BUFFER_SIZE     1048576      // Default command buffer initial size in bytes (grows if required)
+#endif
+#ifndef RL_MAX_DEPTH_LAYERS
+    #define RL_MAX_DEPTH_LAYERS                   1024      // Maximum number of depth layers (rlSetDepthLayer())
+#endif
 
 // Internal Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
@@ -325,6 +370,8 @@ typedef struct rlVertexBuffer {
     float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
     float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
     unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+    unsigned char *texunits;    // Vertex texture unit (1 component per vertex) (shader-location = 6)
+    float *shapes;              // Vertex shape parameters (half size, radius, thickness - 4 components per vertex) (shader-location = 7)
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
     unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
@@ -332,7 +379,7 @@ typedef struct rlVertexBuffer {
     unsigned short *indices;    // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
-    unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
+    unsigned int vboId[6];      // OpenGL Vertex Buffer Objects id (6 types of vertex data)
 } rlVertexBuffer;
 
 // Draw call type
@@ -346,6 +393,8 @@ typedef struct rlDrawCall {
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
     //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShaderId
     unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
+    unsigned int extraTextureId[RL_DEFAULT_BATCH_DRAW_TEXTURES];    // Additional textures sampled by the draw (texture units 1..N-1, default shader only)
+    int extraTextureCount;      // Number of additional textures used by the draw (0 for single texture draw)
 
     //Matrix projection;      // Projection matrix for this draw -> Using RLGL.projection by default
     //Matrix modelview;       // Modelview matrix for this draw -> Using RLGL.modelview by default
@@ -358,11 +407,61 @@ typedef struct rlRenderBatch {
     rlVertexBuffer *vertexBuffer; // Dynamic buffer(s) for vertex data
 
     rlDrawCall *draws;          // Draw calls array, depends on textureId
+    int drawCapacity;           // Draw calls array capacity
     int drawCounter;            // Draw calls counter
+    int shapeVertexCount;       // Vertex count up to last shape vertex (shape parameters upload, 0 if no shapes)
     float currentDepth;         // Current depth value for next draw
     int instances;
 } rlRenderBatch;
 
+// Render commands buffer
+// NOTE: Used to record OpenGL submission (batches, state changes, uniforms) and replay it
+// later on the thread owning the OpenGL context, see rlSetCommandBuffer()
+typedef struct rlCommandBuffer {
+    unsigned char *data;        // Commands data (command header + payload)
+    int size;                   // Commands data size in use (bytes)
+    int capacity;               // Commands data size allocated (bytes), grows if required
+    int commandCount;           // Number of commands recorded
+} rlCommandBuffer;
+
+typedef void (*rlContextCallback)(void);    // Callback to make OpenGL context current on calling thread
+
+// Shader program binaries cache callbacks
+// NOTE: Loaded data is freed by rlgl (ASC_FREE()), key is a '\0' terminated hex string
+typedef unsigned char *(*rlShaderCacheLoadCallback)(const char *key, int *dataSize);   // Load program binary from cache (NULL if not found)
+typedef void (*rlShaderCacheSaveCallback)(const char *key, const unsigned char *data, int dataSize);   // Save program binary into cache
+
+// Thread render batch
+// NOTE: Geometry (rlBegin/rlVertex/rlSetTexture...) is recorded into CPU memory on any thread,
+// the thread owning the OpenGL context submits it later with rlDrawThreadBatch()
+typedef struct rlThreadBatch {
+    rlRenderBatch *batches;     // Recorded batches, CPU memory only (a new one is started when current is full)
+    int batchCount;             // Number of batches recorded
+    int batchCapacity;          // Number of batches allocated
+    int bufferElements;         // Number of elements (QUADS) per batch, same as default batch
+    float *modelviews;          // Modelview matrix of every recorded batch (16 floats each, view transform applied on drawing)
+    int *blendModes;            // Blend mode of every recorded batch (a new batch is started on blend mode change)
+    unsigned int *shaderIds;    // Shader program of every recorded batch (a new batch is started on shader change)
+    int **shaderLocs;           // Shader locations of every recorded batch
+    void *context;              // Recording state (internal rlgl state copy)
+} rlThreadBatch;
+
+// Static render batch
+// NOTE: Geometry recorded into a thread batch is uploaded once into static GPU buffers (one segment per
+// recorded batch), it can be drawn any number of times with a transform and a tint, no vertex data upload
+typedef struct rlStaticBatch {
+    int segmentCount;           // Number of segments (vertex buffers)
+    int drawCount;              // Number of draw calls (all segments)
+    void *segments;             // Segments data (internal)
+} rlStaticBatch;
+
+// OpenGL state cache statistics
+// NOTE: Binds and state changes are skipped by rlgl when the requested value is already set
+typedef struct rlStateCacheStats {
+    unsigned int issued;        // Number of binds/state changes issued to OpenGL
+    unsigned int elided;        // Number of redundant binds/state changes skipped
+} rlStateCacheStats;
+
 #if defined(__STDC__) && __STDC_VERSION__ >= 199901L
     #include <stdbool.h>
 #elif !defined(__cplusplus) && !defined(bool) && !defined(RL_BOOL_TYPE)
@@ -495,6 +594,13 @@ typedef enum {
     RL_SHADER_ATTRIB_VEC4              // Shader attribute type: vec4 (4 float)
 } rlShaderAttributeDataType;
 
+// Shapes evaluated per fragment by default shader (signed distance field)
+typedef enum {
+    RL_SHAPE_NONE = 0,                 // No shape, vertex are textured
+    RL_SHAPE_ROUNDED_BOX,              // Box with rounded corners (rectangles, circles, capsules)
+    RL_SHAPE_ELLIPSE                   // Ellipse
+} rlShapeType;
+
 //------------------------------------------------------------------------------------
 // Functions Declaration - Matrix operations
 //------------------------------------------------------------------------------------
@@ -523,11 +629,15 @@ RLAPI void rlEnd(void);                               // Finish vertex providing
 RLAPI void rlVertex2i(int x, int y);                  // Define one vertex (position) - 2 int
 RLAPI void rlVertex2f(float x, float y);              // Define one vertex (position) - 2 float
 RLAPI void rlVertex3f(float x, float y, float z);     // Define one vertex (position) - 3 float
+RLAPI void rlVertexArray2f(const float *vertices, int count);  // Define multiple vertex (position) - 2 float array, using current texcoord and color
+RLAPI void rlSpriteArray(const float *x, const float *y, const float *rotation, const float *scale, const unsigned short *source, const unsigned char *colors, const float *sources, int count);   // Define multiple sprites quads (structure of arrays), sources quad data: 8 floats per source
+RLAPI void rlSetDepthLayer(int layer);                // Set depth layer for following vertex (-1: depth increased on every rlEnd())
 RLAPI void rlTexCoord2f(float x, float y);            // Define one vertex (texture coordinate) - 2 float
 RLAPI void rlNormal3f(float x, float y, float z);     // Define one vertex (normal) - 3 float
 RLAPI void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a);  // Define one vertex (color) - 4 byte
 RLAPI void rlColor3f(float x, float y, float z);          // Define one vertex (color) - 3 float
 RLAPI void rlColor4f(float x, float y, float z, float w); // Define one vertex (color) - 4 float
+RLAPI bool rlSetShape(int type, float halfWidth, float halfHeight, float radius, float thickness);   // Set shape for following vertex (texcoords as position from shape center), false if not supported
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - OpenGL style functions (common to 1.1, 3.3+, ES2)
@@ -573,6 +683,8 @@ RLAPI void rlEnableDepthTest(void);                     // Enable depth test
 RLAPI void rlDisableDepthTest(void);                    // Disable depth test
 RLAPI void rlEnableDepthMask(void);                     // Enable depth write
 RLAPI void rlDisableDepthMask(void);                    // Disable depth write
+RLAPI void rlEnableOpaqueMode(void);                    // Enable opaque mode (alpha tested default shader, quads drawn front to back)
+RLAPI void rlDisableOpaqueMode(void);                   // Disable opaque mode
 RLAPI void rlEnableBackfaceCulling(void);               // Enable backface culling
 RLAPI void rlDisableBackfaceCulling(void);              // Disable backface culling
 RLAPI void rlEnableScissorTest(void);                   // Enable scissor test
@@ -587,12 +699,25 @@ RLAPI void rlDisableSmoothLines(void);                  // Disable line aliasing
 RLAPI void rlEnableStereoRender(void);                  // Enable stereo rendering
 RLAPI void rlDisableStereoRender(void);                 // Disable stereo rendering
 RLAPI bool rlIsStereoRenderEnabled(void);               // Check if stereo render is enabled
+RLAPI void rlEnableViewCulling(void);                   // Enable view culling (quads out of viewport/scissor are rejected)
+RLAPI void rlDisableViewCulling(void);                  // Disable view culling
+RLAPI bool rlIsQuadCulled(float x0, float y0, float x1, float y1, float x2, float y2, float x3, float y3);  // Check if quad is out of view (view culling enabled), culled quads are counted
+RLAPI bool rlIsQuadVisible(float x0, float y0, float x1, float y1, float x2, float y2, float x3, float y3); // Check if quad is in view (view culling state ignored, not counted)
+RLAPI int rlGetCulledCount(void);                       // Get number of culled quads (since last reset)
+RLAPI void rlResetCulledCount(void);                    // Reset culled quads counter
 
 RLAPI void rlClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Clear color buffer with color
 RLAPI void rlClearScreenBuffers(void);                  // Clear used screen buffers (color and depth)
 RLAPI void rlCheckErrors(void);                         // Check and log OpenGL error codes
 RLAPI void rlSetBlendMode(int mode);                    // Set blending mode
 RLAPI void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation); // Set blending mode factor and equation (using OpenGL factors)
+RLAPI void rlEnablePremultipliedAlpha(void);            // Enable premultiplied alpha blending (alpha and additive blending share batch)
+RLAPI void rlDisablePremultipliedAlpha(void);           // Disable premultiplied alpha blending
+RLAPI bool rlIsPremultipliedAlpha(void);                // Check if premultiplied alpha blending is enabled (textures color must be premultiplied)
+RLAPI void rlGetDiffuseColor(unsigned char r, unsigned char g, unsigned char b, unsigned char a, float *color); // Get tint as shader diffuse color (premultiplied if required)
+RLAPI void rlInvalidateStateCache(void);                // Invalidate OpenGL state cache (required after OpenGL calls out of rlgl)
+RLAPI rlStateCacheStats rlGetStateCacheStats(bool reset); // Get OpenGL state cache statistics (issued/elided calls)
+RLAPI void rlPublishStateCacheStats(void);              // Publish statistics counted by thread issuing OpenGL calls (while it is idle, i.e. frame submission)
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - rlgl functionality
@@ -612,14 +737,45 @@ RLAPI int *rlGetShaderLocsDefault(void);              // Get default shader loca
 // Render batch management
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
 // but this render batch API is exposed in case of custom batches are required
-RLAPI rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements);  // Load a render batch system
+RLAPI rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements, int drawCalls);  // Load a render batch system
 RLAPI void rlUnloadRenderBatch(rlRenderBatch batch);                        // Unload render batch system
 RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);                         // Draw render batch data (Update->Draw->Reset)
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch);                    // Set the active render batch for rlgl (NULL for default internal)
 RLAPI void rlDrawRenderBatchActive(void);                                   // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);                             // Check internal buffer overflow for a given number of vertex
+RLAPI void rlSetRenderBatchCapacity(int bufferElements, int drawCalls);     // Set internal render batch capacity (buffers reloaded, call between frames)
+RLAPI int rlGetRenderBatchElements(void);                                   // Get internal render batch elements capacity (quads)
+RLAPI int rlGetRenderBatchDrawCalls(void);                                  // Get internal render batch draw calls capacity
+RLAPI void rlEnableRenderBatchAdaptive(void);                               // Enable internal render batch capacity adapted to observed load
+RLAPI void rlDisableRenderBatchAdaptive(void);                              // Disable internal render batch adaptive capacity
+RLAPI void rlUpdateRenderBatchAdaptive(void);                               // Update internal render batch capacity from observed load (once per frame, between frames)
 RLAPI void rlSetTexture(unsigned int id);           // Set current texture for render batch and check buffers limits
 
+// Command buffers management
+// NOTE: When a command buffer is set, batch draws and render state changes are recorded into it
+// instead of being submitted to OpenGL, allowing submission from a different thread (render thread)
+RLAPI rlCommandBuffer rlLoadCommandBuffer(int capacity);                    // Load a command buffer with initial capacity (bytes)
+RLAPI void rlUnloadCommandBuffer(rlCommandBuffer *cmds);                    // Unload command buffer
+RLAPI void rlSetCommandBuffer(rlCommandBuffer *cmds);                       // Set command buffer to record into (NULL for direct OpenGL submission)
+RLAPI rlCommandBuffer *rlGetCommandBuffer(void);                            // Get command buffer currently recording (NULL if none)
+RLAPI void rlSetContextCallback(rlContextCallback callback);                // Set callback to request OpenGL context while recording (resources management)
+RLAPI void rlExecuteCommandBuffer(rlCommandBuffer *cmds);                   // Submit recorded commands to OpenGL and reset buffer (requires current context)
+
+// Thread batches management
+// NOTE: While a thread batch is active on a thread, only geometry functions can be used on it
+// (vertex level operations, rlSetTexture(), rlSetShader(), matrix operations), no OpenGL calls are issued.
+// Texture, shader and blend mode are kept per recorded batch, uniform values are not: recorded geometry
+// uses the uniform values set when rlDrawThreadBatch() is called (setting uniforms while recording fails)
+RLAPI rlThreadBatch rlLoadThreadBatch(void);                                // Load a thread batch (CPU memory only, no OpenGL required)
+RLAPI void rlUnloadThreadBatch(rlThreadBatch *batch);                       // Unload thread batch
+RLAPI void rlSyncThreadBatchState(void);                                    // Snapshot main state used to begin recording (main thread, no recording in progress)
+RLAPI void rlBeginThreadBatch(rlThreadBatch *batch);                        // Begin recording geometry into thread batch on calling thread
+RLAPI void rlEndThreadBatch(void);                                          // End recording geometry on calling thread
+RLAPI void rlDrawThreadBatch(rlThreadBatch *batch);                         // Draw recorded geometry through current batch and reset thread batch
+RLAPI rlStaticBatch rlLoadStaticBatch(rlThreadBatch *batch);                // Load static batch from recorded geometry (GPU buffers) and reset thread batch
+RLAPI void rlUnloadStaticBatch(rlStaticBatch *batch);                       // Unload static batch GPU buffers
+RLAPI void rlDrawStaticBatch(rlStaticBatch batch, Matrix transform, const float *color);   // Draw static batch with transform (over current modelview) and tint color
+
 //------------------------------------------------------------------------------------------------------------------------
 
 // Vertex buffers management
@@ -636,6 +792,8 @@ RLAPI void rlDrawVertexArray(int offset, int count);
 RLAPI void rlDrawVertexArrayElements(int offset, int count, void *buffer);
 RLAPI void rlDrawVertexArrayInstanced(int offset, int count, int instances);
 RLAPI void rlDrawVertexArrayElementsInstanced(int offset, int count, void *buffer, int instances);
+RLAPI void rlDrawVertexArrayTexture(unsigned int vaoId, unsigned int textureId, int count);   // Draw vertex array (VAO) elements with texture, recorded while recording
+RLAPI void rlDrawVertexArrayTextureInstanced(unsigned int vaoId, unsigned int textureId, int count, int instances);   // Draw vertex array (VAO) vertex instanced with texture, recorded while recording
 
 // Textures management
 RLAPI unsigned int rlLoadTexture(void *data, int width, int height, int format, int mipmapCount); // Load texture in GPU
@@ -665,11 +823,15 @@ RLAPI int rlGetLocationAttrib(unsigned int shaderId, const char *attribName);
 RLAPI void rlSetUniform(int locIndex, const void *value, int uniformType, int count);   // Set shader value uniform
 RLAPI void rlSetUniformMatrix(int locIndex, Matrix mat);                        // Set shader value matrix
 RLAPI void rlSetUniformSampler(int locIndex, unsigned int textureId);           // Set shader value sampler
+RLAPI void rlSetShaderUniform(unsigned int id, int locIndex, const void *value, int uniformType, int count); // Set shader uniform value, skipped if already set (batch flushed only on change)
+RLAPI void rlSetShaderUniformMatrix(unsigned int id, int locIndex, Matrix mat);   // Set shader uniform matrix, skipped if already set (batch flushed only on change)
+RLAPI void rlSetShaderCacheCallbacks(rlShaderCacheLoadCallback load, rlShaderCacheSaveCallback save);  // Set shader program binaries cache callbacks (before rlglInit())
 RLAPI void rlSetShader(unsigned int id, int *locs);                             // Set shader currently active (id and locations)
 
 // Compute shader management
 RLAPI unsigned int rlLoadComputeShaderProgram(unsigned int shaderId);           // Load compute shader program
-RLAPI void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned int groupZ);  // Dispatch compute shader (equivalent to *draw* for graphics pilepine)
+RLAPI void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned int groupZ);  // Dispatch compute shader (equivalent to *draw* for graphics pilepine), recorded while recording
+RLAPI void rlComputeShaderBarrier(void);                                        // Make compute shader buffers writes visible to following draws/dispatches, recorded while recording
 
 // Shader buffer storage object management (ssbo)
 RLAPI unsigned int rlLoadShaderBuffer(unsigned long long size, const void *data, int usageHint);    // Load shader storage buffer object (SSBO)
@@ -677,11 +839,11 @@ RLAPI void rlUnloadShaderBuffer(unsigned int ssboId);
 RLAPI void rlUpdateShaderBufferElements(unsigned int id, const void *data, unsigned long long dataSize, unsigned long long offset); // Update SSBO buffer data
 RLAPI unsigned long long rlGetShaderBufferSize(unsigned int id);                // Get SSBO buffer size
 RLAPI void rlReadShaderBufferElements(unsigned int id, void *dest, unsigned long long count, unsigned long long offset);    // Bind SSBO buffer
-RLAPI void rlBindShaderBuffer(unsigned int id, unsigned int index);             // Copy SSBO buffer data
+RLAPI void rlBindShaderBuffer(unsigned int id, unsigned int index);             // Bind SSBO buffer, recorded while recording
 
 // Buffer management
-RLAPI void rlCopyBuffersElements(unsigned int destId, unsigned int srcId, unsigned long long destOffset, unsigned long long srcOffset, unsigned long long count); // Copy SSBO buffer data
-RLAPI void rlBindImageTexture(unsigned int id, unsigned int index, unsigned int format, int readonly);  // Bind image texture
+RLAPI void rlCopyBuffersElements(unsigned int destId, unsigned int srcId, unsigned long long destOffset, unsigned long long srcOffset, unsigned long long count); // Copy SSBO buffer data, recorded while recording
+RLAPI void rlBindImageTexture(unsigned int id, unsigned int index, unsigned int format, int readonly);  // Bind image texture, recorded while recording
 
 // Matrix state management
 RLAPI Matrix rlGetMatrixModelview(void);                                  // Get internal modelview matrix
@@ -764,11 +926,37 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 
 #include <stdlib.h>                     // Required for: malloc(), free()
 #include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
-#include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
+#include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), floorf(), log()
+
+// SIMD instructions used on bulk vertex transform (rlVertexArray2f()) and sprites quads generation (rlSpriteArray())
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define RLGL_SIMD_SSE
+    #include <emmintrin.h>              // Required for: _mm_set1_ps(), _mm_mul_ps(), _mm_add_ps(), _mm_storeu_ps(), _mm_cvttps_epi32()
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define RLGL_SIMD_NEON
+    #include <arm_neon.h>               // Required for: vdupq_n_f32(), vmlaq_n_f32(), vst1q_f32(), vcvtq_s32_f32()
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+    #if defined(_MSC_VER)
+        #define RL_THREAD_LOCAL __declspec(thread)
+    #else
+        #define RL_THREAD_LOCAL __thread
+    #endif
+#endif
+
+#define RL_CACHE_INVALID_ID     0xFFFFFFFF      // State cache unknown object id (next bind is always issued)
+#define RL_SHAPE_UNIT_OFFSET             7      // Vertex texture unit selecting shapes: offset + rlShapeType (over default shader texture units)
+#define RL_SHAPE_UNIT_PREMULTIPLIED      2      // Added to shape texture unit with premultiplied alpha (shape coverage scales color)
+#define RL_DEPTH_LAYER_Z(layer)  (-1.0f + (float)((layer) + 1)/(RL_MAX_DEPTH_LAYERS + 1))    // Vertex depth of layer (inside default ortho near/far)
+#define RL_CACHE_TEXTURE_UNITS  (((RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS + 1) > RL_DEFAULT_BATCH_DRAW_TEXTURES)? (RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS + 1) : RL_DEFAULT_BATCH_DRAW_TEXTURES)   // State cache tracked texture units
+#define RL_UNIFORM_VALUE_MAX_SIZE       64      // Maximum uniform value size kept to skip redundant updates (bytes, matrix 4x4)
+#define RL_SHADER_CACHE_KEY_SIZE        49      // Shader program binary cache key size (6 hashes as hex string + '\0')
+#define RL_SHADER_CACHE_VERSION        "1"      // Shader program binary cache version (increase to invalidate cached binaries)
+
 #ifndef PI
     #define PI 3.14159265358979323846f
 #endif
@@ -860,6 +1048,15 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Binded by default to shader location: 5
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXUNIT
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXUNIT      "vertexTexUnit"     // Binded by default to shader location: 6
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_SHAPE
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_SHAPE        "vertexShape"       // Binded by default to shader location: 7
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_DRAWUNIT
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_DRAWUNIT     "vertexDrawUnit"    // Binded by default to shader location: 8
+#endif
 
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
@@ -893,15 +1090,120 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Render command types (recorded into rlCommandBuffer)
+typedef enum {
+    RL_COMMAND_VIEWPORT = 0,                // params: x, y, width, height
+    RL_COMMAND_CLEAR_COLOR,                 // params: r, g, b, a
+    RL_COMMAND_CLEAR,                       // params: none
+    RL_COMMAND_FRAMEBUFFER,                 // params: framebuffer id
+    RL_COMMAND_ENABLE,                      // params: OpenGL capability
+    RL_COMMAND_DISABLE,                     // params: OpenGL capability
+    RL_COMMAND_DEPTH_MASK,                  // params: depth write enabled
+    RL_COMMAND_SCISSOR,                     // params: x, y, width, height
+    RL_COMMAND_BLEND,                       // params: source factor, destination factor, equation
+    RL_COMMAND_SHADER,                      // params: shader program id
+    RL_COMMAND_UNIFORM,                     // params: location, uniform type, count -> payload: values
+    RL_COMMAND_UNIFORM_MATRIX,              // params: location -> payload: 16 floats
+    RL_COMMAND_UPDATE_BATCH,                // payload: rlBatchState + vertex data (positions, texcoords, shapes, colors, texunits)
+    RL_COMMAND_DRAW_BATCH,                  // payload: rlBatchState + draw calls
+    RL_COMMAND_DRAW_ARRAY,                  // params: vertex array id, texture id, elements count
+    RL_COMMAND_DRAW_ARRAY_INSTANCED,        // params: vertex array id, texture id, vertex count, instances
+    RL_COMMAND_SHADER_BUFFER,               // params: shader buffer id, binding index
+    RL_COMMAND_DISPATCH,                    // params: groups x, y, z
+    RL_COMMAND_BARRIER,                     // params: none
+    RL_COMMAND_COPY_BUFFER,                 // params: destination buffer id, source buffer id -> payload: destination offset, source offset, count
+    RL_COMMAND_IMAGE_TEXTURE,               // params: texture id, image unit, pixel format, readonly
+} rlCommandType;
+
+// Render command header, payload follows it (if any)
+typedef struct rlCommand {
+    int type;                               // Command type (rlCommandType)
+    int size;                               // Command size in bytes, including header and payload (8-byte aligned)
+    int params[4];                          // Command parameters
+} rlCommand;
+
+// Render batch submission state
+// NOTE: Snapshot of the rlgl state required to upload and draw a batch,
+// it allows batch submission to be recorded and replayed on a different thread
+typedef struct rlBatchState {
+    int vertexCount;                        // Number of vertex to upload/draw
+    int shapeVertexCount;                   // Number of vertex to upload shape parameters
+    int drawCounter;                        // Number of draw calls
+    int instances;                          // Number of instances to draw (0 for no instancing)
+    unsigned int vaoId;                     // Vertex array object id (if supported)
+    unsigned int vboId[6];                  // Vertex buffer objects id
+    unsigned int shaderId;                  // Shader program id
+    int shaderLocs[RL_MAX_SHADER_LOCATIONS];    // Shader locations
+    float mvp[16];                          // Model-view-projection matrix
+    float color[4];                         // Diffuse color (tint), white for dynamic batches
+    unsigned int activeTextureId[RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS];   // Additional active textures
+} rlBatchState;
+
+// Indexed draw command for multi-draw indirect (GL_DRAW_INDIRECT_BUFFER layout)
+typedef struct rlDrawIndirectCommand {
+    unsigned int count;                     // Number of indices to draw
+    unsigned int instanceCount;             // Number of instances to draw
+    unsigned int firstIndex;                // First index offset
+    unsigned int baseVertex;                // Value added to indices
+    unsigned int baseInstance;              // First instance, draw textures units base (instanced attribute)
+} rlDrawIndirectCommand;
+
+// Static batch segment, GPU buffers of one recorded batch
+typedef struct rlStaticSegment {
+    rlBatchState state;                     // Submission state (VAO/VBOs, draw calls count)
+    rlDrawCall *draws;                      // Draw calls
+    int blendMode;                          // Blend mode recorded
+} rlStaticSegment;
+
+// Quad sorting key (opaque mode)
+typedef struct rlQuadDepth {
+    float depth;                            // Quad depth (first vertex z)
+    int index;                              // Quad index in draw call
+} rlQuadDepth;
+
+// Shader uniform location cached by name
+typedef struct rlUniformName {
+    char *name;                             // Uniform name (NULL for empty slot)
+    unsigned int hash;                      // Uniform name hash
+    int location;                           // Uniform location (-1 if not found on shader)
+} rlUniformName;
+
+// Shader uniform last value set
+typedef struct rlUniformValue {
+    int location;                           // Uniform location (-1 for empty slot)
+    int size;                               // Value size in bytes (0 if value is unknown)
+    unsigned char data[RL_UNIFORM_VALUE_MAX_SIZE];  // Value data
+} rlUniformValue;
+
+// Shader program uniforms cache
+// NOTE: Both tables are open addressing hash tables (power of two capacity)
+typedef struct rlShaderUniforms {
+    unsigned int programId;                 // Shader program id
+    int nameCount;                          // Number of names cached
+    int nameCapacity;                       // Names table capacity
+    rlUniformName *names;                   // Uniform locations by name
+    int valueCount;                         // Number of values kept
+    int valueCapacity;                      // Values table capacity
+    rlUniformValue *values;                 // Uniform values by location
+} rlShaderUniforms;
+
 typedef struct rlglData {
     rlRenderBatch *currentBatch;            // Current render batch
     rlRenderBatch defaultBatch;             // Default internal render batch
+    rlCommandBuffer *currentCommands;       // Current command buffer recording (NULL for direct submission)
+    rlContextCallback contextCallback;      // Callback to request OpenGL context while recording
+    rlThreadBatch *threadBatch;             // Thread batch recording (NULL for main state)
+    struct rlglData *previousState;         // State to restore on rlEndThreadBatch()
 
     struct {
         int vertexCounter;                  // Current active render batch vertex counter (generic, used for all batches)
         float texcoordx, texcoordy;         // Current active texture coordinate (added on glVertex*())
         float normalx, normaly, normalz;    // Current active normal (added on glVertex*())
         unsigned char colorr, colorg, colorb, colora;   // Current active color (added on glVertex*())
+        unsigned char colorAlpha;           // Current active color alpha (not encoded, premultiplied alpha additive blending)
+        unsigned char textureUnit;          // Current active texture unit of the draw (added on glVertex*())
+        int shapeType;                      // Current active shape type (rlShapeType, added on glVertex*())
+        float shape[4];                     // Current active shape parameters: half size, radius, thickness (added on glVertex*())
 
         int currentMatrixMode;              // Current matrix mode
         Matrix *currentMatrix;              // Current matrix pointer
@@ -909,15 +1211,21 @@ typedef struct rlglData {
         Matrix projection;                  // Default projection matrix
         Matrix transform;                   // Transform matrix to be used with rlTranslate, rlRotate, rlScale
         bool transformRequired;             // Require transform matrix application to current draw-call vertex (if required)
+        bool transformAffine;               // Transform matrix is 2D affine (2x3: m0, m1, m4, m5, m12, m13), z unchanged
         Matrix stack[RL_MAX_MATRIX_STACK_SIZE];// Matrix stack for push/pop
         int stackCounter;                   // Matrix stack counter
 
         unsigned int defaultTextureId;      // Default texture used on shapes/poly drawing (required by shader)
         unsigned int activeTextureId[RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS];    // Active texture ids to be enabled on batch drawing (0 active by default)
         unsigned int defaultVShaderId;      // Default vertex shader id (used by default shader program)
-        unsigned int defaultFShaderId;      // Default fragment shader id (used by default shader program)
+        unsigned int defaultFShaderId;      // Default fragment shader id (used by custom shaders without fragment shader)
+        const char *defaultVShaderCode;     // Default vertex shader code (compiled on demand if default program loaded from cache)
+        const char *defaultFShaderCode;     // Default fragment shader code (compiled on demand, default program uses batch fragment shader)
         unsigned int defaultShaderId;       // Default shader program id, supports vertex color and diffuse texture
         int *defaultShaderLocs;             // Default shader locations pointer to be used on rendering
+        const char *defaultBatchFShaderCode;    // Default batch fragment shader code (alpha tested variant compiled on demand)
+        unsigned int alphaTestShaderId;     // Default shader program variant with alpha test (opaque mode), loaded on demand
+        int alphaTestShaderLocs[RL_MAX_SHADER_LOCATIONS];  // Alpha tested default shader locations
         unsigned int currentShaderId;       // Current shader id to be used on rendering (by default, defaultShaderId)
         int *currentShaderLocs;             // Current shader locations pointer to be used on rendering (by default, defaultShaderLocs)
 
@@ -926,6 +1234,7 @@ typedef struct rlglData {
         Matrix viewOffsetStereo[2];         // VR stereo rendering eyes view offset matrices
 
         int currentBlendMode;               // Blending mode active
+        bool premultipliedAlpha;            // Premultiplied alpha blending (additive blending encoded as vertex alpha 0)
         int glBlendSrcFactor;               // Blending source factor
         int glBlendDstFactor;               // Blending destination factor
         int glBlendEquation;                // Blending equation
@@ -933,7 +1242,69 @@ typedef struct rlglData {
         int framebufferWidth;               // Default framebuffer width
         int framebufferHeight;              // Default framebuffer height
 
+        int viewport[4];                    // Current viewport (x, y, width, height)
+        int scissor[4];                     // Current scissor rectangle (x, y, width, height)
+        bool scissorTest;                   // Scissor test enabled
+        bool viewCulling;                   // View culling enabled (quads out of cull rectangle are rejected)
+        int depthLayer;                     // Depth layer of following vertex (-1: depth increased on every rlEnd())
+        bool opaqueMode;                    // Opaque mode: alpha tested default shader, quads sorted front to back
+        bool cullDirty;                     // Cull matrix/rectangle require update (matrices, viewport or scissor changed)
+        Matrix cullMatrix;                  // Transform from vertex to clip space (transform*modelview*projection)
+        float cullRec[4];                   // Cull rectangle in normalized device coordinates (min x, min y, max x, max y)
+        int culledCount;                    // Culled quads counter
+
     } State;            // Renderer state
+    struct {
+        unsigned int programId;             // Shader program in use
+        unsigned int vaoId;                 // Vertex array object bound
+        unsigned int arrayBufferId;         // Buffer bound to GL_ARRAY_BUFFER
+        unsigned int elementBufferId;       // Buffer bound to GL_ELEMENT_ARRAY_BUFFER (VAO state, unknown after VAO change)
+        int activeTextureUnit;              // Active texture unit (-1 unknown)
+        unsigned int textureId[RL_CACHE_TEXTURE_UNITS];    // Texture bound to GL_TEXTURE_2D per unit (default + batch units)
+        int capability[4];                  // Enabled capabilities: blend, depth test, cull face, scissor test (-1 unknown)
+        int blendSrcFactor;                 // Blending source factor
+        int blendDstFactor;                 // Blending destination factor
+        int blendEquation;                  // Blending equation
+        int scissor[4];                     // Scissor rectangle
+        unsigned int uniformProgramId;      // Shader program with batch default uniforms uploaded (colDiffuse, texture0)
+        float mvp[16];                      // MVP matrix uploaded to uniformProgramId
+        float color[4];                     // Diffuse color uploaded to uniformProgramId
+
+        unsigned int issued;                // Binds/state changes issued to OpenGL (thread issuing OpenGL calls only)
+        unsigned int elided;                // Redundant binds/state changes skipped (thread issuing OpenGL calls only)
+        rlStateCacheStats published;        // Statistics published to recording thread (rlPublishStateCacheStats())
+    } Cache;            // OpenGL state shadow, used to skip redundant calls
+    struct {
+        rlShaderUniforms *programs;         // Uniforms cache per shader program
+        int programCount;                   // Number of shader programs cached
+        unsigned int enabledProgramId;      // Shader program enabled for uniform updates (rlEnableShader())
+    } Uniforms;         // Shader uniforms cache (locations and last values set)
+    struct {
+        rlShaderCacheLoadCallback load;     // Callback to load program binary from cache
+        rlShaderCacheSaveCallback save;     // Callback to save program binary into cache
+        unsigned int driverHash[3];         // OpenGL vendor, renderer and version strings hashes (binaries are driver specific)
+    } ShaderCache;      // Shader program binaries cache
+    struct {
+        unsigned int commandsId;            // Draw commands buffer (GL_DRAW_INDIRECT_BUFFER)
+        unsigned int unitsId;               // Draw textures units base values buffer (instanced attribute, shader-location = 8)
+        rlDrawIndirectCommand *commands;    // Draw commands of current submission
+        int capacity;                       // Draw commands capacity
+    } MultiDraw;        // Batch draw calls submitted with one multi-draw indirect call
+    struct {
+        bool enabled;                       // Default batch capacity adapted to observed load (rlUpdateRenderBatchAdaptive())
+        int vertexOverflows;                // Default batch draws forced by vertex buffer full (since last update)
+        int drawOverflows;                  // Default batch draws forced by draw calls array full (since last update)
+        int requiredElements;               // Elements required by thread batches bigger than default batch (since last update)
+        int peakVertices;                   // Maximum vertex count on a default batch draw (since last update)
+        int peakDraws;                      // Maximum draw calls on a default batch draw (since last update)
+        int lowElementsFrames;              // Consecutive updates using under a quarter of elements capacity
+        int lowDrawsFrames;                 // Consecutive updates using under a quarter of draw calls capacity
+    } Adaptive;         // Default batch adaptive capacity
+    struct {
+        rlQuadDepth *quads;                 // Quads depth and index to sort (rlSortBatchQuads())
+        unsigned char *scratch;             // Quads data scratch buffer used to reorder vertex data
+        int capacity;                       // Quads capacity of sort buffers (grown when required)
+    } Sort;             // Opaque mode quads sort buffers, kept between batch draws
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension) (GL_ARB_vertex_array_object)
         bool instancing;                    // Instancing supported (GL_ANGLE_instanced_arrays, GL_EXT_draw_instanced + GL_EXT_instanced_arrays)
@@ -949,6 +1320,8 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool programBinary;                 // Program binaries support (OpenGL 4.1, GL_ARB_get_program_binary)
+        bool multiDrawIndirect;             // Multi-draw indirect support with base instance (OpenGL 4.3, GL_ARB_multi_draw_indirect)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
@@ -964,7 +1337,15 @@ typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions
 // Global Variables Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+static rlglData rlglMain = { 0 };                           // Main state, used by any thread not recording a thread batch
+static RL_THREAD_LOCAL rlglData *rlglState = &rlglMain;     // Calling thread state (thread batch recording context)
+static rlglData rlglShared = { 0 };                         // Main state snapshot, recording threads state is copied from it (rlSyncThreadBatchState())
+
+#define RLGL (*rlglState)
+#else
 static rlglData RLGL = { 0 };
+#endif
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 #if defined(GRAPHICS_API_OPENGL_ES2)
@@ -985,10 +1366,50 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static void rlLoadShaderAlphaTest(void);    // Load alpha tested variant of default shader (opaque mode)
+static void rlSortBatchQuads(rlRenderBatch *batch);   // Sort batch draw calls quads front to back (opaque mode)
+static void rlUpdateMatrixState(void);                // Update state depending on matrices (transform type, cull matrix)
+static void rlUpdateBatchBuffers(const rlBatchState *state, const float *vertices, const float *texcoords, const float *shapes, const unsigned char *colors, const unsigned char *texunits); // Upload batch vertex data to GPU
+static void rlDrawBatchBuffers(const rlBatchState *state, const rlDrawCall *draws);  // Draw batch vertex buffers
+#if defined(GRAPHICS_API_OPENGL_43)
+static int rlDrawBatchMultiDraw(const rlBatchState *state, const rlDrawCall *draws, int first, int vertexOffset, int *vertexEnd);  // Draw batch quads draw calls run with one multi-draw indirect call
+static void rlEnableDrawUnitsAttrib(void);              // Enable draw textures units base attribute on bound VAO (multi-draw indirect)
+#endif
+static int rlGetDrawTextureUnit(rlDrawCall *draw, unsigned int id);    // Get draw texture unit for texture (multi-texture batching), -1 if new draw required
+static void rlGetSpriteSinCos(float angle, float *sinValue, float *cosValue);   // Get approximated sine and cosine of angle in radians (sprites rotation)
+static void *rlRecordCommand(int type, int p0, int p1, int p2, int p3, int dataSize);   // Record a command into current command buffer, returns payload
+static void rlCacheUseProgram(unsigned int id);         // Use shader program (skipped if already in use)
+static void rlCacheBindVertexArray(unsigned int id);    // Bind vertex array object (skipped if already bound)
+static void rlCacheBindBuffer(int target, unsigned int id); // Bind array/element buffer (skipped if already bound)
+static void rlCacheActiveTexture(int unit);             // Set active texture unit (skipped if already active)
+static void rlCacheBlendMode(int srcFactor, int dstFactor, int equation);   // Set blending factors and equation (skipped if already set)
+static void rlCacheUniformsChanged(void);               // Mark batch default uniforms as unknown (uniform set out of batch)
+static rlShaderUniforms *rlGetShaderUniforms(unsigned int id, bool create); // Get shader program uniforms cache (created if required)
+static void rlLoadShaderUniforms(unsigned int id);      // Load shader program active uniforms locations into cache
+static void rlUnloadShaderUniforms(unsigned int id);    // Unload shader program uniforms cache
+static rlUniformName *rlFindUniformName(rlShaderUniforms *uniforms, const char *name, unsigned int hash);   // Find uniform name slot (empty slot if not found)
+static void rlAddUniformName(rlShaderUniforms *uniforms, const char *name, int location);  // Add uniform location by name
+static rlUniformValue *rlGetUniformValue(rlShaderUniforms *uniforms, int location, bool create);   // Get uniform value slot by location
+static void rlForgetUniformValue(unsigned int id, int location);    // Mark uniform value as unknown (set out of uniforms cache)
+static bool rlPrepareUniformValue(unsigned int id, int locIndex, const void *value, int size);    // Check uniform value change, flushing batch if required
+static void rlStoreUniformValue(unsigned int id, int locIndex, const void *value, int size);  // Keep uniform value set
+static int rlGetUniformComponents(int uniformType);     // Get uniform type components count
+static unsigned int rlHashString(const char *text);     // Compute string hash (FNV-1a)
+static bool rlGetShaderCacheKey(const char *vsCode, const char *fsCode, char *key);  // Get shader program binary cache key (false if cache not available)
+static unsigned int rlLoadShaderBinary(const char *key);    // Load shader program from binary cache (0 if not found or not valid)
+static void rlSaveShaderBinary(unsigned int id, const char *key);   // Save shader program binary into cache
+static bool rlCheckThreadBatchUniform(void);            // Check if a thread batch is being recorded (uniform values can not be set)
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+static void rlNextThreadBatch(rlThreadBatch *batch);   // Start recording next batch of thread batch (current one full)
+#endif
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
+static void rlRequireContext(void);         // Make sure OpenGL context is available for direct calls while recording
+static void rlCacheBindTexture(unsigned int id);            // Bind GL_TEXTURE_2D on active unit (skipped if already bound)
+static void rlCacheCapability(int capability, bool enabled);    // Enable/disable capability (skipped if already set)
+static void rlCacheScissor(int x, int y, int width, int height);    // Set scissor rectangle (skipped if already set)
 #if defined(GRAPHICS_API_OPENGL_11)
 static int rlGenTextureMipmapsData(unsigned char *data, int baseWidth, int baseHeight);         // Generate mipmaps data on CPU side
 static unsigned char *rlGenNextMipmapData(unsigned char *srcData, int srcWidth, int srcHeight); // Generate next mipmap level on CPU side
@@ -1058,6 +1479,7 @@ void rlPushMatrix(void)
 
     RLGL.State.stack[RLGL.State.stackCounter] = *RLGL.State.currentMatrix;
     RLGL.State.stackCounter++;
+    rlUpdateMatrixState();
 }
 
 // Pop lattest inserted matrix from RLGL.State.stack
@@ -1075,32 +1497,58 @@ void rlPopMatrix(void)
         RLGL.State.currentMatrix = &RLGL.State.modelview;
         RLGL.State.transformRequired = false;
     }
+
+    rlUpdateMatrixState();
 }
 
 // Reset current matrix to identity matrix
 void rlLoadIdentity(void)
 {
     *RLGL.State.currentMatrix = rlMatrixIdentity();
+    rlUpdateMatrixState();
 }
 
 // Multiply the current matrix by a translation matrix
+// NOTE: Only translation column changes, no full matrix multiplication required
 void rlTranslatef(float x, float y, float z)
 {
-    Matrix matTranslation = {
-        1.0f, 0.0f, 0.0f, x,
-        0.0f, 1.0f, 0.0f, y,
-        0.0f, 0.0f, 1.0f, z,
-        0.0f, 0.0f, 0.0f, 1.0f
-    };
+    Matrix *mat = RLGL.State.currentMatrix;
 
-    // NOTE: We transpose matrix with multiplication order
-    *RLGL.State.currentMatrix = rlMatrixMultiply(matTranslation, *RLGL.State.currentMatrix);
+    mat->m12 += mat->m0*x + mat->m4*y + mat->m8*z;
+    mat->m13 += mat->m1*x + mat->m5*y + mat->m9*z;
+    mat->m14 += mat->m2*x + mat->m6*y + mat->m10*z;
+    mat->m15 += mat->m3*x + mat->m7*y + mat->m11*z;
+
+    rlUpdateMatrixState();
 }
 
 // Multiply the current matrix by a rotation matrix
 // NOTE: The provided angle must be in degrees
+// NOTE: Rotations around z axis (2D) only combine first two matrix columns
 void rlRotatef(float angle, float x, float y, float z)
 {
+    if ((x == 0.0f) && (y == 0.0f) && (z != 0.0f))
+    {
+        Matrix *mat = RLGL.State.currentMatrix;
+        float sinres = (z > 0.0f)? sinf(DEG2RAD*angle) : -sinf(DEG2RAD*angle);
+        float cosres = cosf(DEG2RAD*angle);
+
+        float m0 = mat->m0, m1 = mat->m1, m2 = mat->m2, m3 = mat->m3;
+
+        mat->m0 = m0*cosres + mat->m4*sinres;
+        mat->m1 = m1*cosres + mat->m5*sinres;
+        mat->m2 = m2*cosres + mat->m6*sinres;
+        mat->m3 = m3*cosres + mat->m7*sinres;
+
+        mat->m4 = mat->m4*cosres - m0*sinres;
+        mat->m5 = mat->m5*cosres - m1*sinres;
+        mat->m6 = mat->m6*cosres - m2*sinres;
+        mat->m7 = mat->m7*cosres - m3*sinres;
+
+        rlUpdateMatrixState();
+        return;
+    }
+
     Matrix matRotation = rlMatrixIdentity();
 
     // Axis vector (x, y, z) normalization
@@ -1140,20 +1588,20 @@ void rlRotatef(float angle, float x, float y, float z)
 
     // NOTE: We transpose matrix with multiplication order
     *RLGL.State.currentMatrix = rlMatrixMultiply(matRotation, *RLGL.State.currentMatrix);
+    rlUpdateMatrixState();
 }
 
 // Multiply the current matrix by a scaling matrix
+// NOTE: Only matrix columns are scaled, no full matrix multiplication required
 void rlScalef(float x, float y, float z)
 {
-    Matrix matScale = {
-        x, 0.0f, 0.0f, 0.0f,
-        0.0f, y, 0.0f, 0.0f,
-        0.0f, 0.0f, z, 0.0f,
-        0.0f, 0.0f, 0.0f, 1.0f
-    };
+    Matrix *mat = RLGL.State.currentMatrix;
 
-    // NOTE: We transpose matrix with multiplication order
-    *RLGL.State.currentMatrix = rlMatrixMultiply(matScale, *RLGL.State.currentMatrix);
+    mat->m0 *= x; mat->m1 *= x; mat->m2 *= x; mat->m3 *= x;
+    mat->m4 *= y; mat->m5 *= y; mat->m6 *= y; mat->m7 *= y;
+    mat->m8 *= z; mat->m9 *= z; mat->m10 *= z; mat->m11 *= z;
+
+    rlUpdateMatrixState();
 }
 
 // Multiply the current matrix by another matrix
@@ -1166,6 +1614,7 @@ void rlMultMatrixf(float *matf)
                    matf[3], matf[7], matf[11], matf[15] };
 
     *RLGL.State.currentMatrix = rlMatrixMultiply(*RLGL.State.currentMatrix, mat);
+    rlUpdateMatrixState();
 }
 
 // Multiply the current matrix by a perspective matrix generated by parameters
@@ -1198,6 +1647,7 @@ void rlFrustum(double left, double right, double bottom, double top, double znea
     matFrustum.m15 = 0.0f;
 
     *RLGL.State.currentMatrix = rlMatrixMultiply(*RLGL.State.currentMatrix, matFrustum);
+    rlUpdateMatrixState();
 }
 
 // Multiply the current matrix by an orthographic matrix generated by parameters
@@ -1229,12 +1679,22 @@ void rlOrtho(double left, double right, double bottom, double top, double znear,
     matOrtho.m15 = 1.0f;
 
     *RLGL.State.currentMatrix = rlMatrixMultiply(*RLGL.State.currentMatrix, matOrtho);
+    rlUpdateMatrixState();
 }
 #endif
 
 // Set the viewport area (transformation from normalized device coordinates to window coordinates)
 void rlViewport(int x, int y, int width, int height)
 {
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.viewport[0] = x;
+    RLGL.State.viewport[1] = y;
+    RLGL.State.viewport[2] = width;
+    RLGL.State.viewport[3] = height;
+    RLGL.State.cullDirty = true;
+
+    if (RLGL.currentCommands != NULL) { rlRecordCommand(RL_COMMAND_VIEWPORT, x, y, width, height, 0); return; }
+#endif
     glViewport(x, y, width, height);
 }
 
@@ -1259,11 +1719,33 @@ void rlEnd() { glEnd(); }
 void rlVertex2i(int x, int y) { glVertex2i(x, y); }
 void rlVertex2f(float x, float y) { glVertex2f(x, y); }
 void rlVertex3f(float x, float y, float z) { glVertex3f(x, y, z); }
+void rlVertexArray2f(const float *vertices, int count) { for (int i = 0; i < count; i++) glVertex2f(vertices[2*i], vertices[2*i + 1]); }
+void rlSpriteArray(const float *x, const float *y, const float *rotation, const float *scale, const unsigned short *source, const unsigned char *colors, const float *sources, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        const float *src = sources + 8*source[i];
+        float scaledSin = sinf(rotation[i]*DEG2RAD)*scale[i];
+        float scaledCos = cosf(rotation[i]*DEG2RAD)*scale[i];
+
+        glColor4ub(colors[4*i], colors[4*i + 1], colors[4*i + 2], colors[4*i + 3]);
+        glTexCoord2f(src[4], src[5]);
+        glVertex2f(x[i] + src[0]*scaledCos - src[1]*scaledSin, y[i] + src[0]*scaledSin + src[1]*scaledCos);
+        glTexCoord2f(src[4], src[7]);
+        glVertex2f(x[i] + src[0]*scaledCos - src[3]*scaledSin, y[i] + src[0]*scaledSin + src[3]*scaledCos);
+        glTexCoord2f(src[6], src[7]);
+        glVertex2f(x[i] + src[2]*scaledCos - src[3]*scaledSin, y[i] + src[2]*scaledSin + src[3]*scaledCos);
+        glTexCoord2f(src[6], src[5]);
+        glVertex2f(x[i] + src[2]*scaledCos - src[1]*scaledSin, y[i] + src[2]*scaledSin + src[1]*scaledCos);
+    }
+}
 void rlTexCoord2f(float x, float y) { glTexCoord2f(x, y); }
 void rlNormal3f(float x, float y, float z) { glNormal3f(x, y, z); }
 void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a) { glColor4ub(r, g, b, a); }
 void rlColor3f(float x, float y, float z) { glColor3f(x, y, z); }
 void rlColor4f(float x, float y, float z, float w) { glColor4f(x, y, z, w); }
+bool rlSetShape(int type, float halfWidth, float halfHeight, float radius, float thickness) { return (type == RL_SHAPE_NONE); }
+void rlSetDepthLayer(int layer) { }
 #endif
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 // Initialize drawing mode (how to organize vertex)
@@ -1291,11 +1773,17 @@ void rlBegin(int mode)
             }
         }
 
-        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+        if (RLGL.currentBatch->drawCounter >= RLGL.currentBatch->drawCapacity)
+        {
+            if (RLGL.currentBatch == &RLGL.defaultBatch) RLGL.Adaptive.drawOverflows++;
+            rlDrawRenderBatch(RLGL.currentBatch);
+        }
 
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.defaultTextureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].extraTextureCount = 0;
+        RLGL.State.textureUnit = 0;
     }
 }
 
@@ -1305,7 +1793,8 @@ void rlEnd(void)
     // NOTE: Depth increment is dependant on rlOrtho(): z-near and z-far values,
     // as well as depth buffer bit-depth (16bit or 24bit or 32bit)
     // Correct increment formula would be: depthInc = (zfar - znear)/pow(2, bits)
-    RLGL.currentBatch->currentDepth += (1.0f/20000.0f);
+    // NOTE: Depth is kept while a depth layer is set
+    if (RLGL.State.depthLayer < 0) RLGL.currentBatch->currentDepth += (1.0f/20000.0f);
 
     // Verify internal buffers limits
     // NOTE: This check is combined with usage of rlCheckRenderBatchLimit()
@@ -1315,6 +1804,7 @@ void rlEnd(void)
         // we need to call rlPopMatrix() before to recover *RLGL.State.currentMatrix (RLGL.State.modelview) for the next forced draw call!
         // If we have multiple matrix pushed, it will require "RLGL.State.stackCounter" pops before launching the draw
         for (int i = RLGL.State.stackCounter; i >= 0; i--) rlPopMatrix();
+        if (RLGL.currentBatch == &RLGL.defaultBatch) RLGL.Adaptive.vertexOverflows++;
         rlDrawRenderBatch(RLGL.currentBatch);
     }
 }
@@ -1330,9 +1820,17 @@ void rlVertex3f(float x, float y, float z)
     // Transform provided vector if required
     if (RLGL.State.transformRequired)
     {
-        tx = RLGL.State.transform.m0*x + RLGL.State.transform.m4*y + RLGL.State.transform.m8*z + RLGL.State.transform.m12;
-        ty = RLGL.State.transform.m1*x + RLGL.State.transform.m5*y + RLGL.State.transform.m9*z + RLGL.State.transform.m13;
-        tz = RLGL.State.transform.m2*x + RLGL.State.transform.m6*y + RLGL.State.transform.m10*z + RLGL.State.transform.m14;
+        if (RLGL.State.transformAffine)
+        {
+            tx = RLGL.State.transform.m0*x + RLGL.State.transform.m4*y + RLGL.State.transform.m12;
+            ty = RLGL.State.transform.m1*x + RLGL.State.transform.m5*y + RLGL.State.transform.m13;
+        }
+        else
+        {
+            tx = RLGL.State.transform.m0*x + RLGL.State.transform.m4*y + RLGL.State.transform.m8*z + RLGL.State.transform.m12;
+            ty = RLGL.State.transform.m1*x + RLGL.State.transform.m5*y + RLGL.State.transform.m9*z + RLGL.State.transform.m13;
+            tz = RLGL.State.transform.m2*x + RLGL.State.transform.m6*y + RLGL.State.transform.m10*z + RLGL.State.transform.m14;
+        }
     }
 
     // Verify that current vertex buffer elements limit has not been reached
@@ -1347,6 +1845,18 @@ void rlVertex3f(float x, float y, float z)
         RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter] = RLGL.State.texcoordx;
         RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter + 1] = RLGL.State.texcoordy;
 
+        // Add current texture unit (multi-texture batching)
+        // NOTE: Shapes are selected by units over last texture unit
+        if (RLGL.State.shapeType == RL_SHAPE_NONE) RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texunits[RLGL.State.vertexCounter] = RLGL.State.textureUnit;
+        else
+        {
+            RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texunits[RLGL.State.vertexCounter] = (unsigned char)(RL_SHAPE_UNIT_OFFSET + RLGL.State.shapeType + (RLGL.State.premultipliedAlpha? RL_SHAPE_UNIT_PREMULTIPLIED : 0));
+
+            // Add current shape parameters, only uploaded up to last shape vertex
+            for (int i = 0; i < 4; i++) RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].shapes[4*RLGL.State.vertexCounter + i] = RLGL.State.shape[i];
+            RLGL.currentBatch->shapeVertexCount = RLGL.State.vertexCounter + 1;
+        }
+
         // TODO: Add current normal
         // By default rlVertexBuffer type does not store normals
 
@@ -1375,6 +1885,347 @@ void rlVertex2i(int x, int y)
     rlVertex3f((float)x, (float)y, RLGL.currentBatch->currentDepth);
 }
 
+// Define multiple vertex (position), all vertex use current texcoord and color
+// NOTE: Vertex are copied straight into current vertex buffer, avoiding per vertex calls and checks
+void rlVertexArray2f(const float *vertices, int count)
+{
+    // Shape parameters are also stored per vertex, use regular path
+    if (RLGL.State.shapeType != RL_SHAPE_NONE)
+    {
+        for (int i = 0; i < count; i++) rlVertex2f(vertices[2*i], vertices[2*i + 1]);
+        return;
+    }
+
+    // Vertex written up to current vertex buffer limit, batch drawn when full
+    // NOTE: Chunks keep whole primitives of current mode (lines, triangles, quads) on every drawn batch
+    int mode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
+    int primitiveSize = (mode == RL_LINES)? 2 : ((mode == RL_TRIANGLES)? 3 : 4);
+
+    while (count > 0)
+    {
+        rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+
+        int chunk = buffer->elementCount*4 - RLGL.State.vertexCounter;
+        if (chunk >= count) chunk = count;
+        else chunk -= chunk%primitiveSize;
+
+        if (chunk <= 0)
+        {
+            rlCheckRenderBatchLimit(primitiveSize);
+            continue;
+        }
+
+        float depth = RLGL.currentBatch->currentDepth;
+        float *outVertices = buffer->vertices + 3*RLGL.State.vertexCounter;
+        float *outTexcoords = buffer->texcoords + 2*RLGL.State.vertexCounter;
+        unsigned char *outColors = buffer->colors + 4*RLGL.State.vertexCounter;
+
+        if (RLGL.State.transformRequired)
+        {
+            Matrix mat = RLGL.State.transform;
+
+            // Vertex depth is constant, its contribution is added to translation
+            float baseX = mat.m8*depth + mat.m12;
+            float baseY = mat.m9*depth + mat.m13;
+            float baseZ = mat.m10*depth + mat.m14;
+            int i = 0;
+
+#if defined(RLGL_SIMD_SSE) || defined(RLGL_SIMD_NEON)
+            // Vertex transformed as column vectors combination: x*column0 + y*column1 + base,
+            // 4 floats stored per vertex (last one overwritten by next vertex, last vertex is not stored this way)
+    #if defined(RLGL_SIMD_SSE)
+            __m128 column0 = _mm_setr_ps(mat.m0, mat.m1, mat.m2, 0.0f);
+            __m128 column1 = _mm_setr_ps(mat.m4, mat.m5, mat.m6, 0.0f);
+            __m128 base = _mm_setr_ps(baseX, baseY, baseZ, 0.0f);
+
+            for (; i < (chunk - 1); i++)
+            {
+                __m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(vertices[2*i]), column0), _mm_mul_ps(_mm_set1_ps(vertices[2*i + 1]), column1)), base);
+                _mm_storeu_ps(outVertices + 3*i, result);
+            }
+    #else
+            float32x4_t column0 = { mat.m0, mat.m1, mat.m2, 0.0f };
+            float32x4_t column1 = { mat.m4, mat.m5, mat.m6, 0.0f };
+            float32x4_t base = { baseX, baseY, baseZ, 0.0f };
+
+            for (; i < (chunk - 1); i++)
+            {
+                float32x4_t result = vmlaq_n_f32(vmlaq_n_f32(base, column0, vertices[2*i]), column1, vertices[2*i + 1]);
+                vst1q_f32(outVertices + 3*i, result);
+            }
+    #endif
+#endif
+            for (; i < chunk; i++)
+            {
+                float x = vertices[2*i];
+                float y = vertices[2*i + 1];
+
+                outVertices[3*i] = mat.m0*x + mat.m4*y + baseX;
+                outVertices[3*i + 1] = mat.m1*x + mat.m5*y + baseY;
+                outVertices[3*i + 2] = mat.m2*x + mat.m6*y + baseZ;
+            }
+        }
+        else
+        {
+            for (int i = 0; i < chunk; i++)
+            {
+                outVertices[3*i] = vertices[2*i];
+                outVertices[3*i + 1] = vertices[2*i + 1];
+                outVertices[3*i + 2] = depth;
+            }
+        }
+
+        for (int i = 0; i < chunk; i++)
+        {
+            outTexcoords[2*i] = RLGL.State.texcoordx;
+            outTexcoords[2*i + 1] = RLGL.State.texcoordy;
+
+            outColors[4*i] = RLGL.State.colorr;
+            outColors[4*i + 1] = RLGL.State.colorg;
+            outColors[4*i + 2] = RLGL.State.colorb;
+            outColors[4*i + 3] = RLGL.State.colora;
+        }
+
+        memset(buffer->texunits + RLGL.State.vertexCounter, RLGL.State.textureUnit, chunk);
+
+        RLGL.State.vertexCounter += chunk;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += chunk;
+
+        vertices += 2*chunk;
+        count -= chunk;
+    }
+}
+
+// Define multiple sprites quads, sprites provided as structure of arrays
+// NOTE: Quads vertex are generated in one pass straight into current vertex buffer (4 sprites at once with SIMD),
+// rotation sine/cosine are approximated, quads are not view culled
+// NOTE: Sources quad data is 8 floats per source: corners relative to origin (left, top, right, bottom) and texcoords (u0, v0, u1, v1)
+void rlSpriteArray(const float *x, const float *y, const float *rotation, const float *scale, const unsigned short *source, const unsigned char *colors, const float *sources, int count)
+{
+    int first = 0;
+
+    while (first < count)
+    {
+        rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+
+        // Sprites written up to current vertex buffer limit, batch drawn when full
+        int chunk = (buffer->elementCount*4 - RLGL.State.vertexCounter)/4;
+        if (chunk > (count - first)) chunk = count - first;
+
+        if (chunk <= 0)
+        {
+            rlCheckRenderBatchLimit(4);
+            continue;
+        }
+
+        // Vertex transformed as x*column0 + y*column1 + base, no transform is identity at current depth
+        Matrix mat = RLGL.State.transformRequired? RLGL.State.transform : rlMatrixIdentity();
+        float depth = RLGL.currentBatch->currentDepth;
+        float baseX = mat.m8*depth + mat.m12;
+        float baseY = mat.m9*depth + mat.m13;
+        float baseZ = mat.m10*depth + mat.m14;
+
+        float *outVertices = buffer->vertices + 3*RLGL.State.vertexCounter;
+        float *outTexcoords = buffer->texcoords + 2*RLGL.State.vertexCounter;
+        unsigned char *outColors = buffer->colors + 4*RLGL.State.vertexCounter;
+
+        for (int i = 0; i < chunk; i += 4)
+        {
+            int k = first + i;
+            int n = ((chunk - i) < 4)? (chunk - i) : 4;
+
+            // Quads corners (TL, BL, BR, TR) position per sprite: cornersX[corner*4 + sprite]
+            float cornersX[16] = { 0 };
+            float cornersY[16] = { 0 };
+
+#if defined(RLGL_SIMD_SSE) || defined(RLGL_SIMD_NEON)
+            if (n == 4)
+            {
+                const float *s0 = sources + 8*source[k];
+                const float *s1 = sources + 8*source[k + 1];
+                const float *s2 = sources + 8*source[k + 2];
+                const float *s3 = sources + 8*source[k + 3];
+
+                // Sine approximation over [-PI, PI]: y = B*a + C*a*|a|, refined as y = P*(y*|y| - y) + y,
+                // angle reduced by turns rounded as floor(turns + 0.5) like scalar path (rlGetSpriteSinCos()),
+                // floor computed as truncation corrected for negative values (no SSE4.1/ARMv8 rounding required)
+    #if defined(RLGL_SIMD_SSE)
+                __m128 one = _mm_set1_ps(1.0f);
+                __m128 pi = _mm_set1_ps(PI);
+                __m128 twoPi = _mm_set1_ps(2.0f*PI);
+                __m128 signMask = _mm_set1_ps(-0.0f);
+                __m128 b = _mm_set1_ps(4.0f/PI);
+                __m128 c = _mm_set1_ps(-4.0f/(PI*PI));
+                __m128 p = _mm_set1_ps(0.225f);
+
+                __m128 angle = _mm_mul_ps(_mm_loadu_ps(rotation + k), _mm_set1_ps(DEG2RAD));
+                __m128 turns = _mm_add_ps(_mm_mul_ps(angle, _mm_set1_ps(1.0f/(2.0f*PI))), _mm_set1_ps(0.5f));
+                __m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(turns));
+                turns = _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, turns), one));
+                angle = _mm_sub_ps(angle, _mm_mul_ps(turns, twoPi));
+                __m128 angleCos = _mm_add_ps(angle, _mm_set1_ps(PI/2.0f));
+                angleCos = _mm_sub_ps(angleCos, _mm_and_ps(_mm_cmpgt_ps(angleCos, pi), twoPi));
+
+                __m128 sinValue = _mm_add_ps(_mm_mul_ps(b, angle), _mm_mul_ps(_mm_mul_ps(c, angle), _mm_andnot_ps(signMask, angle)));
+                sinValue = _mm_add_ps(_mm_mul_ps(p, _mm_sub_ps(_mm_mul_ps(sinValue, _mm_andnot_ps(signMask, sinValue)), sinValue)), sinValue);
+                __m128 cosValue = _mm_add_ps(_mm_mul_ps(b, angleCos), _mm_mul_ps(_mm_mul_ps(c, angleCos), _mm_andnot_ps(signMask, angleCos)));
+                cosValue = _mm_add_ps(_mm_mul_ps(p, _mm_sub_ps(_mm_mul_ps(cosValue, _mm_andnot_ps(signMask, cosValue)), cosValue)), cosValue);
+
+                __m128 spriteScale = _mm_loadu_ps(scale + k);
+                __m128 scaledSin = _mm_mul_ps(sinValue, spriteScale);
+                __m128 scaledCos = _mm_mul_ps(cosValue, spriteScale);
+                __m128 posX = _mm_loadu_ps(x + k);
+                __m128 posY = _mm_loadu_ps(y + k);
+
+                __m128 left = _mm_setr_ps(s0[0], s1[0], s2[0], s3[0]);
+                __m128 top = _mm_setr_ps(s0[1], s1[1], s2[1], s3[1]);
+                __m128 right = _mm_setr_ps(s0[2], s1[2], s2[2], s3[2]);
+                __m128 bottom = _mm_setr_ps(s0[3], s1[3], s2[3], s3[3]);
+
+                // Corner (cx, cy) rotated and scaled: x + cx*scaledCos - cy*scaledSin, y + cx*scaledSin + cy*scaledCos
+                __m128 leftX = _mm_add_ps(posX, _mm_mul_ps(left, scaledCos));
+                __m128 leftY = _mm_add_ps(posY, _mm_mul_ps(left, scaledSin));
+                __m128 rightX = _mm_add_ps(posX, _mm_mul_ps(right, scaledCos));
+                __m128 rightY = _mm_add_ps(posY, _mm_mul_ps(right, scaledSin));
+                __m128 topX = _mm_mul_ps(top, scaledSin);
+                __m128 topY = _mm_mul_ps(top, scaledCos);
+                __m128 bottomX = _mm_mul_ps(bottom, scaledSin);
+                __m128 bottomY = _mm_mul_ps(bottom, scaledCos);
+
+                _mm_storeu_ps(cornersX, _mm_sub_ps(leftX, topX));
+                _mm_storeu_ps(cornersY, _mm_add_ps(leftY, topY));
+                _mm_storeu_ps(cornersX + 4, _mm_sub_ps(leftX, bottomX));
+                _mm_storeu_ps(cornersY + 4, _mm_add_ps(leftY, bottomY));
+                _mm_storeu_ps(cornersX + 8, _mm_sub_ps(rightX, bottomX));
+                _mm_storeu_ps(cornersY + 8, _mm_add_ps(rightY, bottomY));
+                _mm_storeu_ps(cornersX + 12, _mm_sub_ps(rightX, topX));
+                _mm_storeu_ps(cornersY + 12, _mm_add_ps(rightY, topY));
+    #else
+                float32x4_t one = vdupq_n_f32(1.0f);
+                float32x4_t pi = vdupq_n_f32(PI);
+                float32x4_t twoPi = vdupq_n_f32(2.0f*PI);
+                float32x4_t b = vdupq_n_f32(4.0f/PI);
+                float32x4_t c = vdupq_n_f32(-4.0f/(PI*PI));
+                float32x4_t p = vdupq_n_f32(0.225f);
+
+                float32x4_t angle = vmulq_n_f32(vld1q_f32(rotation + k), DEG2RAD);
+                float32x4_t turns = vmlaq_n_f32(vdupq_n_f32(0.5f), angle, 1.0f/(2.0f*PI));
+                float32x4_t truncated = vcvtq_f32_s32(vcvtq_s32_f32(turns));
+                turns = vsubq_f32(truncated, vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(truncated, turns), vreinterpretq_u32_f32(one))));
+                angle = vmlsq_f32(angle, turns, twoPi);
+                float32x4_t angleCos = vaddq_f32(angle, vdupq_n_f32(PI/2.0f));
+                angleCos = vbslq_f32(vcgtq_f32(angleCos, pi), vsubq_f32(angleCos, twoPi), angleCos);
+
+                float32x4_t sinValue = vmlaq_f32(vmulq_f32(b, angle), vmulq_f32(c, angle), vabsq_f32(angle));
+                sinValue = vmlaq_f32(sinValue, p, vsubq_f32(vmulq_f32(sinValue, vabsq_f32(sinValue)), sinValue));
+                float32x4_t cosValue = vmlaq_f32(vmulq_f32(b, angleCos), vmulq_f32(c, angleCos), vabsq_f32(angleCos));
+                cosValue = vmlaq_f32(cosValue, p, vsubq_f32(vmulq_f32(cosValue, vabsq_f32(cosValue)), cosValue));
+
+                float32x4_t spriteScale = vld1q_f32(scale + k);
+                float32x4_t scaledSin = vmulq_f32(sinValue, spriteScale);
+                float32x4_t scaledCos = vmulq_f32(cosValue, spriteScale);
+                float32x4_t posX = vld1q_f32(x + k);
+                float32x4_t posY = vld1q_f32(y + k);
+
+                float32x4_t left = { s0[0], s1[0], s2[0], s3[0] };
+                float32x4_t top = { s0[1], s1[1], s2[1], s3[1] };
+                float32x4_t right = { s0[2], s1[2], s2[2], s3[2] };
+                float32x4_t bottom = { s0[3], s1[3], s2[3], s3[3] };
+
+                // Corner (cx, cy) rotated and scaled: x + cx*scaledCos - cy*scaledSin, y + cx*scaledSin + cy*scaledCos
+                float32x4_t leftX = vmlaq_f32(posX, left, scaledCos);
+                float32x4_t leftY = vmlaq_f32(posY, left, scaledSin);
+                float32x4_t rightX = vmlaq_f32(posX, right, scaledCos);
+                float32x4_t rightY = vmlaq_f32(posY, right, scaledSin);
+
+                vst1q_f32(cornersX, vmlsq_f32(leftX, top, scaledSin));
+                vst1q_f32(cornersY, vmlaq_f32(leftY, top, scaledCos));
+                vst1q_f32(cornersX + 4, vmlsq_f32(leftX, bottom, scaledSin));
+                vst1q_f32(cornersY + 4, vmlaq_f32(leftY, bottom, scaledCos));
+                vst1q_f32(cornersX + 8, vmlsq_f32(rightX, bottom, scaledSin));
+                vst1q_f32(cornersY + 8, vmlaq_f32(rightY, bottom, scaledCos));
+                vst1q_f32(cornersX + 12, vmlsq_f32(rightX, top, scaledSin));
+                vst1q_f32(cornersY + 12, vmlaq_f32(rightY, top, scaledCos));
+    #endif
+            }
+            else
+#endif
+            {
+                for (int j = 0; j < n; j++)
+                {
+                    const float *src = sources + 8*source[k + j];
+                    float sinValue = 0.0f;
+                    float cosValue = 0.0f;
+
+                    rlGetSpriteSinCos(rotation[k + j]*DEG2RAD, &sinValue, &cosValue);
+
+                    float scaledSin = sinValue*scale[k + j];
+                    float scaledCos = cosValue*scale[k + j];
+                    float leftX = x[k + j] + src[0]*scaledCos;
+                    float leftY = y[k + j] + src[0]*scaledSin;
+                    float rightX = x[k + j] + src[2]*scaledCos;
+                    float rightY = y[k + j] + src[2]*scaledSin;
+
+                    cornersX[j] = leftX - src[1]*scaledSin;
+                    cornersY[j] = leftY + src[1]*scaledCos;
+                    cornersX[4 + j] = leftX - src[3]*scaledSin;
+                    cornersY[4 + j] = leftY + src[3]*scaledCos;
+                    cornersX[8 + j] = rightX - src[3]*scaledSin;
+                    cornersY[8 + j] = rightY + src[3]*scaledCos;
+                    cornersX[12 + j] = rightX - src[1]*scaledSin;
+                    cornersY[12 + j] = rightY + src[1]*scaledCos;
+                }
+            }
+
+            for (int j = 0; j < n; j++)
+            {
+                const float *src = sources + 8*source[k + j];
+                const unsigned char *color = colors + 4*(k + j);
+                unsigned char red = color[0];
+                unsigned char green = color[1];
+                unsigned char blue = color[2];
+                unsigned char alpha = color[3];
+
+                // Same color conversion as rlColor4ub()
+                if (RLGL.State.premultipliedAlpha)
+                {
+                    red = (unsigned char)((red*alpha + 127)/255);
+                    green = (unsigned char)((green*alpha + 127)/255);
+                    blue = (unsigned char)((blue*alpha + 127)/255);
+                    if (RLGL.State.currentBlendMode == RL_BLEND_ADDITIVE) alpha = 0;
+                }
+
+                // Corners texcoords: TL (u0, v0), BL (u0, v1), BR (u1, v1), TR (u1, v0)
+                float texcoords[8] = { src[4], src[5], src[4], src[7], src[6], src[7], src[6], src[5] };
+
+                for (int v = 0; v < 4; v++)
+                {
+                    int vertex = 4*(i + j) + v;
+                    float px = cornersX[4*v + j];
+                    float py = cornersY[4*v + j];
+
+                    outVertices[3*vertex] = mat.m0*px + mat.m4*py + baseX;
+                    outVertices[3*vertex + 1] = mat.m1*px + mat.m5*py + baseY;
+                    outVertices[3*vertex + 2] = mat.m2*px + mat.m6*py + baseZ;
+                    outTexcoords[2*vertex] = texcoords[2*v];
+                    outTexcoords[2*vertex + 1] = texcoords[2*v + 1];
+                    outColors[4*vertex] = red;
+                    outColors[4*vertex + 1] = green;
+                    outColors[4*vertex + 2] = blue;
+                    outColors[4*vertex + 3] = alpha;
+                }
+            }
+        }
+
+        memset(buffer->texunits + RLGL.State.vertexCounter, RLGL.State.textureUnit, 4*chunk);
+
+        RLGL.State.vertexCounter += 4*chunk;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += 4*chunk;
+
+        first += chunk;
+    }
+}
+
 // Define one vertex (texture coordinate)
 // NOTE: Texture coordinates are limited to QUADS only
 void rlTexCoord2f(float x, float y)
@@ -1393,8 +2244,20 @@ void rlNormal3f(float x, float y, float z)
 }
 
 // Define one vertex (color)
+// NOTE: With premultiplied alpha, color is premultiplied and additive blending is encoded as alpha 0,
+// encoding is updated on blend mode change, color must be set again after premultiplied alpha is enabled/disabled
 void rlColor4ub(unsigned char x, unsigned char y, unsigned char z, unsigned char w)
 {
+    RLGL.State.colorAlpha = w;
+
+    if (RLGL.State.premultipliedAlpha)
+    {
+        x = (unsigned char)((x*w + 127)/255);
+        y = (unsigned char)((y*w + 127)/255);
+        z = (unsigned char)((z*w + 127)/255);
+        if (RLGL.State.currentBlendMode == RL_BLEND_ADDITIVE) w = 0;
+    }
+
     RLGL.State.colorr = x;
     RLGL.State.colorg = y;
     RLGL.State.colorb = z;
@@ -1413,6 +2276,40 @@ void rlColor3f(float x, float y, float z)
     rlColor4ub((unsigned char)(x*255), (unsigned char)(y*255), (unsigned char)(z*255), 255);
 }
 
+// Set shape for following vertex, shape is evaluated per fragment (signed distance field)
+// NOTE: Vertex texture coordinates define fragment position from shape center (same units as half size),
+// shapes are only supported by default shader, returns false if shape can not be drawn
+bool rlSetShape(int type, float halfWidth, float halfHeight, float radius, float thickness)
+{
+    if ((type != RL_SHAPE_NONE) && (RLGL.State.currentShaderId != RLGL.State.defaultShaderId)) return false;
+
+    RLGL.State.shapeType = type;
+    RLGL.State.shape[0] = halfWidth;
+    RLGL.State.shape[1] = halfHeight;
+    RLGL.State.shape[2] = radius;
+    RLGL.State.shape[3] = thickness;
+
+    return true;
+}
+
+// Set depth layer for following vertex, with depth test enabled higher layers are drawn over lower ones
+// NOTE: Layer -1 (default) increases depth on every rlEnd() (submission order), layers over RL_MAX_DEPTH_LAYERS are clamped
+void rlSetDepthLayer(int layer)
+{
+    if (layer >= RL_MAX_DEPTH_LAYERS) layer = RL_MAX_DEPTH_LAYERS - 1;
+    if (layer < 0) layer = -1;
+
+    // Back to submission order, layered geometry is drawn and depth restarts from lowest value
+    if ((layer < 0) && (RLGL.State.depthLayer >= 0))
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.currentBatch->currentDepth = -1.0f;
+    }
+
+    RLGL.State.depthLayer = layer;
+    if (layer >= 0) RLGL.currentBatch->currentDepth = RL_DEPTH_LAYER_Z(layer);
+}
+
 #endif
 
 //--------------------------------------------------------------------------------------
@@ -1431,8 +2328,12 @@ void rlSetTexture(unsigned int id)
         if (RLGL.State.vertexCounter >=
             RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4)
         {
+            if (RLGL.currentBatch == &RLGL.defaultBatch) RLGL.Adaptive.vertexOverflows++;
             rlDrawRenderBatch(RLGL.currentBatch);
         }
+
+        // Following vertex use draw texture (texture unit 0)
+        RLGL.State.textureUnit = 0;
 #endif
     }
     else
@@ -1440,7 +2341,10 @@ void rlSetTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
         rlEnableTexture(id);
 #else
-        if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id)
+        int unit = (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId == id)? 0 : rlGetDrawTextureUnit(&RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1], id);
+
+        if (unit >= 0) RLGL.State.textureUnit = (unsigned char)unit;
+        else
         {
             if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
             {
@@ -1461,10 +2365,16 @@ void rlSetTexture(unsigned int id)
                 }
             }
 
-            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+            if (RLGL.currentBatch->drawCounter >= RLGL.currentBatch->drawCapacity)
+            {
+                if (RLGL.currentBatch == &RLGL.defaultBatch) RLGL.Adaptive.drawOverflows++;
+                rlDrawRenderBatch(RLGL.currentBatch);
+            }
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].extraTextureCount = 0;
+            RLGL.State.textureUnit = 0;
         }
 #endif
     }
@@ -1474,7 +2384,7 @@ void rlSetTexture(unsigned int id)
 void rlActiveTextureSlot(int slot)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glActiveTexture(GL_TEXTURE0 + slot);
+    rlCacheActiveTexture(slot);
 #endif
 }
 
@@ -1484,7 +2394,7 @@ void rlEnableTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
     glEnable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(id);
 }
 
 // Disable texture
@@ -1493,7 +2403,7 @@ void rlDisableTexture(void)
 #if defined(GRAPHICS_API_OPENGL_11)
     glDisable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(0);
 }
 
 // Enable texture cubemap
@@ -1515,7 +2425,9 @@ void rlDisableTextureCubemap(void)
 // Set texture parameters (wrap mode/filter mode)
 void rlTextureParameters(unsigned int id, int param, int value)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlRequireContext();
+
+    rlCacheBindTexture(id);
 
     switch (param)
     {
@@ -1549,14 +2461,16 @@ void rlTextureParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(0);
 }
 
 // Enable shader program
 void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(id);
+    RLGL.Uniforms.enabledProgramId = id;
+    if (RLGL.currentCommands != NULL) { rlRecordCommand(RL_COMMAND_SHADER, id, 0, 0, 0, 0); return; }
+    rlCacheUseProgram(id);
 #endif
 }
 
@@ -1564,7 +2478,9 @@ void rlEnableShader(unsigned int id)
 void rlDisableShader(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(0);
+    RLGL.Uniforms.enabledProgramId = 0;
+    if (RLGL.currentCommands != NULL) { rlRecordCommand(RL_COMMAND_SHADER, 0, 0, 0, 0, 0); return; }
+    rlCacheUseProgram(0);
 #endif
 }
 
@@ -1572,6 +2488,7 @@ void rlDisableShader(void)
 void rlEnableFramebuffer(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    if (RLGL.currentCommands != NULL) { rlRecordCommand(RL_COMMAND_FRAMEBUFFER, id, 0, 0, 0, 0); return; }
     glBindFramebuffer(GL_FRAMEBUFFER, id);
 #endif
 }
@@ -1580,6 +2497,7 @@ void rlEnableFramebuffer(unsigned int id)
 void rlDisableFramebuffer(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    if (RLGL.currentCommands != NULL) { rlRecordCommand(RL_COMMAND_FRAMEBUFFER, 0, 0, 0, 0, 0); return; }
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
 #endif
 }
@@ -1621,38 +2539,113 @@ void rlActiveDrawBuffers(int count)
 // General render state configuration
 //----------------------------------------------------------------------------------
 
+// Enable/disable an OpenGL capability, recorded if a command buffer is active
+static void rlSetCapability(int capability, bool enabled)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.currentCommands != NULL) { rlRecordCommand(enabled? RL_COMMAND_ENABLE : RL_COMMAND_DISABLE, capability, 0, 0, 0, 0); return; }
+#endif
+    rlCacheCapability(capability, enabled);
+}
+
 // Enable color blending
-void rlEnableColorBlend(void) { glEnable(GL_BLEND); }
+void rlEnableColorBlend(void) { rlSetCapability(GL_BLEND, true); }
 
 // Disable color blending
-void rlDisableColorBlend(void) { glDisable(GL_BLEND); }
+void rlDisableColorBlend(void) { rlSetCapability(GL_BLEND, false); }
 
 // Enable depth test
-void rlEnableDepthTest(void) { glEnable(GL_DEPTH_TEST); }
+void rlEnableDepthTest(void) { rlSetCapability(GL_DEPTH_TEST, true); }
 
 // Disable depth test
-void rlDisableDepthTest(void) { glDisable(GL_DEPTH_TEST); }
+void rlDisableDepthTest(void) { rlSetCapability(GL_DEPTH_TEST, false); }
 
 // Enable depth write
-void rlEnableDepthMask(void) { glDepthMask(GL_TRUE); }
+void rlEnableDepthMask(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.currentCommands != NULL) { rlRecordCommand(RL_COMMAND_DEPTH_MASK, GL_TRUE, 0, 0, 0, 0); return; }
+#endif
+    glDepthMask(GL_TRUE);
+}
 
 // Disable depth write
-void rlDisableDepthMask(void) { glDepthMask(GL_FALSE); }
+void rlDisableDepthMask(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.currentCommands != NULL) { rlRecordCommand(RL_COMMAND_DEPTH_MASK, GL_FALSE, 0, 0, 0, 0); return; }
+#endif
+    glDepthMask(GL_FALSE);
+}
+
+// Enable opaque mode, default shader is replaced by an alpha tested variant (fragments with alpha < 0.5 discarded)
+// and quads of every draw call are drawn front to back (by depth) to reduce overdraw
+// NOTE: Requires depth test and depth write to resolve layering (see rlSetDepthLayer()), submission order is not kept
+void rlEnableOpaqueMode(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.State.opaqueMode)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+
+        if (RLGL.State.alphaTestShaderId == 0) rlLoadShaderAlphaTest();
+        RLGL.State.opaqueMode = true;
+    }
+#endif
+}
+
+// Disable opaque mode
+void rlDisableOpaqueMode(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.opaqueMode)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.opaqueMode = false;
+    }
+#endif
+}
 
 // Enable backface culling
-void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); }
+void rlEnableBackfaceCulling(void) { rlSetCapability(GL_CULL_FACE, true); }
 
 // Disable backface culling
-void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); }
+void rlDisableBackfaceCulling(void) { rlSetCapability(GL_CULL_FACE, false); }
 
 // Enable scissor test
-void rlEnableScissorTest(void) { glEnable(GL_SCISSOR_TEST); }
+void rlEnableScissorTest(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.scissorTest = true;
+    RLGL.State.cullDirty = true;
+#endif
+    rlSetCapability(GL_SCISSOR_TEST, true);
+}
 
 // Disable scissor test
-void rlDisableScissorTest(void) { glDisable(GL_SCISSOR_TEST); }
+void rlDisableScissorTest(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.scissorTest = false;
+    RLGL.State.cullDirty = true;
+#endif
+    rlSetCapability(GL_SCISSOR_TEST, false);
+}
 
 // Scissor test
-void rlScissor(int x, int y, int width, int height) { glScissor(x, y, width, height); }
+void rlScissor(int x, int y, int width, int height)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.scissor[0] = x;
+    RLGL.State.scissor[1] = y;
+    RLGL.State.scissor[2] = width;
+    RLGL.State.scissor[3] = height;
+    RLGL.State.cullDirty = true;
+
+    if (RLGL.currentCommands != NULL) { rlRecordCommand(RL_COMMAND_SCISSOR, x, y, width, height, 0); return; }
+#endif
+    rlCacheScissor(x, y, width, height);
+}
 
 // Enable wire mode
 void rlEnableWireMode(void)
@@ -1725,39 +2718,162 @@ bool rlIsStereoRenderEnabled(void)
 #endif
 }
 
-// Clear color buffer with color
-void rlClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned char a)
+// Enable view culling
+// NOTE: Quads checked with rlIsQuadCulled() are rejected if out of viewport (or scissor rectangle)
+void rlEnableViewCulling(void)
 {
-    // Color values clamp to 0.0f(0) and 1.0f(255)
-    float cr = (float)r/255;
-    float cg = (float)g/255;
-    float cb = (float)b/255;
-    float ca = (float)a/255;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.viewCulling = true;
+#endif
+}
 
-    glClearColor(cr, cg, cb, ca);
+// Disable view culling
+void rlDisableViewCulling(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.viewCulling = false;
+#endif
 }
 
-// Clear used screen buffers (color and depth)
-void rlClearScreenBuffers(void)
+// Check if quad is out of view, quad vertex are defined as regular vertex (current transform applied)
+// NOTE: Only checked if view culling is enabled, see rlIsQuadVisible()
+bool rlIsQuadCulled(float x0, float y0, float x1, float y1, float x2, float y2, float x3, float y3)
 {
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);     // Clear used buffers: Color and Depth (Depth is used for 3D)
-    //glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);     // Stencil buffer not used...
+    bool culled = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.State.viewCulling) return false;
+
+    culled = !rlIsQuadVisible(x0, y0, x1, y1, x2, y2, x3, y3);
+    if (culled) RLGL.State.culledCount++;
+#endif
+
+    return culled;
 }
 
-// Check and log OpenGL error codes
-void rlCheckErrors()
+// Check if quad is in view (viewport or scissor rectangle), quad vertex are defined as regular vertex
+// NOTE: Only a conservative check, quads crossing cull rectangle corners could be kept
+bool rlIsQuadVisible(float x0, float y0, float x1, float y1, float x2, float y2, float x3, float y3)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    int check = 1;
-    while (check)
+    if (RLGL.State.cullDirty)
     {
-        const GLenum err = glGetError();
-        switch (err)
+        // Cull matrix transforms vertex to clip space, same as drawing
+        Matrix matModelView = RLGL.State.modelview;
+        if (RLGL.State.transformRequired) matModelView = rlMatrixMultiply(RLGL.State.transform, matModelView);
+        RLGL.State.cullMatrix = rlMatrixMultiply(matModelView, RLGL.State.projection);
+
+        // Cull rectangle is full viewport in normalized device coordinates, limited by scissor if enabled
+        RLGL.State.cullRec[0] = -1.0f;
+        RLGL.State.cullRec[1] = -1.0f;
+        RLGL.State.cullRec[2] = 1.0f;
+        RLGL.State.cullRec[3] = 1.0f;
+
+        if (RLGL.State.scissorTest && (RLGL.State.viewport[2] > 0) && (RLGL.State.viewport[3] > 0))
         {
-            case GL_NO_ERROR: check = 0; break;
-            case 0x0500: TRACELOG(RL_LOG_WARNING, "GL: Error detected: GL_INVALID_ENUM"); break;
-            case 0x0501: TRACELOG(RL_LOG_WARNING, "GL: Error detected: GL_INVALID_VALUE"); break;
-            case 0x0502: TRACELOG(RL_LOG_WARNING, "GL: Error detected: GL_INVALID_OPERATION"); break;
+            float minX = 2.0f*(RLGL.State.scissor[0] - RLGL.State.viewport[0])/RLGL.State.viewport[2] - 1.0f;
+            float minY = 2.0f*(RLGL.State.scissor[1] - RLGL.State.viewport[1])/RLGL.State.viewport[3] - 1.0f;
+            float maxX = minX + 2.0f*RLGL.State.scissor[2]/RLGL.State.viewport[2];
+            float maxY = minY + 2.0f*RLGL.State.scissor[3]/RLGL.State.viewport[3];
+
+            if (minX > RLGL.State.cullRec[0]) RLGL.State.cullRec[0] = minX;
+            if (minY > RLGL.State.cullRec[1]) RLGL.State.cullRec[1] = minY;
+            if (maxX < RLGL.State.cullRec[2]) RLGL.State.cullRec[2] = maxX;
+            if (maxY < RLGL.State.cullRec[3]) RLGL.State.cullRec[3] = maxY;
+        }
+
+        RLGL.State.cullDirty = false;
+    }
+
+    Matrix mat = RLGL.State.cullMatrix;
+    float z = RLGL.currentBatch->currentDepth;
+    float points[8] = { x0, y0, x1, y1, x2, y2, x3, y3 };
+
+    // Quad is culled if all vertex are out of the same cull rectangle side
+    int outside = 0x0f;
+
+    for (int i = 0; i < 4; i++)
+    {
+        float x = mat.m0*points[2*i] + mat.m4*points[2*i + 1] + mat.m8*z + mat.m12;
+        float y = mat.m1*points[2*i] + mat.m5*points[2*i + 1] + mat.m9*z + mat.m13;
+        float w = mat.m3*points[2*i] + mat.m7*points[2*i + 1] + mat.m11*z + mat.m15;
+
+        // Vertex behind the viewer (perspective projection) are never considered outside
+        if (w <= 0.0f) return true;
+
+        int code = 0;
+        if (x < RLGL.State.cullRec[0]*w) code |= 0x01;
+        if (x > RLGL.State.cullRec[2]*w) code |= 0x02;
+        if (y < RLGL.State.cullRec[1]*w) code |= 0x04;
+        if (y > RLGL.State.cullRec[3]*w) code |= 0x08;
+
+        outside &= code;
+        if (outside == 0) return true;
+    }
+
+    return false;
+#else
+    return true;
+#endif
+}
+
+// Get number of culled quads (since last reset)
+int rlGetCulledCount(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return RLGL.State.culledCount;
+#else
+    return 0;
+#endif
+}
+
+// Reset culled quads counter
+void rlResetCulledCount(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.culledCount = 0;
+#endif
+}
+
+// Clear color buffer with color
+void rlClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned char a)
+{
+    // Color values clamp to 0.0f(0) and 1.0f(255)
+    float cr = (float)r/255;
+    float cg = (float)g/255;
+    float cb = (float)b/255;
+    float ca = (float)a/255;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.currentCommands != NULL) { rlRecordCommand(RL_COMMAND_CLEAR_COLOR, r, g, b, a, 0); return; }
+#endif
+    glClearColor(cr, cg, cb, ca);
+}
+
+// Clear used screen buffers (color and depth)
+void rlClearScreenBuffers(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.currentCommands != NULL) { rlRecordCommand(RL_COMMAND_CLEAR, 0, 0, 0, 0, 0); return; }
+#endif
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);     // Clear used buffers: Color and Depth (Depth is used for 3D)
+    //glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);     // Stencil buffer not used...
+}
+
+// Check and log OpenGL error codes
+void rlCheckErrors()
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int check = 1;
+    while (check)
+    {
+        const GLenum err = glGetError();
+        switch (err)
+        {
+            case GL_NO_ERROR: check = 0; break;
+            case 0x0500: TRACELOG(RL_LOG_WARNING, "GL: Error detected: GL_INVALID_ENUM"); break;
+            case 0x0501: TRACELOG(RL_LOG_WARNING, "GL: Error detected: GL_INVALID_VALUE"); break;
+            case 0x0502: TRACELOG(RL_LOG_WARNING, "GL: Error detected: GL_INVALID_OPERATION"); break;
             case 0x0503: TRACELOG(RL_LOG_WARNING, "GL: Error detected: GL_STACK_OVERFLOW"); break;
             case 0x0504: TRACELOG(RL_LOG_WARNING, "GL: Error detected: GL_STACK_UNDERFLOW"); break;
             case 0x0505: TRACELOG(RL_LOG_WARNING, "GL: Error detected: GL_OUT_OF_MEMORY"); break;
@@ -1774,19 +2890,53 @@ void rlSetBlendMode(int mode)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.State.currentBlendMode != mode)
     {
+        // Premultiplied alpha: current color additive blending encoding must follow blend mode
+        if (RLGL.State.premultipliedAlpha) RLGL.State.colora = (mode == RL_BLEND_ADDITIVE)? 0 : RLGL.State.colorAlpha;
+
+        // Premultiplied alpha: alpha and additive blending share blend state, batch is not drawn
+        // NOTE: Additive blending is encoded in vertex color (alpha 0), see rlColor4ub()
+        if (RLGL.State.premultipliedAlpha &&
+            ((mode == RL_BLEND_ALPHA) || (mode == RL_BLEND_ADDITIVE)) &&
+            ((RLGL.State.currentBlendMode == RL_BLEND_ALPHA) || (RLGL.State.currentBlendMode == RL_BLEND_ADDITIVE)))
+        {
+            RLGL.State.currentBlendMode = mode;
+            return;
+        }
+
         rlDrawRenderBatch(RLGL.currentBatch);
 
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+        // Recording a thread batch, blend mode is kept with the new batch and set on drawing
+        if (RLGL.threadBatch != NULL)
+        {
+            RLGL.threadBatch->blendModes[RLGL.threadBatch->batchCount - 1] = mode;
+            RLGL.State.currentBlendMode = mode;
+            return;
+        }
+#endif
+
+        int srcFactor = GL_SRC_ALPHA;
+        int dstFactor = GL_ONE_MINUS_SRC_ALPHA;
+        int equation = GL_FUNC_ADD;
+
         switch (mode)
         {
-            case RL_BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADD_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_SUBTRACT_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_SUBTRACT); break;
-            case RL_BLEND_CUSTOM: glBlendFunc(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor); glBlendEquation(RLGL.State.glBlendEquation); break;
+            case RL_BLEND_ALPHA: if (RLGL.State.premultipliedAlpha) srcFactor = GL_ONE; break;
+            case RL_BLEND_ADDITIVE:
+            {
+                if (RLGL.State.premultipliedAlpha) srcFactor = GL_ONE;
+                else dstFactor = GL_ONE;
+            } break;
+            case RL_BLEND_MULTIPLIED: srcFactor = GL_DST_COLOR; break;
+            case RL_BLEND_ADD_COLORS: srcFactor = GL_ONE; dstFactor = GL_ONE; break;
+            case RL_BLEND_SUBTRACT_COLORS: srcFactor = GL_ONE; dstFactor = GL_ONE; equation = GL_FUNC_SUBTRACT; break;
+            case RL_BLEND_CUSTOM: srcFactor = RLGL.State.glBlendSrcFactor; dstFactor = RLGL.State.glBlendDstFactor; equation = RLGL.State.glBlendEquation; break;
             default: break;
         }
 
+        if (RLGL.currentCommands != NULL) rlRecordCommand(RL_COMMAND_BLEND, srcFactor, dstFactor, equation, 0, 0);
+        else rlCacheBlendMode(srcFactor, dstFactor, equation);
+
         RLGL.State.currentBlendMode = mode;
     }
 #endif
@@ -1802,6 +2952,132 @@ void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation)
 #endif
 }
 
+// Enable premultiplied alpha blending
+// NOTE: Alpha and additive blending use the same blend state (ONE, ONE_MINUS_SRC_ALPHA), so they share batch,
+// textures color must be premultiplied (done by Texture_LoadFromImage()), vertex color is premultiplied by rlgl
+void rlEnablePremultipliedAlpha(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.State.premultipliedAlpha)
+    {
+        int mode = RLGL.State.currentBlendMode;
+
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.premultipliedAlpha = true;
+        RLGL.State.currentBlendMode = -1;       // Force blend state update
+        rlSetBlendMode(mode);
+    }
+#endif
+}
+
+// Disable premultiplied alpha blending
+void rlDisablePremultipliedAlpha(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.premultipliedAlpha)
+    {
+        int mode = RLGL.State.currentBlendMode;
+
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.premultipliedAlpha = false;
+        RLGL.State.currentBlendMode = -1;       // Force blend state update
+        rlSetBlendMode(mode);
+    }
+#endif
+}
+
+// Check if premultiplied alpha blending is enabled
+bool rlIsPremultipliedAlpha(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return RLGL.State.premultipliedAlpha;
+#else
+    return false;
+#endif
+}
+
+// Get tint as shader diffuse color (4 floats), same encoding as vertex color (see rlColor4ub())
+void rlGetDiffuseColor(unsigned char r, unsigned char g, unsigned char b, unsigned char a, float *color)
+{
+    color[0] = (float)r/255.0f;
+    color[1] = (float)g/255.0f;
+    color[2] = (float)b/255.0f;
+    color[3] = (float)a/255.0f;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.premultipliedAlpha)
+    {
+        color[0] *= color[3];
+        color[1] *= color[3];
+        color[2] *= color[3];
+        if (RLGL.State.currentBlendMode == RL_BLEND_ADDITIVE) color[3] = 0.0f;
+    }
+#endif
+}
+
+// Invalidate OpenGL state cache
+// NOTE: rlgl skips binds and state changes already set, any OpenGL state
+// change done out of rlgl (direct OpenGL calls) requires calling this function
+void rlInvalidateStateCache(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Cache.programId = RL_CACHE_INVALID_ID;
+    RLGL.Cache.vaoId = RL_CACHE_INVALID_ID;
+    RLGL.Cache.arrayBufferId = RL_CACHE_INVALID_ID;
+    RLGL.Cache.elementBufferId = RL_CACHE_INVALID_ID;
+    RLGL.Cache.activeTextureUnit = -1;
+    for (int i = 0; i < RL_CACHE_TEXTURE_UNITS; i++) RLGL.Cache.textureId[i] = RL_CACHE_INVALID_ID;
+    for (int i = 0; i < 4; i++) RLGL.Cache.capability[i] = -1;
+    RLGL.Cache.blendSrcFactor = -1;
+    RLGL.Cache.blendDstFactor = -1;
+    RLGL.Cache.blendEquation = -1;
+    for (int i = 0; i < 4; i++) RLGL.Cache.scissor[i] = -1;
+    RLGL.Cache.uniformProgramId = RL_CACHE_INVALID_ID;
+#endif
+}
+
+// Get OpenGL state cache statistics (issued/elided calls)
+// NOTE: While recording a command buffer, calls are counted by the thread executing it and only
+// published statistics are returned (up to last rlPublishStateCacheStats())
+rlStateCacheStats rlGetStateCacheStats(bool reset)
+{
+    rlStateCacheStats stats = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.Cache.published;
+
+    // Direct submission, counters are owned by calling thread
+    if (RLGL.currentCommands == NULL)
+    {
+        stats.issued += RLGL.Cache.issued;
+        stats.elided += RLGL.Cache.elided;
+    }
+
+    if (reset)
+    {
+        RLGL.Cache.published = (rlStateCacheStats){ 0 };
+
+        if (RLGL.currentCommands == NULL)
+        {
+            RLGL.Cache.issued = 0;
+            RLGL.Cache.elided = 0;
+        }
+    }
+#endif
+    return stats;
+}
+
+// Publish statistics counted by thread issuing OpenGL calls, they are added to published ones
+// NOTE: Thread executing command buffers must be idle (i.e. waiting for next frame), call from recording thread
+void rlPublishStateCacheStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Cache.published.issued += RLGL.Cache.issued;
+    RLGL.Cache.published.elided += RLGL.Cache.elided;
+    RLGL.Cache.issued = 0;
+    RLGL.Cache.elided = 0;
+#endif
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - OpenGL Debug
 //----------------------------------------------------------------------------------
@@ -1897,9 +3173,10 @@ void rlglInit(int width, int height)
     rlLoadShaderDefault();
     RLGL.State.currentShaderId = RLGL.State.defaultShaderId;
     RLGL.State.currentShaderLocs = RLGL.State.defaultShaderLocs;
+    RLGL.State.depthLayer = -1;
 
     // Init default vertex arrays buffers
-    RLGL.defaultBatch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
+    RLGL.defaultBatch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS, RL_DEFAULT_BATCH_DRAWCALLS);
     RLGL.currentBatch = &RLGL.defaultBatch;
 
     // Init stack matrices (emulating OpenGL 1.1)
@@ -1907,6 +3184,7 @@ void rlglInit(int width, int height)
 
     // Init internal matrices
     RLGL.State.transform = rlMatrixIdentity();
+    RLGL.State.transformAffine = true;
     RLGL.State.projection = rlMatrixIdentity();
     RLGL.State.modelview = rlMatrixIdentity();
     RLGL.State.currentMatrix = &RLGL.State.modelview;
@@ -1944,6 +3222,11 @@ void rlglInit(int width, int height)
     RLGL.State.framebufferWidth = width;
     RLGL.State.framebufferHeight = height;
 
+    // Init viewport used on view culling
+    RLGL.State.viewport[2] = width;
+    RLGL.State.viewport[3] = height;
+    RLGL.State.cullDirty = true;
+
     TRACELOG(RL_LOG_INFO, "RLGL: Default OpenGL state initialized successfully");
     //----------------------------------------------------------
 #endif
@@ -1952,6 +3235,11 @@ void rlglInit(int width, int height)
     glClearColor(0.0f, 0.0f, 0.0f, 1.0f);                   // Set clear color (black)
     glClearDepth(1.0f);                                     // Set clear depth value (default)
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);     // Clear color and depth buffers (depth buffer required for 3D)
+
+    // Init state: OpenGL state cache (default states above were set directly)
+    rlInvalidateStateCache();
+
+    rlSyncThreadBatchState();
 }
 
 // Vertex Buffer Object deinitialization (memory free)
@@ -1960,9 +3248,29 @@ void rlglClose(void)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     rlUnloadRenderBatch(RLGL.defaultBatch);
 
+    // Unload shader uniforms caches
+    while (RLGL.Uniforms.programCount > 0) rlUnloadShaderUniforms(RLGL.Uniforms.programs[0].programId);
+    ASC_FREE(RLGL.Uniforms.programs);
+    RLGL.Uniforms.programs = NULL;
+
     rlUnloadShaderDefault();          // Unload default shader
 
+    // Unload multi-draw indirect buffers
+    if (RLGL.MultiDraw.commandsId > 0) glDeleteBuffers(1, &RLGL.MultiDraw.commandsId);
+    if (RLGL.MultiDraw.unitsId > 0) glDeleteBuffers(1, &RLGL.MultiDraw.unitsId);
+    ASC_FREE(RLGL.MultiDraw.commands);
+    RLGL.MultiDraw.commands = NULL;
+    RLGL.MultiDraw.capacity = 0;
+
+    // Unload opaque mode quads sort buffers
+    ASC_FREE(RLGL.Sort.quads);
+    ASC_FREE(RLGL.Sort.scratch);
+    RLGL.Sort.quads = NULL;
+    RLGL.Sort.scratch = NULL;
+    RLGL.Sort.capacity = 0;
+
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
+    rlInvalidateStateCache();
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 #endif
 }
@@ -2003,12 +3311,26 @@ void rlLoadExtensions(void *loader)
     #if defined(GRAPHICS_API_OPENGL_43)
     if (GLAD_GL_ARB_compute_shader) RLGL.ExtSupported.computeShader = true;
     if (GLAD_GL_ARB_shader_storage_buffer_object) RLGL.ExtSupported.ssbo = true;
+    if (GLAD_GL_VERSION_4_3 || (GLAD_GL_VERSION_4_2 && GLAD_GL_ARB_multi_draw_indirect)) RLGL.ExtSupported.multiDrawIndirect = true;
     #endif
     #if !defined(__APPLE__)
     // NOTE: With GLAD, we can check if an extension is supported using the GLAD_GL_xxx booleans
     if (GLAD_GL_EXT_texture_compression_s3tc) RLGL.ExtSupported.texCompDXT = true;  // Texture compression: DXT
     if (GLAD_GL_ARB_ES3_compatibility) RLGL.ExtSupported.texCompETC2 = true;        // Texture compression: ETC2/EAC
+
+    // NOTE: Some drivers expose program binaries but no binary format
+    if (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_get_program_binary)
+    {
+        GLint binaryFormats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormats);
+        if (binaryFormats > 0) RLGL.ExtSupported.programBinary = true;
+    }
     #endif
+
+    // Program binaries are only valid for same driver
+    RLGL.ShaderCache.driverHash[0] = rlHashString((const char *)glGetString(GL_VENDOR));
+    RLGL.ShaderCache.driverHash[1] = rlHashString((const char *)glGetString(GL_RENDERER));
+    RLGL.ShaderCache.driverHash[2] = rlHashString((const char *)glGetString(GL_VERSION));
 #endif  // GRAPHICS_API_OPENGL_33
 
 #if defined(GRAPHICS_API_OPENGL_ES2)
@@ -2188,6 +3510,7 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompASTC) TRACELOG(RL_LOG_INFO, "GL: ASTC compressed textures supported");
     if (RLGL.ExtSupported.computeShader) TRACELOG(RL_LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) TRACELOG(RL_LOG_INFO, "GL: Shader storage buffer objects supported");
+    if (RLGL.ExtSupported.multiDrawIndirect) TRACELOG(RL_LOG_INFO, "GL: Multi-draw indirect supported");
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -2272,8 +3595,10 @@ int *rlGetShaderLocsDefault(void)
 // Render batch management
 //------------------------------------------------------------------------------------------------
 // Load render batch
-rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
+rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements, int drawCalls)
 {
+    rlRequireContext();
+
     rlRenderBatch batch = { 0 };
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
@@ -2288,6 +3613,8 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].vertices = (float *)ASC_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
         batch.vertexBuffer[i].texcoords = (float *)ASC_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
         batch.vertexBuffer[i].colors = (unsigned char *)ASC_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+        batch.vertexBuffer[i].texunits = (unsigned char *)ASC_MALLOC(bufferElements*4*sizeof(unsigned char));   // 1 unit by vertex, 4 units by quad
+        batch.vertexBuffer[i].shapes = (float *)ASC_MALLOC(bufferElements*4*4*sizeof(float));          // 4 float by shape, 4 shapes by quad
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)ASC_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2298,6 +3625,8 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
         for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
         for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
+        for (int j = 0; j < (4*bufferElements); j++) batch.vertexBuffer[i].texunits[j] = 0;
+        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].shapes[j] = 0.0f;
 
         int k = 0;
 
@@ -2328,34 +3657,53 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         {
             // Initialize Quads VAO
             glGenVertexArrays(1, &batch.vertexBuffer[i].vaoId);
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlCacheBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
         // Quads - Vertex buffers binding and attributes enable
         // Vertex position buffer (shader-location = 0)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
         glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
 
         // Vertex texcoord buffer (shader-location = 1)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
         glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
 
         // Vertex color buffer (shader-location = 3)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
         glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
 
+        // Vertex texture unit buffer (shader-location = 6)
+        glGenBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[4]);
+        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(unsigned char), batch.vertexBuffer[i].texunits, GL_DYNAMIC_DRAW);
+        glEnableVertexAttribArray(6);
+        glVertexAttribPointer(6, 1, GL_UNSIGNED_BYTE, GL_FALSE, 0, 0);
+
+        // Vertex shape buffer (shader-location = 7)
+        glGenBuffers(1, &batch.vertexBuffer[i].vboId[5]);
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[5]);
+        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(float), batch.vertexBuffer[i].shapes, GL_DYNAMIC_DRAW);
+        glEnableVertexAttribArray(7);
+        glVertexAttribPointer(7, 4, GL_FLOAT, GL_FALSE, 0, 0);
+
+#if defined(GRAPHICS_API_OPENGL_43)
+        // Draw textures units base (shader-location = 8), multi-draw indirect only
+        if (RLGL.ExtSupported.multiDrawIndirect) rlEnableDrawUnitsAttrib();
+#endif
+
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
+        rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
 #if defined(GRAPHICS_API_OPENGL_33)
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(int), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
 #endif
@@ -2367,14 +3715,15 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
 
     // Unbind the current VAO
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
     //--------------------------------------------------------------------------------------------
 
     // Init draw calls tracking system
     //--------------------------------------------------------------------------------------------
-    batch.draws = (rlDrawCall *)ASC_MALLOC(RL_DEFAULT_BATCH_DRAWCALLS*sizeof(rlDrawCall));
+    batch.draws = (rlDrawCall *)ASC_MALLOC(drawCalls*sizeof(rlDrawCall));
+    batch.drawCapacity = drawCalls;
 
-    for (int i = 0; i < RL_DEFAULT_BATCH_DRAWCALLS; i++)
+    for (int i = 0; i < drawCalls; i++)
     {
         batch.draws[i].mode = RL_QUADS;
         batch.draws[i].vertexCount = 0;
@@ -2382,6 +3731,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         //batch.draws[i].vaoId = 0;
         //batch.draws[i].shaderId = 0;
         batch.draws[i].textureId = RLGL.State.defaultTextureId;
+        batch.draws[i].extraTextureCount = 0;
         //batch.draws[i].RLGL.State.projection = rlMatrixIdentity();
         //batch.draws[i].RLGL.State.modelview = rlMatrixIdentity();
     }
@@ -2398,10 +3748,12 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 // Unload default internal buffers vertex data from CPU and GPU
 void rlUnloadRenderBatch(rlRenderBatch batch)
 {
+    rlRequireContext();
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Unbind everything
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, 0);
+    rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
     // Unload all vertex buffers data
     for (int i = 0; i < batch.bufferCount; i++)
@@ -2409,12 +3761,14 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         // Unbind VAO attribs data
         if (RLGL.ExtSupported.vao)
         {
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlCacheBindVertexArray(batch.vertexBuffer[i].vaoId);
             glDisableVertexAttribArray(0);
             glDisableVertexAttribArray(1);
             glDisableVertexAttribArray(2);
             glDisableVertexAttribArray(3);
-            glBindVertexArray(0);
+            glDisableVertexAttribArray(6);
+            glDisableVertexAttribArray(7);
+            rlCacheBindVertexArray(0);
         }
 
         // Delete VBOs from GPU (VRAM)
@@ -2422,14 +3776,19 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
+        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[5]);
 
         // Delete VAOs from GPU (VRAM)
         if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+        rlInvalidateStateCache();
 
         // Free vertex arrays memory from CPU (RAM)
         ASC_FREE(batch.vertexBuffer[i].vertices);
         ASC_FREE(batch.vertexBuffer[i].texcoords);
         ASC_FREE(batch.vertexBuffer[i].colors);
+        ASC_FREE(batch.vertexBuffer[i].texunits);
+        ASC_FREE(batch.vertexBuffer[i].shapes);
         ASC_FREE(batch.vertexBuffer[i].indices);
     }
 
@@ -2444,47 +3803,83 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+    // Recording a thread batch, OpenGL is not available: full batch is kept and recording goes on in a new one
+    if (RLGL.threadBatch != NULL)
+    {
+        memcpy(RLGL.threadBatch->modelviews + 16*(RLGL.threadBatch->batchCount - 1), &RLGL.State.modelview, sizeof(Matrix));
+        rlNextThreadBatch(RLGL.threadBatch);
+        return;
+    }
+#endif
+
+    // Track default batch load for adaptive capacity
+    if (batch == &RLGL.defaultBatch)
+    {
+        if (RLGL.State.vertexCounter > RLGL.Adaptive.peakVertices) RLGL.Adaptive.peakVertices = RLGL.State.vertexCounter;
+        if (batch->drawCounter > RLGL.Adaptive.peakDraws) RLGL.Adaptive.peakDraws = batch->drawCounter;
+    }
+
+    // Opaque mode: quads are drawn front to back, hidden fragments are discarded by depth test
+    if (RLGL.State.opaqueMode && (RLGL.State.vertexCounter > 0)) rlSortBatchQuads(batch);
+
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+
+    // Snapshot current state required for batch submission
+    rlBatchState state = { 0 };
+    state.vertexCount = RLGL.State.vertexCounter;
+    state.shapeVertexCount = batch->shapeVertexCount;
+    state.drawCounter = batch->drawCounter;
+    state.instances = batch->instances;
+    state.vaoId = buffer->vaoId;
+    for (int i = 0; i < 6; i++) state.vboId[i] = buffer->vboId[i];
+    state.shaderId = RLGL.State.currentShaderId;
+    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) state.shaderLocs[i] = RLGL.State.currentShaderLocs[i];
+    for (int i = 0; i < 4; i++) state.color[i] = 1.0f;
+
+    // Opaque mode: default shader is replaced by alpha tested variant
+    if (RLGL.State.opaqueMode && (state.shaderId == RLGL.State.defaultShaderId) && (RLGL.State.alphaTestShaderId > 0))
+    {
+        state.shaderId = RLGL.State.alphaTestShaderId;
+        for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) state.shaderLocs[i] = RLGL.State.alphaTestShaderLocs[i];
+    }
+    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) state.activeTextureId[i] = RLGL.State.activeTextureId[i];
+
+    // Batch draw sets shader default uniforms, last values set for them are not valid anymore
+    if (state.vertexCount > 0)
+    {
+        rlForgetUniformValue(state.shaderId, state.shaderLocs[RL_SHADER_LOC_MATRIX_MVP]);
+        rlForgetUniformValue(state.shaderId, state.shaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE]);
+        rlForgetUniformValue(state.shaderId, state.shaderLocs[RL_SHADER_LOC_MAP_DIFFUSE]);
+    }
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (change flag required)
-    if (RLGL.State.vertexCounter > 0)
-    {
-        // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
-
-        // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
-
-        // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
-
-        // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
-
-        // NOTE: glMapBuffer() causes sync issue.
-        // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
-        // To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer().
-        // If you do that, the previous data in PBO will be discarded and glMapBuffer() returns a new
-        // allocated pointer immediately even if GPU is still working with the previous data.
-
-        // Another option: map the buffer object into client's memory
-        // Probably this code could be moved somewhere else...
-        // batch->vertexBuffer[batch->currentBuffer].vertices = (float *)glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
-        // if (batch->vertexBuffer[batch->currentBuffer].vertices)
-        // {
-            // Update vertex data
-        // }
-        // glUnmapBuffer(GL_ARRAY_BUFFER);
-
-        // Unbind the current VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (state.vertexCount > 0)
+    {
+        if (RLGL.currentCommands != NULL)
+        {
+            // Vertex data is copied into the command payload, CPU arrays are reused right away
+            int verticesSize = state.vertexCount*3*sizeof(float);
+            int texcoordsSize = state.vertexCount*2*sizeof(float);
+            int shapesSize = state.shapeVertexCount*4*sizeof(float);
+            int colorsSize = state.vertexCount*4*sizeof(unsigned char);
+            int texunitsSize = state.vertexCount*sizeof(unsigned char);
+
+            unsigned char *data = (unsigned char *)rlRecordCommand(RL_COMMAND_UPDATE_BATCH, 0, 0, 0, 0, sizeof(rlBatchState) + verticesSize + texcoordsSize + shapesSize + colorsSize + texunitsSize);
+            if (data != NULL)
+            {
+                memcpy(data, &state, sizeof(rlBatchState));
+                memcpy(data + sizeof(rlBatchState), buffer->vertices, verticesSize);
+                memcpy(data + sizeof(rlBatchState) + verticesSize, buffer->texcoords, texcoordsSize);
+                memcpy(data + sizeof(rlBatchState) + verticesSize + texcoordsSize, buffer->shapes, shapesSize);
+                memcpy(data + sizeof(rlBatchState) + verticesSize + texcoordsSize + shapesSize, buffer->colors, colorsSize);
+                memcpy(data + sizeof(rlBatchState) + verticesSize + texcoordsSize + shapesSize + colorsSize, buffer->texunits, texunitsSize);
+            }
+        }
+        else rlUpdateBatchBuffers(&state, buffer->vertices, buffer->texcoords, buffer->shapes, buffer->colors, buffer->texunits);
     }
     //------------------------------------------------------------------------------------------------------------
 
@@ -2510,12 +3905,9 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         }
 
         // Draw buffers
-        if (RLGL.State.vertexCounter > 0)
+        if (state.vertexCount > 0)
         {
-            // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
-
-            // Create modelview-projection matrix and upload to shader
+            // Create modelview-projection matrix
             Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
             float matMVPfloat[16] = {
                 matMVP.m0, matMVP.m1, matMVP.m2, matMVP.m3,
@@ -2523,98 +3915,19 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 matMVP.m8, matMVP.m9, matMVP.m10, matMVP.m11,
                 matMVP.m12, matMVP.m13, matMVP.m14, matMVP.m15
             };
-            glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
-
-            if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
-            else
-            {
-                // Bind vertex attrib: position (shader-location = 0)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-
-                // Bind vertex attrib: texcoord (shader-location = 1)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-
-                // Bind vertex attrib: color (shader-location = 3)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
-            }
+            for (int i = 0; i < 16; i++) state.mvp[i] = matMVPfloat[i];
 
-            // Setup some default shader values
-            glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
-            glUniform1i(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
-
-            // Activate additional sampler textures
-            // Those additional textures will be common for all draw calls of the batch
-            for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
+            if (RLGL.currentCommands != NULL)
             {
-                if (RLGL.State.activeTextureId[i] > 0)
+                unsigned char *data = (unsigned char *)rlRecordCommand(RL_COMMAND_DRAW_BATCH, 0, 0, 0, 0, sizeof(rlBatchState) + state.drawCounter*sizeof(rlDrawCall));
+                if (data != NULL)
                 {
-                    glActiveTexture(GL_TEXTURE0 + 1 + i);
-                    glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
+                    memcpy(data, &state, sizeof(rlBatchState));
+                    memcpy(data + sizeof(rlBatchState), batch->draws, state.drawCounter*sizeof(rlDrawCall));
                 }
             }
-
-            // Activate default sampler2D texture0 (one texture is always active for default batch shader)
-            // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
-            glActiveTexture(GL_TEXTURE0);
-
-            for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
-            {
-                // Bind current draw call texture, activated as GL_TEXTURE0 and binded to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
-
-                if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES))
-                {
-                    if (batch->instances == 0)
-                    {
-                        glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
-                    }
-                    else
-                    {
-                        glDrawArraysInstanced(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount, batch->instances);
-                    }
-                }
-                else
-                {
-                    if (batch->instances == 0){
-#if defined(GRAPHICS_API_OPENGL_33)
-                        // We need to define the number of indices to be processed: elementCount*6
-                        // NOTE: The final parameter tells the GPU the offset in bytes from the
-                        // start of the index buffer to the location of the first index to process
-                        glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2)
-                        glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
-#endif
-                    }
-                    else
-                    {
-                        glDrawElementsInstanced(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)), batch->instances);
-                    }
-                 }
-
-                vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
-            }
-
-            if (!RLGL.ExtSupported.vao)
-            {
-                glBindBuffer(GL_ARRAY_BUFFER, 0);
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-            }
-
-            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+            else rlDrawBatchBuffers(&state, batch->draws);
         }
-
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
-
-        glUseProgram(0);    // Unbind shader program
     }
     //------------------------------------------------------------------------------------------------------------
 
@@ -2624,25 +3937,29 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     RLGL.State.vertexCounter = 0;
 
     // Reset depth for next draw
-    batch->currentDepth = -1.0f;
+    batch->currentDepth = (RLGL.State.depthLayer >= 0)? RL_DEPTH_LAYER_Z(RLGL.State.depthLayer) : -1.0f;
 
     // Restore projection/modelview matrices
     RLGL.State.projection = matProjection;
     RLGL.State.modelview = matModelView;
 
     // Reset RLGL.currentBatch->draws array
-    for (int i = 0; i < RL_DEFAULT_BATCH_DRAWCALLS; i++)
+    for (int i = 0; i < batch->drawCapacity; i++)
     {
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
         batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].extraTextureCount = 0;
     }
 
+    RLGL.State.textureUnit = 0;
+
     // Reset active texture units for next batch
     for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) RLGL.State.activeTextureId[i] = 0;
 
     // Reset draws counter to one draw for the batch
     batch->drawCounter = 1;
+    batch->shapeVertexCount = 0;
     //------------------------------------------------------------------------------------------------------------
 
     // Change to next buffer in the list (in case of multi-buffering)
@@ -2683,7 +4000,11 @@ bool rlCheckRenderBatchLimit(int vCount)
         int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
         int currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
 
+        // NOTE: Texture in use could be an additional texture of the draw (multi-texture batching)
+        if (RLGL.State.textureUnit > 0) currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].extraTextureId[RLGL.State.textureUnit - 1];
+
         overflow = true;
+        if (RLGL.currentBatch == &RLGL.defaultBatch) RLGL.Adaptive.vertexOverflows++;
         rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
 
         // Restore state of last batch so we can continue adding vertices
@@ -2695,1708 +4016,4008 @@ bool rlCheckRenderBatchLimit(int vCount)
     return overflow;
 }
 
-// Textures data management
-//-----------------------------------------------------------------------------------------
-// Convert image data to OpenGL texture (returns OpenGL valid Id)
-unsigned int rlLoadTexture(void *data, int width, int height, int format, int mipmapCount)
+// Set internal render batch capacity, current batch is drawn and vertex buffers are reloaded
+// NOTE: Buffers could be in use by recorded commands, it should be called between frames
+void rlSetRenderBatchCapacity(int bufferElements, int drawCalls)
 {
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+    if (RLGL.threadBatch != NULL) return;
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Indices are 16bit, up to 65536 vertex (16384 quads) can be indexed
+    if (bufferElements > 16384) bufferElements = 16384;
+#endif
+    if ((bufferElements <= 0) || (drawCalls <= 0)) return;
+    if ((bufferElements == RLGL.defaultBatch.vertexBuffer[0].elementCount) && (drawCalls == RLGL.defaultBatch.drawCapacity)) return;
 
-    unsigned int id = 0;
+    rlDrawRenderBatch(&RLGL.defaultBatch);
 
-    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
-#if defined(GRAPHICS_API_OPENGL_11)
-    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
-        return id;
-    }
-#else
-    if ((!RLGL.ExtSupported.texCompDXT) && ((format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
-        (format == RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA)))
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: DXT compressed texture format not supported");
-        return id;
-    }
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((!RLGL.ExtSupported.texCompETC1) && (format == RL_PIXELFORMAT_COMPRESSED_ETC1_RGB))
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: ETC1 compressed texture format not supported");
-        return id;
-    }
+    int bufferCount = RLGL.defaultBatch.bufferCount;
+    rlUnloadRenderBatch(RLGL.defaultBatch);
 
-    if ((!RLGL.ExtSupported.texCompETC2) && ((format == RL_PIXELFORMAT_COMPRESSED_ETC2_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)))
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: ETC2 compressed texture format not supported");
-        return id;
-    }
+    // NOTE: Batch vertex attributes are bound to default shader locations
+    int *currentShaderLocs = RLGL.State.currentShaderLocs;
+    RLGL.State.currentShaderLocs = RLGL.State.defaultShaderLocs;
+    RLGL.defaultBatch = rlLoadRenderBatch(bufferCount, bufferElements, drawCalls);
+    RLGL.State.currentShaderLocs = currentShaderLocs;
 
-    if ((!RLGL.ExtSupported.texCompPVRT) && ((format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA)))
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: PVRT compressed texture format not supported");
-        return id;
-    }
+    if (RLGL.State.depthLayer >= 0) RLGL.defaultBatch.currentDepth = RL_DEPTH_LAYER_Z(RLGL.State.depthLayer);
 
-    if ((!RLGL.ExtSupported.texCompASTC) && ((format == RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)))
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: ASTC compressed texture format not supported");
-        return id;
-    }
+    TRACELOG(RL_LOG_INFO, "RLGL: Render batch capacity set: %i elements, %i draw calls", bufferElements, drawCalls);
 #endif
-#endif  // GRAPHICS_API_OPENGL_11
+}
 
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+// Get internal render batch elements capacity (quads)
+int rlGetRenderBatchElements(void)
+{
+    int elements = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    elements = RLGL.defaultBatch.vertexBuffer[0].elementCount;
+#endif
+    return elements;
+}
 
-    glGenTextures(1, &id);              // Generate texture id
+// Get internal render batch draw calls capacity
+int rlGetRenderBatchDrawCalls(void)
+{
+    int drawCalls = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    drawCalls = RLGL.defaultBatch.drawCapacity;
+#endif
+    return drawCalls;
+}
 
-    glBindTexture(GL_TEXTURE_2D, id);
+// Enable internal render batch capacity adapted to observed load
+void rlEnableRenderBatchAdaptive(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Adaptive.enabled = true;
+#endif
+}
 
-    int mipWidth = width;
-    int mipHeight = height;
-    int mipOffset = 0;          // Mipmap data offset
+// Disable internal render batch adaptive capacity, current capacity is kept
+void rlDisableRenderBatchAdaptive(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Adaptive.enabled = false;
+#endif
+}
 
-    // Load the different mipmap levels
-    for (int i = 0; i < mipmapCount; i++)
+// Update internal render batch capacity from load observed since last update
+// NOTE: Capacity is doubled on overflow (up to maximum) and halved (down to minimum)
+// after RL_BATCH_ADAPTIVE_SHRINK_FRAMES updates using under a quarter of it
+void rlUpdateRenderBatchAdaptive(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.Adaptive.enabled)
     {
-        unsigned int mipSize = rlColor_GetPixelDataSize(mipWidth, mipHeight, format);
-
-        int glInternalFormat, glFormat, glType;
-        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+        int elements = RLGL.defaultBatch.vertexBuffer[0].elementCount;
+        int drawCalls = RLGL.defaultBatch.drawCapacity;
+        int newElements = elements;
+        int newDrawCalls = drawCalls;
 
-        TRACELOGD("TEXTURE: Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
-
-        if (glInternalFormat != -1)
+        if ((RLGL.Adaptive.vertexOverflows > 0) || (RLGL.Adaptive.requiredElements > elements))
         {
-            if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, (unsigned char *)data + mipOffset);
-#if !defined(GRAPHICS_API_OPENGL_11)
-            else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, (unsigned char *)data + mipOffset);
-#endif
+            do newElements *= 2; while (newElements < RLGL.Adaptive.requiredElements);
+            if (newElements > RL_BATCH_ADAPTIVE_MAX_ELEMENTS) newElements = (elements > RL_BATCH_ADAPTIVE_MAX_ELEMENTS)? elements : RL_BATCH_ADAPTIVE_MAX_ELEMENTS;
+            RLGL.Adaptive.lowElementsFrames = 0;
+        }
+        else if (RLGL.Adaptive.peakVertices < elements)     // Under a quarter of elements*4 vertex
+        {
+            RLGL.Adaptive.lowElementsFrames++;
 
-#if defined(GRAPHICS_API_OPENGL_33)
-            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+            if (RLGL.Adaptive.lowElementsFrames >= RL_BATCH_ADAPTIVE_SHRINK_FRAMES)
             {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
-                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+                if ((elements/2) >= RL_BATCH_ADAPTIVE_MIN_ELEMENTS) newElements = elements/2;
+                RLGL.Adaptive.lowElementsFrames = 0;
             }
-            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+        }
+        else RLGL.Adaptive.lowElementsFrames = 0;
+
+        if (RLGL.Adaptive.drawOverflows > 0)
+        {
+            newDrawCalls = drawCalls*2;
+            if (newDrawCalls > RL_BATCH_ADAPTIVE_MAX_DRAWCALLS) newDrawCalls = (drawCalls > RL_BATCH_ADAPTIVE_MAX_DRAWCALLS)? drawCalls : RL_BATCH_ADAPTIVE_MAX_DRAWCALLS;
+            RLGL.Adaptive.lowDrawsFrames = 0;
+        }
+        else if (RLGL.Adaptive.peakDraws < drawCalls/4)
+        {
+            RLGL.Adaptive.lowDrawsFrames++;
+
+            if (RLGL.Adaptive.lowDrawsFrames >= RL_BATCH_ADAPTIVE_SHRINK_FRAMES)
             {
-#if defined(GRAPHICS_API_OPENGL_21)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
-#elif defined(GRAPHICS_API_OPENGL_33)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
-#endif
-                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+                if ((drawCalls/2) >= RL_BATCH_ADAPTIVE_MIN_DRAWCALLS) newDrawCalls = drawCalls/2;
+                RLGL.Adaptive.lowDrawsFrames = 0;
             }
-#endif
         }
+        else RLGL.Adaptive.lowDrawsFrames = 0;
 
-        mipWidth /= 2;
-        mipHeight /= 2;
-        mipOffset += mipSize;
-
-        // Security check for NPOT textures
-        if (mipWidth < 1) mipWidth = 1;
-        if (mipHeight < 1) mipHeight = 1;
+        rlSetRenderBatchCapacity(newElements, newDrawCalls);
     }
 
-    // Texture parameters configuration
-    // NOTE: glTexParameteri does NOT affect texture uploading, just the way it's used
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    // NOTE: OpenGL ES 2.0 with no GL_OES_texture_npot support (i.e. WebGL) has limited NPOT support, so CLAMP_TO_EDGE must be used
-    if (RLGL.ExtSupported.texNPOT)
-    {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
-    }
-    else
-    {
-        // NOTE: If using negative texture coordinates (LoadOBJ()), it does not work!
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);       // Set texture to clamp on x-axis
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);       // Set texture to clamp on y-axis
-    }
+    RLGL.Adaptive.vertexOverflows = 0;
+    RLGL.Adaptive.drawOverflows = 0;
+    RLGL.Adaptive.requiredElements = 0;
+    RLGL.Adaptive.peakVertices = 0;
+    RLGL.Adaptive.peakDraws = 0;
+#endif
+}
+
+// Load a thread batch (CPU memory only, no OpenGL required)
+// NOTE: Batches memory is allocated on first use
+rlThreadBatch rlLoadThreadBatch(void)
+{
+    rlThreadBatch batch = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+    // NOTE: Recorded batches are drawn through current batch buffers, in chunks if bigger
+    batch.bufferElements = rlglShared.defaultBatch.vertexBuffer[0].elementCount;
+    batch.context = ASC_CALLOC(1, sizeof(rlglData));
 #else
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+    TRACELOG(RL_LOG_WARNING, "RLGL: Thread batches not enabled (RLGL_ENABLE_THREAD_BATCHES), geometry is drawn directly");
+#endif
 #endif
 
-    // Magnification and minification filters
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+    return batch;
+}
 
-#if defined(GRAPHICS_API_OPENGL_33)
-    if (mipmapCount > 1)
+// Unload thread batch
+void rlUnloadThreadBatch(rlThreadBatch *batch)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    for (int i = 0; i < batch->batchCapacity; i++)
     {
-        // Activate Trilinear filtering if mipmaps are available
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        ASC_FREE(batch->batches[i].vertexBuffer[0].vertices);
+        ASC_FREE(batch->batches[i].vertexBuffer[0].texcoords);
+        ASC_FREE(batch->batches[i].vertexBuffer[0].colors);
+        ASC_FREE(batch->batches[i].vertexBuffer[0].texunits);
+        ASC_FREE(batch->batches[i].vertexBuffer[0].shapes);
+        ASC_FREE(batch->batches[i].vertexBuffer);
+        ASC_FREE(batch->batches[i].draws);
     }
-#endif
-
-    // At this point we have the texture loaded in GPU and texture parameters configured
 
-    // NOTE: If mipmaps were not in data, they are not generated automatically
+    ASC_FREE(batch->batches);
+    ASC_FREE(batch->modelviews);
+    ASC_FREE(batch->blendModes);
+    ASC_FREE(batch->shaderIds);
+    ASC_FREE(batch->shaderLocs);
+    ASC_FREE(batch->context);
 
-    // Unbind current texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+    batch->batches = NULL;
+    batch->modelviews = NULL;
+    batch->blendModes = NULL;
+    batch->shaderIds = NULL;
+    batch->shaderLocs = NULL;
+    batch->batchCount = 0;
+    batch->batchCapacity = 0;
+    batch->context = NULL;
+#endif
+}
 
-    if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
-    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
+// Snapshot main state (matrices, default texture, batch limits) used to begin recording on any thread
+// NOTE: Called from main thread when no thread batch is being recorded (i.e. frame start, camera changes),
+// recording threads only read the snapshot, main state keeps changing meanwhile
+void rlSyncThreadBatchState(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+    if (rlglState != &rlglMain) return;     // Called while recording, main state is not available
 
-    return id;
+    memcpy(&rlglShared, &rlglMain, sizeof(rlglData));
+#endif
+#endif
 }
 
-// Load depth texture/renderbuffer (to be attached to fbo)
-// WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture/WEBGL_depth_texture extensions
-unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
+// Begin recording geometry into thread batch on calling thread
+// NOTE: Main state snapshot (rlSyncThreadBatchState()) is copied, not live main state.
+// Recording continues after previously recorded geometry until rlDrawThreadBatch()
+void rlBeginThreadBatch(rlThreadBatch *batch)
 {
-    unsigned int id = 0;
-
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // In case depth textures not supported, we force renderbuffer usage
-    if (!RLGL.ExtSupported.texDepth) useRenderBuffer = true;
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+    if (batch->context == NULL) return;
 
-    // NOTE: We let the implementation to choose the best bit-depth
-    // Possible formats: GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT32 and GL_DEPTH_COMPONENT32F
-    unsigned int glInternalFormat = GL_DEPTH_COMPONENT;
+    rlglData *context = (rlglData *)batch->context;
+    int vertexCounter = context->State.vertexCounter;
+    int culledCount = context->State.culledCount;
 
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.maxDepthBits == 32) glInternalFormat = GL_DEPTH_COMPONENT32_OES;
-    else if (RLGL.ExtSupported.maxDepthBits == 24) glInternalFormat = GL_DEPTH_COMPONENT24_OES;
-    else glInternalFormat = GL_DEPTH_COMPONENT16;
-#endif
+    memcpy(context, &rlglShared, sizeof(rlglData));
 
-    if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
-    {
-        glGenTextures(1, &id);
-        glBindTexture(GL_TEXTURE_2D, id);
-        glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+    context->State.culledCount = culledCount;
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    // Current matrix points into main state, move it to the same matrix of recording state
+    if (rlglShared.State.currentMatrix == &rlglMain.State.projection) context->State.currentMatrix = &context->State.projection;
+    else if (rlglShared.State.currentMatrix == &rlglMain.State.transform) context->State.currentMatrix = &context->State.transform;
+    else context->State.currentMatrix = &context->State.modelview;
 
-        glBindTexture(GL_TEXTURE_2D, 0);
+    context->currentCommands = NULL;
+    context->contextCallback = NULL;
+    context->threadBatch = batch;
+    context->previousState = rlglState;
 
-        TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
-    }
-    else
-    {
-        // Create the renderbuffer that will serve as the depth attachment for the framebuffer
-        // NOTE: A renderbuffer is simpler than a texture and could offer better performance on embedded devices
-        glGenRenderbuffers(1, &id);
-        glBindRenderbuffer(GL_RENDERBUFFER, id);
-        glRenderbufferStorage(GL_RENDERBUFFER, glInternalFormat, width, height);
+    rlglState = context;
 
-        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    if (batch->batchCount > 0)
+    {
+        RLGL.currentBatch = &batch->batches[batch->batchCount - 1];
+        RLGL.State.vertexCounter = vertexCounter;
 
-        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Depth renderbuffer loaded successfully (%i bits)", id, (RLGL.ExtSupported.maxDepthBits >= 24)? RLGL.ExtSupported.maxDepthBits : 16);
+        // Recorded geometry is drawn with a single modelview per batch, start a new one if it changed
+        if (memcmp(batch->modelviews + 16*(batch->batchCount - 1), &RLGL.State.modelview, sizeof(Matrix)) != 0) rlNextThreadBatch(batch);
     }
+    else rlNextThreadBatch(batch);
+#endif
 #endif
-
-    return id;
 }
 
-// Load texture cubemap
-// NOTE: Cubemap data is expected to be 6 images in a single data array (one after the other),
-// expected the following convention: +X, -X, +Y, -Y, +Z, -Z
-unsigned int rlLoadTextureCubemap(void *data, int size, int format)
+// End recording geometry on calling thread
+void rlEndThreadBatch(void)
 {
-    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+    if (RLGL.threadBatch != NULL)
+    {
+        memcpy(RLGL.threadBatch->modelviews + 16*(RLGL.threadBatch->batchCount - 1), &RLGL.State.modelview, sizeof(Matrix));
+        rlglState = RLGL.previousState;
+    }
+#endif
+#endif
+}
 
+// Draw recorded geometry through current batch and reset thread batch
+// NOTE: Requires OpenGL context (or command buffer recording), current batch is drawn first to keep order
+void rlDrawThreadBatch(rlThreadBatch *batch)
+{
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned int dataSize = rlColor_GetPixelDataSize(size, size, format);
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+    // Quads culled while recording are counted on current state
+    if (batch->context != NULL)
+    {
+        RLGL.State.culledCount += ((rlglData *)batch->context)->State.culledCount;
+        ((rlglData *)batch->context)->State.culledCount = 0;
+    }
 
-    glGenTextures(1, &id);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    if (batch->batchCount == 0) return;
 
-    int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    rlRenderBatch *current = RLGL.currentBatch;
+    rlDrawRenderBatch(current);
 
-    if (glInternalFormat != -1)
+    int blendMode = RLGL.State.currentBlendMode;
+    unsigned int shaderId = RLGL.State.currentShaderId;
+    int *shaderLocs = RLGL.State.currentShaderLocs;
+
+    for (int i = 0; i < batch->batchCount; i++)
     {
-        // Load cubemap faces
-        for (unsigned int i = 0; i < 6; i++)
+        rlRenderBatch *recorded = &batch->batches[i];
+
+        int vertexCount = 0;
+        for (int j = 0; j < recorded->drawCounter; j++) vertexCount += (recorded->draws[j].vertexCount + recorded->draws[j].vertexAlignment);
+
+        if (vertexCount == 0) continue;
+
+        rlSetBlendMode(batch->blendModes[i]);
+        rlSetShader(batch->shaderIds[i], batch->shaderLocs[i]);
+
+        // Recorded vertex are not transformed by view, recording modelview is used
+        Matrix modelview = RLGL.State.modelview;
+        memcpy(&RLGL.State.modelview, batch->modelviews + 16*i, sizeof(Matrix));
+
+        // Recorded batch is drawn in chunks fitting current batch buffers (i.e. after adaptive capacity shrinking),
+        // a draw crossing a chunk end is split at a primitive boundary (multiple of 12 vertex: lines, triangles and quads)
+        // NOTE: On adaptive capacity, default batch grows to fit recorded batches on next update
+        if ((current == &RLGL.defaultBatch) && (vertexCount > current->vertexBuffer[0].elementCount*4)) RLGL.Adaptive.requiredElements = (vertexCount + 3)/4;
+
+        int drawIndex = 0;          // Recorded draw being chunked
+        int drawDone = 0;           // Vertex of recorded draw already drawn
+        int first = 0;              // First recorded vertex of chunk
+
+        while (drawIndex < recorded->drawCounter)
         {
-            if (data == NULL)
+            // Borrow current batch buffer: recorded vertex data is uploaded into its VBOs and chunk draws are issued
+            rlVertexBuffer *buffer = &current->vertexBuffer[current->currentBuffer];
+            int capacity = buffer->elementCount*4;
+            int count = 0;
+            int skip = 0;
+            int chunkDraws = 0;
+
+            while ((drawIndex < recorded->drawCounter) && (chunkDraws < current->drawCapacity))
             {
-                if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+                rlDrawCall call = recorded->draws[drawIndex];
+                int size = call.vertexCount - drawDone + call.vertexAlignment;
+
+                if ((count + size) <= capacity)
                 {
-                    if (format == RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32)
+                    call.vertexCount -= drawDone;
+                    current->draws[chunkDraws++] = call;
+                    count += size;
+                    drawIndex++;
+                    drawDone = 0;
+                    continue;
+                }
+
+                int split = ((capacity - count)/12)*12;
+                if (split > (call.vertexCount - drawDone)) split = call.vertexCount - drawDone;
+
+                if (split > 0)
+                {
+                    call.vertexCount = split;
+                    call.vertexAlignment = 0;
+                    current->draws[chunkDraws++] = call;
+                    count += split;
+                    drawDone += split;
+
+                    // Draw completed without its alignment vertex, they are skipped
+                    if (drawDone == recorded->draws[drawIndex].vertexCount)
                     {
-                        // Instead of using a sized internal texture format (GL_RGB16F, GL_RGB32F), we let the driver to choose the better format for us (GL_RGB)
-                        if (RLGL.ExtSupported.texFloat32) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
-                        else TRACELOG(RL_LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
+                        skip = recorded->draws[drawIndex].vertexAlignment;
+                        drawIndex++;
+                        drawDone = 0;
                     }
-                    else if ((format == RL_PIXELFORMAT_UNCOMPRESSED_R32) || (format == RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(RL_LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
-                    else glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, NULL);
                 }
-                else TRACELOG(RL_LOG_WARNING, "TEXTURES: Empty cubemap creation does not support compressed format");
-            }
-            else
-            {
-                if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, (unsigned char *)data + i*dataSize);
-                else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, dataSize, (unsigned char *)data + i*dataSize);
+                break;
             }
 
-#if defined(GRAPHICS_API_OPENGL_33)
-            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
-            {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
-                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+            if (chunkDraws == 0)
             {
-#if defined(GRAPHICS_API_OPENGL_21)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
-#elif defined(GRAPHICS_API_OPENGL_33)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
-#endif
-                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+                TRACELOG(RL_LOG_WARNING, "RLGL: Thread batch draw could not fit current batch buffers, skipped");
+                break;
             }
-#endif
+
+            float *vertices = buffer->vertices;
+            float *texcoords = buffer->texcoords;
+            unsigned char *colors = buffer->colors;
+            unsigned char *texunits = buffer->texunits;
+            float *shapes = buffer->shapes;
+
+            buffer->vertices = recorded->vertexBuffer[0].vertices + 3*first;
+            buffer->texcoords = recorded->vertexBuffer[0].texcoords + 2*first;
+            buffer->colors = recorded->vertexBuffer[0].colors + 4*first;
+            buffer->texunits = recorded->vertexBuffer[0].texunits + first;
+            buffer->shapes = recorded->vertexBuffer[0].shapes + 4*first;
+            current->drawCounter = chunkDraws;
+            current->shapeVertexCount = (recorded->shapeVertexCount > first)? recorded->shapeVertexCount - first : 0;
+            if (current->shapeVertexCount > count) current->shapeVertexCount = count;
+            RLGL.State.vertexCounter = count;
+
+            rlDrawRenderBatch(current);
+
+            buffer->vertices = vertices;
+            buffer->texcoords = texcoords;
+            buffer->colors = colors;
+            buffer->texunits = texunits;
+            buffer->shapes = shapes;
+
+            first += count + skip;
         }
+
+        RLGL.State.modelview = modelview;
     }
 
-    // Set cubemap texture sampling parameters
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-#if defined(GRAPHICS_API_OPENGL_33)
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
-#endif
+    rlSetBlendMode(blendMode);
+    rlSetShader(shaderId, shaderLocs);
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    batch->batchCount = 0;
+    if (batch->context != NULL) ((rlglData *)batch->context)->State.vertexCounter = 0;
+#endif
 #endif
-
-    if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
-    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load cubemap texture");
-
-    return id;
 }
 
-// Update already loaded texture in GPU with new data
-// NOTE: We don't know safely if internal texture format is the expected one...
-void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
+// Load static batch from geometry recorded into thread batch and reset thread batch
+// NOTE: Vertex data is uploaded once into static GPU buffers, recorded modelview is not kept
+// (current modelview is applied on drawing), requires OpenGL context
+rlStaticBatch rlLoadStaticBatch(rlThreadBatch *batch)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlRequireContext();
 
-    int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    rlStaticBatch staticBatch = { 0 };
 
-    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
-    {
-        glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, (unsigned char *)data);
-    }
-    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
-}
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+    if (batch->batchCount == 0) return staticBatch;
 
-// Get OpenGL internal formats and data type from raylib PixelFormat
-void rlGetGlTextureFormats(int format, int *glInternalFormat, int *glFormat, int *glType)
-{
-    *glInternalFormat = -1;
-    *glFormat = -1;
-    *glType = -1;
+    rlStaticSegment *segments = (rlStaticSegment *)ASC_CALLOC(batch->batchCount, sizeof(rlStaticSegment));
 
-    switch (format)
+    for (int i = 0; i < batch->batchCount; i++)
     {
-    #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_21) || defined(GRAPHICS_API_OPENGL_ES2)
-        // NOTE: on OpenGL ES 2.0 (WebGL), internalFormat must match format and options allowed are: GL_LUMINANCE, GL_RGB, GL_RGBA
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_LUMINANCE_ALPHA; *glFormat = GL_LUMINANCE_ALPHA; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
-        #if !defined(GRAPHICS_API_OPENGL_11)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_FLOAT; break;   // NOTE: Requires extension OES_texture_float
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_FLOAT; break;         // NOTE: Requires extension OES_texture_float
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;    // NOTE: Requires extension OES_texture_float
-        #endif
-    #elif defined(GRAPHICS_API_OPENGL_33)
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_R8; *glFormat = GL_RED; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_RG8; *glFormat = GL_RG; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB565; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB8; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGB5_A1; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA4; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA8; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_R32F; *glFormat = GL_RED; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB32F; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA32F; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
-    #endif
-    #if !defined(GRAPHICS_API_OPENGL_11)
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: if (RLGL.ExtSupported.texCompETC1) *glInternalFormat = GL_ETC1_RGB8_OES; break;                      // NOTE: Requires OpenGL ES 2.0 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGB8_ETC2; break;               // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC; break;     // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG; break;    // NOTE: Requires PowerVR GPU
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG; break;  // NOTE: Requires PowerVR GPU
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_8x8_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
-    #endif
-        default: TRACELOG(RL_LOG_WARNING, "TEXTURE: Current format not supported (%i)", format); break;
-    }
-}
+        rlRenderBatch *recorded = &batch->batches[i];
+        rlVertexBuffer *buffer = &recorded->vertexBuffer[0];
 
-// Unload texture from GPU memory
-void rlUnloadTexture(unsigned int id)
-{
-    glDeleteTextures(1, &id);
-}
+        int vertexCount = 0;
+        for (int j = 0; j < recorded->drawCounter; j++) vertexCount += (recorded->draws[j].vertexCount + recorded->draws[j].vertexAlignment);
 
-// Generate mipmap data for selected texture
-void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
-{
-    glBindTexture(GL_TEXTURE_2D, id);
+        if (vertexCount == 0) continue;
 
-    // Check if texture is power-of-two (POT)
-    bool texIsPOT = false;
+        rlStaticSegment *segment = &segments[staticBatch.segmentCount];
+        int quadCount = (vertexCount + 3)/4;
 
-    if (((width > 0) && ((width & (width - 1)) == 0)) &&
-        ((height > 0) && ((height & (height - 1)) == 0))) texIsPOT = true;
+        segment->state.vertexCount = vertexCount;
+        segment->state.drawCounter = recorded->drawCounter;
+        segment->draws = (rlDrawCall *)ASC_MALLOC(recorded->drawCounter*sizeof(rlDrawCall));
+        memcpy(segment->draws, recorded->draws, recorded->drawCounter*sizeof(rlDrawCall));
+        segment->blendMode = batch->blendModes[i];
 
-#if defined(GRAPHICS_API_OPENGL_11)
-    if (texIsPOT)
-    {
-        // WARNING: Manual mipmap generation only works for RGBA 32bit textures!
-        if (format == RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+        if (RLGL.ExtSupported.vao)
         {
-            // Retrieve texture data from VRAM
-            void *texData = rlReadTexturePixels(id, width, height, format);
+            glGenVertexArrays(1, &segment->state.vaoId);
+            rlCacheBindVertexArray(segment->state.vaoId);
+        }
 
-            // NOTE: Texture data size is reallocated to fit mipmaps data
-            // NOTE: CPU mipmap generation only supports RGBA 32bit data
-            int mipmapCount = rlGenTextureMipmapsData(texData, width, height);
+        // Vertex position buffer (shader-location = 0)
+        glGenBuffers(1, &segment->state.vboId[0]);
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, segment->state.vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, vertexCount*3*sizeof(float), buffer->vertices, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
 
-            int size = width*height*4;
-            int offset = size;
+        // Vertex texcoord buffer (shader-location = 1)
+        glGenBuffers(1, &segment->state.vboId[1]);
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, segment->state.vboId[1]);
+        glBufferData(GL_ARRAY_BUFFER, vertexCount*2*sizeof(float), buffer->texcoords, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
 
-            int mipWidth = width/2;
-            int mipHeight = height/2;
+        // Vertex color buffer (shader-location = 3)
+        glGenBuffers(1, &segment->state.vboId[2]);
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, segment->state.vboId[2]);
+        glBufferData(GL_ARRAY_BUFFER, vertexCount*4*sizeof(unsigned char), buffer->colors, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
 
-            // Load the mipmaps
-            for (int level = 1; level < mipmapCount; level++)
-            {
-                glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, mipWidth, mipHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, (unsigned char *)texData + offset);
+        // Vertex texture unit buffer (shader-location = 6)
+        glGenBuffers(1, &segment->state.vboId[4]);
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, segment->state.vboId[4]);
+        glBufferData(GL_ARRAY_BUFFER, vertexCount*sizeof(unsigned char), buffer->texunits, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(6);
+        glVertexAttribPointer(6, 1, GL_UNSIGNED_BYTE, GL_FALSE, 0, 0);
+
+        // Vertex shape buffer (shader-location = 7), shape parameters only recorded up to last shape vertex
+        glGenBuffers(1, &segment->state.vboId[5]);
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, segment->state.vboId[5]);
+        glBufferData(GL_ARRAY_BUFFER, vertexCount*4*sizeof(float), NULL, GL_STATIC_DRAW);
+        if (recorded->shapeVertexCount > 0) glBufferSubData(GL_ARRAY_BUFFER, 0, recorded->shapeVertexCount*4*sizeof(float), buffer->shapes);
+        glEnableVertexAttribArray(7);
+        glVertexAttribPointer(7, 4, GL_FLOAT, GL_FALSE, 0, 0);
 
-                size = mipWidth*mipHeight*4;
-                offset += size;
+#if defined(GRAPHICS_API_OPENGL_43)
+        // Draw textures units base (shader-location = 8), multi-draw indirect only
+        if (RLGL.ExtSupported.multiDrawIndirect) rlEnableDrawUnitsAttrib();
+#endif
 
-                mipWidth /= 2;
-                mipHeight /= 2;
-            }
+        // Quads index buffer, only required up to last vertex
+        // NOTE: Same layout as render batch indices, quads draw offsets are kept
+#if defined(GRAPHICS_API_OPENGL_33)
+        unsigned int *indices = (unsigned int *)ASC_MALLOC(quadCount*6*sizeof(unsigned int));
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+        unsigned short *indices = (unsigned short *)ASC_MALLOC(quadCount*6*sizeof(unsigned short));
+#endif
+        for (int k = 0; k < quadCount; k++)
+        {
+            indices[6*k] = 4*k;
+            indices[6*k + 1] = 4*k + 1;
+            indices[6*k + 2] = 4*k + 2;
+            indices[6*k + 3] = 4*k;
+            indices[6*k + 4] = 4*k + 2;
+            indices[6*k + 5] = 4*k + 3;
+        }
 
-            *mipmaps = mipmapCount + 1;
-            ASC_FREE(texData); // Once mipmaps have been generated and data has been uploaded to GPU VRAM, we can discard RAM data
+        glGenBuffers(1, &segment->state.vboId[3]);
+        rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, segment->state.vboId[3]);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, quadCount*6*sizeof(indices[0]), indices, GL_STATIC_DRAW);
+        ASC_FREE(indices);
 
-            TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Mipmaps generated manually on CPU side, total: %i", id, *mipmaps);
-        }
-        else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps for provided texture format", id);
+        staticBatch.drawCount += recorded->drawCounter;
+        staticBatch.segmentCount++;
     }
-#endif
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((texIsPOT) || (RLGL.ExtSupported.texNPOT))
-    {
-        //glHint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);   // Hint for mipmaps generation algorythm: GL_FASTEST, GL_NICEST, GL_DONT_CARE
-        glGenerateMipmap(GL_TEXTURE_2D);    // Generate mipmaps automatically
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);   // Activate Trilinear filtering for mipmaps
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
+    else
+    {
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, 0);
+        rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    }
 
-        #define MIN(a,b) (((a)<(b))?(a):(b))
-        #define MAX(a,b) (((a)>(b))?(a):(b))
+    if (staticBatch.segmentCount > 0) staticBatch.segments = segments;
+    else ASC_FREE(segments);
 
-        *mipmaps = 1 + (int)floor(log(MAX(width, height))/log(2));
-        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Mipmaps generated automatically, total: %i", id, *mipmaps);
-    }
+    // Recorded geometry is kept on GPU, thread batch is reset for next recording
+    batch->batchCount = 0;
+    if (batch->context != NULL) ((rlglData *)batch->context)->State.vertexCounter = 0;
+#endif
 #endif
-    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    return staticBatch;
 }
 
-
-// Read texture pixel data
-void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
+// Unload static batch GPU buffers
+void rlUnloadStaticBatch(rlStaticBatch *batch)
 {
-    void *pixels = NULL;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (batch->segments == NULL) return;
 
-#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlRequireContext();
 
-    // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
-    // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
-    //int width, height, format;
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+    rlStaticSegment *segments = (rlStaticSegment *)batch->segments;
 
-    // NOTE: Each row written to or read from by OpenGL pixel operations like glGetTexImage are aligned to a 4 byte boundary by default, which may add some padding.
-    // Use glPixelStorei to modify padding with the GL_[UN]PACK_ALIGNMENT setting.
-    // GL_PACK_ALIGNMENT affects operations that read from OpenGL memory (glReadPixels, glGetTexImage, etc.)
-    // GL_UNPACK_ALIGNMENT affects operations that write to OpenGL memory (glTexImage, etc.)
-    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    for (int i = 0; i < batch->segmentCount; i++)
+    {
+        glDeleteBuffers(6, segments[i].state.vboId);
+        if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &segments[i].state.vaoId);
+        ASC_FREE(segments[i].draws);
+    }
 
-    int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
-    unsigned int size = rlColor_GetPixelDataSize(width, height, format);
+    // Deleted ids could be reused by new buffers, bindings are not known anymore
+    rlInvalidateStateCache();
 
-    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    ASC_FREE(batch->segments);
+    batch->segments = NULL;
+    batch->segmentCount = 0;
+    batch->drawCount = 0;
+#endif
+}
+
+// Draw static batch with transform (applied before current modelview) and tint color (4 floats, NULL for white)
+// NOTE: Current batch is drawn first to keep order, then one draw call per recorded draw (mode/texture change),
+// current shader and additional active textures are used
+void rlDrawStaticBatch(rlStaticBatch batch, Matrix transform, const float *color)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(RLGL_ENABLE_THREAD_BATCHES)
+    if (RLGL.threadBatch != NULL)
     {
-        pixels = ASC_MALLOC(size);
-        glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, pixels);
+        TRACELOG(RL_LOG_WARNING, "RLGL: Static batch can not be drawn while recording a thread batch");
+        return;
     }
-    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
-
-    glBindTexture(GL_TEXTURE_2D, 0);
 #endif
 
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    // glGetTexImage() is not available on OpenGL ES 2.0
-    // Texture width and height are required on OpenGL ES 2.0. There is no way to get it from texture id.
-    // Two possible Options:
-    // 1 - Bind texture to color fbo attachment and glReadPixels()
-    // 2 - Create an fbo, activate it, render quad with texture, glReadPixels()
-    // We are using Option 1, just need to care for texture format on retrieval
-    // NOTE: This behaviour could be conditioned by graphic driver...
-    unsigned int fboId = rlLoadFramebuffer(width, height);
+    if (batch.segmentCount == 0) return;
 
-    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlDrawRenderBatch(RLGL.currentBatch);
 
-    // Attach our texture to FBO
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
+    Matrix matModel = transform;
+    if (RLGL.State.transformRequired) matModel = rlMatrixMultiply(transform, RLGL.State.transform);
+    Matrix matMVP = rlMatrixMultiply(rlMatrixMultiply(matModel, RLGL.State.modelview), RLGL.State.projection);
+    float matMVPfloat[16] = {
+        matMVP.m0, matMVP.m1, matMVP.m2, matMVP.m3,
+        matMVP.m4, matMVP.m5, matMVP.m6, matMVP.m7,
+        matMVP.m8, matMVP.m9, matMVP.m10, matMVP.m11,
+        matMVP.m12, matMVP.m13, matMVP.m14, matMVP.m15
+    };
 
-    // We read data as RGBA because FBO texture is configured as RGBA, despite binding another texture format
-    pixels = (unsigned char *)ASC_MALLOC(rlColor_GetPixelDataSize(width, height, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
-    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    rlStaticSegment *segments = (rlStaticSegment *)batch.segments;
+    int blendMode = RLGL.State.currentBlendMode;
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    for (int i = 0; i < batch.segmentCount; i++)
+    {
+        rlSetBlendMode(segments[i].blendMode);
 
-    // Clean up temporal fbo
-    rlUnloadFramebuffer(fboId);
-#endif
+        rlBatchState state = segments[i].state;
+        state.shaderId = RLGL.State.currentShaderId;
+        for (int j = 0; j < RL_MAX_SHADER_LOCATIONS; j++) state.shaderLocs[j] = RLGL.State.currentShaderLocs[j];
+        for (int j = 0; j < 16; j++) state.mvp[j] = matMVPfloat[j];
+        for (int j = 0; j < 4; j++) state.color[j] = (color != NULL)? color[j] : 1.0f;
+        for (int j = 0; j < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; j++) state.activeTextureId[j] = RLGL.State.activeTextureId[j];
 
-    return pixels;
-}
+        rlForgetUniformValue(state.shaderId, state.shaderLocs[RL_SHADER_LOC_MATRIX_MVP]);
+        rlForgetUniformValue(state.shaderId, state.shaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE]);
+        rlForgetUniformValue(state.shaderId, state.shaderLocs[RL_SHADER_LOC_MAP_DIFFUSE]);
 
+        if (RLGL.currentCommands != NULL)
+        {
+            unsigned char *data = (unsigned char *)rlRecordCommand(RL_COMMAND_DRAW_BATCH, 0, 0, 0, 0, sizeof(rlBatchState) + state.drawCounter*sizeof(rlDrawCall));
+            if (data != NULL)
+            {
+                memcpy(data, &state, sizeof(rlBatchState));
+                memcpy(data + sizeof(rlBatchState), segments[i].draws, state.drawCounter*sizeof(rlDrawCall));
+            }
+        }
+        else rlDrawBatchBuffers(&state, segments[i].draws);
+    }
 
-// Read screen pixel data (color buffer)
-unsigned char *rlReadScreenPixels(int width, int height)
-{
-    unsigned char *screenData = (unsigned char *)ASC_CALLOC(width*height*4, sizeof(unsigned char));
+    rlSetBlendMode(blendMode);
+#endif
+}
 
-    // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
-    // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
-    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, screenData);
+// Load a command buffer with initial capacity (bytes)
+rlCommandBuffer rlLoadCommandBuffer(int capacity)
+{
+    rlCommandBuffer cmds = { 0 };
 
-    // Flip image vertically!
-    unsigned char *imgData = (unsigned char *)ASC_MALLOC(width*height*4*sizeof(unsigned char));
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (capacity <= 0) capacity = RL_DEFAULT_COMMAND_BUFFER_SIZE;
 
-    for (int y = height - 1; y >= 0; y--)
-    {
-        for (int x = 0; x < (width*4); x++)
-        {
-            imgData[((height - 1) - y)*width*4 + x] = screenData[(y*width*4) + x];  // Flip line
+    cmds.data = (unsigned char *)ASC_MALLOC(capacity);
+    if (cmds.data != NULL) cmds.capacity = capacity;
+#endif
 
-            // Set alpha component value to 255 (no trasparent image retrieval)
-            // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
-            if (((x + 1)%4) == 0) imgData[((height - 1) - y)*width*4 + x] = 255;
-        }
-    }
+    return cmds;
+}
 
-    ASC_FREE(screenData);
+// Unload command buffer
+void rlUnloadCommandBuffer(rlCommandBuffer *cmds)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.currentCommands == cmds) RLGL.currentCommands = NULL;
 
-    return imgData;     // NOTE: image data should be freed
+    ASC_FREE(cmds->data);
+    cmds->data = NULL;
+    cmds->size = 0;
+    cmds->capacity = 0;
+    cmds->commandCount = 0;
+#endif
 }
 
-// Framebuffer management (fbo)
-//-----------------------------------------------------------------------------------------
-// Load a framebuffer to be used for rendering
-// NOTE: No textures attached
-unsigned int rlLoadFramebuffer(int width, int height)
+// Set command buffer to record into (NULL for direct OpenGL submission)
+// NOTE: Current batch is flushed before switching, so no vertex data is mixed between targets
+void rlSetCommandBuffer(rlCommandBuffer *cmds)
 {
-    unsigned int fboId = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.currentCommands != cmds)
+    {
+        if (RLGL.currentBatch != NULL) rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.currentCommands = cmds;
+    }
+#endif
+}
 
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glGenFramebuffers(1, &fboId);       // Create the framebuffer object
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);   // Unbind any framebuffer
+// Get command buffer currently recording (NULL if none)
+rlCommandBuffer *rlGetCommandBuffer(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return RLGL.currentCommands;
+#else
+    return NULL;
 #endif
+}
 
-    return fboId;
+// Set callback to request OpenGL context while recording
+// NOTE: Resources management functions (textures, shaders, framebuffers, buffers) can not be recorded,
+// when a command buffer is active they call this function to get the context on the calling thread
+void rlSetContextCallback(rlContextCallback callback)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.contextCallback = callback;
+#endif
 }
 
-// Attach color buffer texture to an fbo (unloads previous attachment)
-// NOTE: Attach type: 0-Color, 1-Depth renderbuffer, 2-Depth texture
-void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel)
+// Submit recorded commands to OpenGL and reset buffer
+// NOTE: It only calls OpenGL directly, it can run on any thread owning the OpenGL context
+// while a different command buffer is being recorded
+void rlExecuteCommandBuffer(rlCommandBuffer *cmds)
 {
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int offset = 0;
 
-    switch (attachType)
+    for (int i = 0; i < cmds->commandCount; i++)
     {
-        case RL_ATTACHMENT_COLOR_CHANNEL0:
-        case RL_ATTACHMENT_COLOR_CHANNEL1:
-        case RL_ATTACHMENT_COLOR_CHANNEL2:
-        case RL_ATTACHMENT_COLOR_CHANNEL3:
-        case RL_ATTACHMENT_COLOR_CHANNEL4:
-        case RL_ATTACHMENT_COLOR_CHANNEL5:
-        case RL_ATTACHMENT_COLOR_CHANNEL6:
-        case RL_ATTACHMENT_COLOR_CHANNEL7:
-        {
-            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_2D, texId, mipLevel);
-            else if (texType == RL_ATTACHMENT_RENDERBUFFER) glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_RENDERBUFFER, texId);
-            else if (texType >= RL_ATTACHMENT_CUBEMAP_POSITIVE_X) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_CUBE_MAP_POSITIVE_X + texType, texId, mipLevel);
+        rlCommand *cmd = (rlCommand *)(cmds->data + offset);
+        unsigned char *payload = cmds->data + offset + sizeof(rlCommand);
 
-        } break;
-        case RL_ATTACHMENT_DEPTH:
+        switch (cmd->type)
         {
-            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
-            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, texId);
+            case RL_COMMAND_VIEWPORT: glViewport(cmd->params[0], cmd->params[1], cmd->params[2], cmd->params[3]); break;
+            case RL_COMMAND_CLEAR_COLOR: glClearColor((float)cmd->params[0]/255, (float)cmd->params[1]/255, (float)cmd->params[2]/255, (float)cmd->params[3]/255); break;
+            case RL_COMMAND_CLEAR: glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); break;
+            case RL_COMMAND_FRAMEBUFFER: glBindFramebuffer(GL_FRAMEBUFFER, cmd->params[0]); break;
+            case RL_COMMAND_ENABLE: rlCacheCapability(cmd->params[0], true); break;
+            case RL_COMMAND_DISABLE: rlCacheCapability(cmd->params[0], false); break;
+            case RL_COMMAND_DEPTH_MASK: glDepthMask((GLboolean)cmd->params[0]); break;
+            case RL_COMMAND_SCISSOR: rlCacheScissor(cmd->params[0], cmd->params[1], cmd->params[2], cmd->params[3]); break;
+            case RL_COMMAND_BLEND: rlCacheBlendMode(cmd->params[0], cmd->params[1], cmd->params[2]); break;
+            case RL_COMMAND_SHADER: rlCacheUseProgram(cmd->params[0]); break;
+            case RL_COMMAND_UNIFORM:
+            {
+                int locIndex = cmd->params[0];
+                int count = cmd->params[2];
 
-        } break;
-        case RL_ATTACHMENT_STENCIL:
-        {
-            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
-            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, texId);
+                rlCacheUniformsChanged();
 
-        } break;
-        default: break;
+                switch (cmd->params[1])
+                {
+                    case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)payload); break;
+                    case RL_SHADER_UNIFORM_VEC2: glUniform2fv(locIndex, count, (float *)payload); break;
+                    case RL_SHADER_UNIFORM_VEC3: glUniform3fv(locIndex, count, (float *)payload); break;
+                    case RL_SHADER_UNIFORM_VEC4: glUniform4fv(locIndex, count, (float *)payload); break;
+                    case RL_SHADER_UNIFORM_INT: glUniform1iv(locIndex, count, (int *)payload); break;
+                    case RL_SHADER_UNIFORM_IVEC2: glUniform2iv(locIndex, count, (int *)payload); break;
+                    case RL_SHADER_UNIFORM_IVEC3: glUniform3iv(locIndex, count, (int *)payload); break;
+                    case RL_SHADER_UNIFORM_IVEC4: glUniform4iv(locIndex, count, (int *)payload); break;
+                    case RL_SHADER_UNIFORM_SAMPLER2D: glUniform1iv(locIndex, count, (int *)payload); break;
+                    default: break;
+                }
+            } break;
+            case RL_COMMAND_UNIFORM_MATRIX: rlCacheUniformsChanged(); glUniformMatrix4fv(cmd->params[0], 1, false, (float *)payload); break;
+            case RL_COMMAND_UPDATE_BATCH:
+            {
+                const rlBatchState *state = (const rlBatchState *)payload;
+                const float *vertices = (const float *)(payload + sizeof(rlBatchState));
+                const float *texcoords = vertices + state->vertexCount*3;
+                const float *shapes = texcoords + state->vertexCount*2;
+                const unsigned char *colors = (const unsigned char *)(shapes + state->shapeVertexCount*4);
+                const unsigned char *texunits = colors + state->vertexCount*4;
+
+                rlUpdateBatchBuffers(state, vertices, texcoords, shapes, colors, texunits);
+            } break;
+            case RL_COMMAND_DRAW_BATCH:
+            {
+                const rlBatchState *state = (const rlBatchState *)payload;
+                rlDrawBatchBuffers(state, (const rlDrawCall *)(payload + sizeof(rlBatchState)));
+            } break;
+            case RL_COMMAND_DRAW_ARRAY:
+            {
+                rlCacheBindVertexArray(cmd->params[0]);
+                rlCacheActiveTexture(0);
+                rlCacheBindTexture(cmd->params[1]);
+                glDrawElements(GL_TRIANGLES, cmd->params[2], GL_UNSIGNED_SHORT, 0);
+            } break;
+            case RL_COMMAND_DRAW_ARRAY_INSTANCED:
+            {
+                rlCacheBindVertexArray(cmd->params[0]);
+                rlCacheActiveTexture(0);
+                rlCacheBindTexture(cmd->params[1]);
+                glDrawArraysInstanced(GL_TRIANGLES, 0, cmd->params[2], cmd->params[3]);
+            } break;
+#if defined(GRAPHICS_API_OPENGL_43)
+            case RL_COMMAND_SHADER_BUFFER: glBindBufferBase(GL_SHADER_STORAGE_BUFFER, cmd->params[1], cmd->params[0]); break;
+            case RL_COMMAND_DISPATCH: glDispatchCompute(cmd->params[0], cmd->params[1], cmd->params[2]); break;
+            case RL_COMMAND_BARRIER: glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT); break;
+            case RL_COMMAND_COPY_BUFFER:
+            {
+                unsigned long long copy[3] = { 0 };     // Destination offset, source offset, count
+                memcpy(copy, payload, sizeof(copy));
+
+                glBindBuffer(GL_COPY_READ_BUFFER, cmd->params[1]);
+                glBindBuffer(GL_COPY_WRITE_BUFFER, cmd->params[0]);
+                glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, copy[1], copy[0], copy[2]);
+            } break;
+            case RL_COMMAND_IMAGE_TEXTURE:
+            {
+                int glInternalFormat = 0, glFormat = 0, glType = 0;
+
+                rlGetGlTextureFormats(cmd->params[2], &glInternalFormat, &glFormat, &glType);
+                glBindImageTexture(cmd->params[1], cmd->params[0], 0, 0, 0, cmd->params[3]? GL_READ_ONLY : GL_READ_WRITE, glInternalFormat);
+            } break;
+#endif
+            default: break;
+        }
+
+        offset += cmd->size;
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    cmds->size = 0;
+    cmds->commandCount = 0;
 #endif
 }
 
-// Verify render texture is complete
-bool rlFramebufferComplete(unsigned int id)
+// Textures data management
+//-----------------------------------------------------------------------------------------
+// Convert image data to OpenGL texture (returns OpenGL valid Id)
+unsigned int rlLoadTexture(void *data, int width, int height, int format, int mipmapCount)
 {
-    bool result = false;
+    rlRequireContext();
 
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, id);
+    rlCacheBindTexture(0);    // Free any old binding
 
-    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    unsigned int id = 0;
 
-    if (status != GL_FRAMEBUFFER_COMPLETE)
+    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
+#if defined(GRAPHICS_API_OPENGL_11)
+    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        switch (status)
+        TRACELOG(RL_LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
+        return id;
+    }
+#else
+    if ((!RLGL.ExtSupported.texCompDXT) && ((format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
+        (format == RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: DXT compressed texture format not supported");
+        return id;
+    }
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((!RLGL.ExtSupported.texCompETC1) && (format == RL_PIXELFORMAT_COMPRESSED_ETC1_RGB))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: ETC1 compressed texture format not supported");
+        return id;
+    }
+
+    if ((!RLGL.ExtSupported.texCompETC2) && ((format == RL_PIXELFORMAT_COMPRESSED_ETC2_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: ETC2 compressed texture format not supported");
+        return id;
+    }
+
+    if ((!RLGL.ExtSupported.texCompPVRT) && ((format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: PVRT compressed texture format not supported");
+        return id;
+    }
+
+    if ((!RLGL.ExtSupported.texCompASTC) && ((format == RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: ASTC compressed texture format not supported");
+        return id;
+    }
+#endif
+#endif  // GRAPHICS_API_OPENGL_11
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glGenTextures(1, &id);              // Generate texture id
+
+    rlCacheBindTexture(id);
+
+    int mipWidth = width;
+    int mipHeight = height;
+    int mipOffset = 0;          // Mipmap data offset
+
+    // Load the different mipmap levels
+    for (int i = 0; i < mipmapCount; i++)
+    {
+        unsigned int mipSize = rlColor_GetPixelDataSize(mipWidth, mipHeight, format);
+
+        int glInternalFormat, glFormat, glType;
+        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+        TRACELOGD("TEXTURE: Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
+
+        if (glInternalFormat != -1)
         {
-            case GL_FRAMEBUFFER_UNSUPPORTED: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer is unsupported", id); break;
-            case GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete attachment", id); break;
-#if defined(GRAPHICS_API_OPENGL_ES2)
-            case GL_FRAMEBUFFER_INCOMPLETE_DIMENSIONS: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete dimensions", id); break;
+            if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, (unsigned char *)data + mipOffset);
+#if !defined(GRAPHICS_API_OPENGL_11)
+            else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, (unsigned char *)data + mipOffset);
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33)
+            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+            {
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+            {
+#if defined(GRAPHICS_API_OPENGL_21)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
+#elif defined(GRAPHICS_API_OPENGL_33)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+#endif
+                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
 #endif
-            case GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has a missing attachment", id); break;
-            default: break;
         }
+
+        mipWidth /= 2;
+        mipHeight /= 2;
+        mipOffset += mipSize;
+
+        // Security check for NPOT textures
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    // Texture parameters configuration
+    // NOTE: glTexParameteri does NOT affect texture uploading, just the way it's used
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: OpenGL ES 2.0 with no GL_OES_texture_npot support (i.e. WebGL) has limited NPOT support, so CLAMP_TO_EDGE must be used
+    if (RLGL.ExtSupported.texNPOT)
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+    }
+    else
+    {
+        // NOTE: If using negative texture coordinates (LoadOBJ()), it does not work!
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);       // Set texture to clamp on x-axis
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);       // Set texture to clamp on y-axis
+    }
+#else
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+#endif
 
-    result = (status == GL_FRAMEBUFFER_COMPLETE);
+    // Magnification and minification filters
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (mipmapCount > 1)
+    {
+        // Activate Trilinear filtering if mipmaps are available
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    }
 #endif
 
-    return result;
+    // At this point we have the texture loaded in GPU and texture parameters configured
+
+    // NOTE: If mipmaps were not in data, they are not generated automatically
+
+    // Unbind current texture
+    rlCacheBindTexture(0);
+
+    if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
+
+    return id;
 }
 
-// Unload framebuffer from GPU memory
-// NOTE: All attached textures/cubemaps/renderbuffers are also deleted
-void rlUnloadFramebuffer(unsigned int id)
+// Load depth texture/renderbuffer (to be attached to fbo)
+// WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture/WEBGL_depth_texture extensions
+unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
 {
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    rlRequireContext();
 
-    // Query depth attachment to automatically delete texture/renderbuffer
-    int depthType = 0, depthId = 0;
-    glBindFramebuffer(GL_FRAMEBUFFER, id);   // Bind framebuffer to query depth texture type
-    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &depthType);
-    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &depthId);
+    unsigned int id = 0;
 
-    unsigned int depthIdU = (unsigned int)depthId;
-    if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
-    else if (depthType == GL_RENDERBUFFER) glDeleteTextures(1, &depthIdU);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // In case depth textures not supported, we force renderbuffer usage
+    if (!RLGL.ExtSupported.texDepth) useRenderBuffer = true;
 
-    // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
-    // the texture image is automatically detached from the currently bound framebuffer.
+    // NOTE: We let the implementation to choose the best bit-depth
+    // Possible formats: GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT32 and GL_DEPTH_COMPONENT32F
+    unsigned int glInternalFormat = GL_DEPTH_COMPONENT;
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    glDeleteFramebuffers(1, &id);
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.maxDepthBits == 32) glInternalFormat = GL_DEPTH_COMPONENT32_OES;
+    else if (RLGL.ExtSupported.maxDepthBits == 24) glInternalFormat = GL_DEPTH_COMPONENT24_OES;
+    else glInternalFormat = GL_DEPTH_COMPONENT16;
+#endif
 
-    TRACELOG(RL_LOG_INFO, "FBO: [ID %i] Unloaded framebuffer from VRAM (GPU)", id);
+    if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
+    {
+        glGenTextures(1, &id);
+        rlCacheBindTexture(id);
+        glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        rlCacheBindTexture(0);
+
+        TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
+    }
+    else
+    {
+        // Create the renderbuffer that will serve as the depth attachment for the framebuffer
+        // NOTE: A renderbuffer is simpler than a texture and could offer better performance on embedded devices
+        glGenRenderbuffers(1, &id);
+        glBindRenderbuffer(GL_RENDERBUFFER, id);
+        glRenderbufferStorage(GL_RENDERBUFFER, glInternalFormat, width, height);
+
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Depth renderbuffer loaded successfully (%i bits)", id, (RLGL.ExtSupported.maxDepthBits >= 24)? RLGL.ExtSupported.maxDepthBits : 16);
+    }
 #endif
+
+    return id;
 }
 
-// Vertex data management
-//-----------------------------------------------------------------------------------------
-// Load a new attributes buffer
-unsigned int rlLoadVertexBuffer(void *buffer, int size, bool dynamic)
+// Load texture cubemap
+// NOTE: Cubemap data is expected to be 6 images in a single data array (one after the other),
+// expected the following convention: +X, -X, +Y, -Y, +Z, -Z
+unsigned int rlLoadTextureCubemap(void *data, int size, int format)
 {
+    rlRequireContext();
+
     unsigned int id = 0;
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glGenBuffers(1, &id);
-    glBindBuffer(GL_ARRAY_BUFFER, id);
-    glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+    unsigned int dataSize = rlColor_GetPixelDataSize(size, size, format);
+
+    glGenTextures(1, &id);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+
+    int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if (glInternalFormat != -1)
+    {
+        // Load cubemap faces
+        for (unsigned int i = 0; i < 6; i++)
+        {
+            if (data == NULL)
+            {
+                if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+                {
+                    if (format == RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32)
+                    {
+                        // Instead of using a sized internal texture format (GL_RGB16F, GL_RGB32F), we let the driver to choose the better format for us (GL_RGB)
+                        if (RLGL.ExtSupported.texFloat32) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+                        else TRACELOG(RL_LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
+                    }
+                    else if ((format == RL_PIXELFORMAT_UNCOMPRESSED_R32) || (format == RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(RL_LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
+                    else glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, NULL);
+                }
+                else TRACELOG(RL_LOG_WARNING, "TEXTURES: Empty cubemap creation does not support compressed format");
+            }
+            else
+            {
+                if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, (unsigned char *)data + i*dataSize);
+                else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, dataSize, (unsigned char *)data + i*dataSize);
+            }
+
+#if defined(GRAPHICS_API_OPENGL_33)
+            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+            {
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+            {
+#if defined(GRAPHICS_API_OPENGL_21)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
+#elif defined(GRAPHICS_API_OPENGL_33)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+#endif
+                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+#endif
+        }
+    }
+
+    // Set cubemap texture sampling parameters
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
+#endif
+
+    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+#endif
+
+    if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load cubemap texture");
+
+    return id;
+}
+
+// Update already loaded texture in GPU with new data
+// NOTE: We don't know safely if internal texture format is the expected one...
+void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
+{
+    rlRequireContext();
+
+    rlCacheBindTexture(id);
+
+    int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, (unsigned char *)data);
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
+}
+
+// Get OpenGL internal formats and data type from raylib PixelFormat
+void rlGetGlTextureFormats(int format, int *glInternalFormat, int *glFormat, int *glType)
+{
+    *glInternalFormat = -1;
+    *glFormat = -1;
+    *glType = -1;
+
+    switch (format)
+    {
+    #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_21) || defined(GRAPHICS_API_OPENGL_ES2)
+        // NOTE: on OpenGL ES 2.0 (WebGL), internalFormat must match format and options allowed are: GL_LUMINANCE, GL_RGB, GL_RGBA
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_LUMINANCE_ALPHA; *glFormat = GL_LUMINANCE_ALPHA; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
+        #if !defined(GRAPHICS_API_OPENGL_11)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_FLOAT; break;   // NOTE: Requires extension OES_texture_float
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_FLOAT; break;         // NOTE: Requires extension OES_texture_float
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;    // NOTE: Requires extension OES_texture_float
+        #endif
+    #elif defined(GRAPHICS_API_OPENGL_33)
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_R8; *glFormat = GL_RED; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_RG8; *glFormat = GL_RG; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB565; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB8; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGB5_A1; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA4; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA8; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_R32F; *glFormat = GL_RED; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB32F; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA32F; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
+    #endif
+    #if !defined(GRAPHICS_API_OPENGL_11)
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: if (RLGL.ExtSupported.texCompETC1) *glInternalFormat = GL_ETC1_RGB8_OES; break;                      // NOTE: Requires OpenGL ES 2.0 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGB8_ETC2; break;               // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC; break;     // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG; break;    // NOTE: Requires PowerVR GPU
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG; break;  // NOTE: Requires PowerVR GPU
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_8x8_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
+    #endif
+        default: TRACELOG(RL_LOG_WARNING, "TEXTURE: Current format not supported (%i)", format); break;
+    }
+}
+
+// Unload texture from GPU memory
+void rlUnloadTexture(unsigned int id)
+{
+    rlRequireContext();
+
+    glDeleteTextures(1, &id);
+    rlInvalidateStateCache();   // Deleted texture could be bound on any unit
+}
+
+// Generate mipmap data for selected texture
+void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
+{
+    rlRequireContext();
+
+    rlCacheBindTexture(id);
+
+    // Check if texture is power-of-two (POT)
+    bool texIsPOT = false;
+
+    if (((width > 0) && ((width & (width - 1)) == 0)) &&
+        ((height > 0) && ((height & (height - 1)) == 0))) texIsPOT = true;
+
+#if defined(GRAPHICS_API_OPENGL_11)
+    if (texIsPOT)
+    {
+        // WARNING: Manual mipmap generation only works for RGBA 32bit textures!
+        if (format == RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+        {
+            // Retrieve texture data from VRAM
+            void *texData = rlReadTexturePixels(id, width, height, format);
+
+            // NOTE: Texture data size is reallocated to fit mipmaps data
+            // NOTE: CPU mipmap generation only supports RGBA 32bit data
+            int mipmapCount = rlGenTextureMipmapsData(texData, width, height);
+
+            int size = width*height*4;
+            int offset = size;
+
+            int mipWidth = width/2;
+            int mipHeight = height/2;
+
+            // Load the mipmaps
+            for (int level = 1; level < mipmapCount; level++)
+            {
+                glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, mipWidth, mipHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, (unsigned char *)texData + offset);
+
+                size = mipWidth*mipHeight*4;
+                offset += size;
+
+                mipWidth /= 2;
+                mipHeight /= 2;
+            }
+
+            *mipmaps = mipmapCount + 1;
+            ASC_FREE(texData); // Once mipmaps have been generated and data has been uploaded to GPU VRAM, we can discard RAM data
+
+            TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Mipmaps generated manually on CPU side, total: %i", id, *mipmaps);
+        }
+        else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps for provided texture format", id);
+    }
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((texIsPOT) || (RLGL.ExtSupported.texNPOT))
+    {
+        //glHint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);   // Hint for mipmaps generation algorythm: GL_FASTEST, GL_NICEST, GL_DONT_CARE
+        glGenerateMipmap(GL_TEXTURE_2D);    // Generate mipmaps automatically
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);   // Activate Trilinear filtering for mipmaps
+
+        #define MIN(a,b) (((a)<(b))?(a):(b))
+        #define MAX(a,b) (((a)>(b))?(a):(b))
+
+        *mipmaps = 1 + (int)floor(log(MAX(width, height))/log(2));
+        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Mipmaps generated automatically, total: %i", id, *mipmaps);
+    }
+#endif
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
+
+    rlCacheBindTexture(0);
+}
+
+
+// Read texture pixel data
+void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
+{
+    rlRequireContext();
+
+    void *pixels = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
+    rlCacheBindTexture(id);
+
+    // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
+    // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
+    //int width, height, format;
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+
+    // NOTE: Each row written to or read from by OpenGL pixel operations like glGetTexImage are aligned to a 4 byte boundary by default, which may add some padding.
+    // Use glPixelStorei to modify padding with the GL_[UN]PACK_ALIGNMENT setting.
+    // GL_PACK_ALIGNMENT affects operations that read from OpenGL memory (glReadPixels, glGetTexImage, etc.)
+    // GL_UNPACK_ALIGNMENT affects operations that write to OpenGL memory (glTexImage, etc.)
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+    int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    unsigned int size = rlColor_GetPixelDataSize(width, height, format);
+
+    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        pixels = ASC_MALLOC(size);
+        glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, pixels);
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
+
+    rlCacheBindTexture(0);
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // glGetTexImage() is not available on OpenGL ES 2.0
+    // Texture width and height are required on OpenGL ES 2.0. There is no way to get it from texture id.
+    // Two possible Options:
+    // 1 - Bind texture to color fbo attachment and glReadPixels()
+    // 2 - Create an fbo, activate it, render quad with texture, glReadPixels()
+    // We are using Option 1, just need to care for texture format on retrieval
+    // NOTE: This behaviour could be conditioned by graphic driver...
+    unsigned int fboId = rlLoadFramebuffer(width, height);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+    rlCacheBindTexture(0);
+
+    // Attach our texture to FBO
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
+
+    // We read data as RGBA because FBO texture is configured as RGBA, despite binding another texture format
+    pixels = (unsigned char *)ASC_MALLOC(rlColor_GetPixelDataSize(width, height, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // Clean up temporal fbo
+    rlUnloadFramebuffer(fboId);
+#endif
+
+    return pixels;
+}
+
+
+// Read screen pixel data (color buffer)
+unsigned char *rlReadScreenPixels(int width, int height)
+{
+    rlRequireContext();
+
+    unsigned char *screenData = (unsigned char *)ASC_CALLOC(width*height*4, sizeof(unsigned char));
+
+    // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
+    // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, screenData);
+
+    // Flip image vertically!
+    unsigned char *imgData = (unsigned char *)ASC_MALLOC(width*height*4*sizeof(unsigned char));
+
+    for (int y = height - 1; y >= 0; y--)
+    {
+        for (int x = 0; x < (width*4); x++)
+        {
+            imgData[((height - 1) - y)*width*4 + x] = screenData[(y*width*4) + x];  // Flip line
+
+            // Set alpha component value to 255 (no trasparent image retrieval)
+            // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+            if (((x + 1)%4) == 0) imgData[((height - 1) - y)*width*4 + x] = 255;
+        }
+    }
+
+    ASC_FREE(screenData);
+
+    return imgData;     // NOTE: image data should be freed
+}
+
+// Framebuffer management (fbo)
+//-----------------------------------------------------------------------------------------
+// Load a framebuffer to be used for rendering
+// NOTE: No textures attached
+unsigned int rlLoadFramebuffer(int width, int height)
+{
+    rlRequireContext();
+
+    unsigned int fboId = 0;
+
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glGenFramebuffers(1, &fboId);       // Create the framebuffer object
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);   // Unbind any framebuffer
+#endif
+
+    return fboId;
+}
+
+// Attach color buffer texture to an fbo (unloads previous attachment)
+// NOTE: Attach type: 0-Color, 1-Depth renderbuffer, 2-Depth texture
+void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel)
+{
+    rlRequireContext();
+
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+
+    switch (attachType)
+    {
+        case RL_ATTACHMENT_COLOR_CHANNEL0:
+        case RL_ATTACHMENT_COLOR_CHANNEL1:
+        case RL_ATTACHMENT_COLOR_CHANNEL2:
+        case RL_ATTACHMENT_COLOR_CHANNEL3:
+        case RL_ATTACHMENT_COLOR_CHANNEL4:
+        case RL_ATTACHMENT_COLOR_CHANNEL5:
+        case RL_ATTACHMENT_COLOR_CHANNEL6:
+        case RL_ATTACHMENT_COLOR_CHANNEL7:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_2D, texId, mipLevel);
+            else if (texType == RL_ATTACHMENT_RENDERBUFFER) glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_RENDERBUFFER, texId);
+            else if (texType >= RL_ATTACHMENT_CUBEMAP_POSITIVE_X) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_CUBE_MAP_POSITIVE_X + texType, texId, mipLevel);
+
+        } break;
+        case RL_ATTACHMENT_DEPTH:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
+            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, texId);
+
+        } break;
+        case RL_ATTACHMENT_STENCIL:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
+            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, texId);
+
+        } break;
+        default: break;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+#endif
+}
+
+// Verify render texture is complete
+bool rlFramebufferComplete(unsigned int id)
+{
+    rlRequireContext();
+
+    bool result = false;
+
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glBindFramebuffer(GL_FRAMEBUFFER, id);
+
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+
+    if (status != GL_FRAMEBUFFER_COMPLETE)
+    {
+        switch (status)
+        {
+            case GL_FRAMEBUFFER_UNSUPPORTED: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer is unsupported", id); break;
+            case GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete attachment", id); break;
+#if defined(GRAPHICS_API_OPENGL_ES2)
+            case GL_FRAMEBUFFER_INCOMPLETE_DIMENSIONS: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete dimensions", id); break;
+#endif
+            case GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has a missing attachment", id); break;
+            default: break;
+        }
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    result = (status == GL_FRAMEBUFFER_COMPLETE);
+#endif
+
+    return result;
+}
+
+// Unload framebuffer from GPU memory
+// NOTE: All attached textures/cubemaps/renderbuffers are also deleted
+void rlUnloadFramebuffer(unsigned int id)
+{
+    rlRequireContext();
+
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+
+    // Query depth attachment to automatically delete texture/renderbuffer
+    int depthType = 0, depthId = 0;
+    glBindFramebuffer(GL_FRAMEBUFFER, id);   // Bind framebuffer to query depth texture type
+    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &depthType);
+    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &depthId);
+
+    unsigned int depthIdU = (unsigned int)depthId;
+    if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
+    else if (depthType == GL_RENDERBUFFER) glDeleteTextures(1, &depthIdU);
+
+    // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
+    // the texture image is automatically detached from the currently bound framebuffer.
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDeleteFramebuffers(1, &id);
+
+    TRACELOG(RL_LOG_INFO, "FBO: [ID %i] Unloaded framebuffer from VRAM (GPU)", id);
+#endif
+}
+
+// Vertex data management
+//-----------------------------------------------------------------------------------------
+// Load a new attributes buffer
+unsigned int rlLoadVertexBuffer(void *buffer, int size, bool dynamic)
+{
+    rlRequireContext();
+
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glGenBuffers(1, &id);
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+#endif
+
+    return id;
+}
+
+// Load a new attributes element buffer
+unsigned int rlLoadVertexBufferElement(void *buffer, int size, bool dynamic)
+{
+    rlRequireContext();
+
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glGenBuffers(1, &id);
+    rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+#endif
+
+    return id;
+}
+
+// Enable vertex buffer (VBO)
+void rlEnableVertexBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, id);
+#endif
+}
+
+// Disable vertex buffer (VBO)
+void rlDisableVertexBuffer(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, 0);
+#endif
+}
+
+// Enable vertex buffer element (VBO element)
+void rlEnableVertexBufferElement(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+#endif
+}
+
+// Disable vertex buffer element (VBO element)
+void rlDisableVertexBufferElement(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+#endif
+}
+
+// Update vertex buffer with new data
+// NOTE: dataSize and offset must be provided in bytes
+void rlUpdateVertexBuffer(unsigned int id, void *data, int dataSize, int offset)
+{
+    rlRequireContext();
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
+#endif
+}
+
+// Update vertex buffer elements with new data
+// NOTE: dataSize and offset must be provided in bytes
+void rlUpdateVertexBufferElements(unsigned int id, void *data, int dataSize, int offset)
+{
+    rlRequireContext();
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
+#endif
+}
+
+// Enable vertex array object (VAO)
+bool rlEnableVertexArray(unsigned int vaoId)
+{
+    bool result = false;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.vao)
+    {
+        rlCacheBindVertexArray(vaoId);
+        result = true;
+    }
+#endif
+    return result;
+}
+
+// Disable vertex array object (VAO)
+void rlDisableVertexArray(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
+#endif
+}
+
+// Enable vertex attribute index
+void rlEnableVertexAttribute(unsigned int index)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glEnableVertexAttribArray(index);
+#endif
+}
+
+// Disable vertex attribute index
+void rlDisableVertexAttribute(unsigned int index)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glDisableVertexAttribArray(index);
+#endif
+}
+
+// Draw vertex array
+void rlDrawVertexArray(int offset, int count)
+{
+    glDrawArrays(GL_TRIANGLES, offset, count);
+}
+
+// Draw vertex array elements
+void rlDrawVertexArrayElements(int offset, int count, void *buffer)
+{
+    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (unsigned short *)buffer + offset);
+}
+
+// Draw vertex array instanced
+void rlDrawVertexArrayInstanced(int offset, int count, int instances)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+#endif
+}
+
+// Draw vertex array elements instanced
+void rlDrawVertexArrayElementsInstanced(int offset, int count, void *buffer, int instances)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (unsigned short *)buffer + offset, instances);
+#endif
+}
+
+// Draw vertex array (VAO) elements with texture on slot 0
+// NOTE: Vertex array must have its elements buffer bound, only supported if VAO are supported,
+// draw is recorded while recording, so it is kept in order with batches draws
+void rlDrawVertexArrayTexture(unsigned int vaoId, unsigned int textureId, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.ExtSupported.vao) return;
+    if (RLGL.currentCommands != NULL) { rlRecordCommand(RL_COMMAND_DRAW_ARRAY, vaoId, textureId, count, 0, 0); return; }
+
+    rlCacheBindVertexArray(vaoId);
+    rlCacheActiveTexture(0);
+    rlCacheBindTexture(textureId);
+    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, 0);
+#endif
+}
+
+// Draw vertex array (VAO) vertex instanced with texture on slot 0
+// NOTE: No elements buffer required, vertex could be generated by shader (gl_VertexID),
+// draw is recorded while recording, so it is kept in order with batches draws
+void rlDrawVertexArrayTextureInstanced(unsigned int vaoId, unsigned int textureId, int count, int instances)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.ExtSupported.vao || !RLGL.ExtSupported.instancing) return;
+    if (RLGL.currentCommands != NULL) { rlRecordCommand(RL_COMMAND_DRAW_ARRAY_INSTANCED, vaoId, textureId, count, instances, 0); return; }
+
+    rlCacheBindVertexArray(vaoId);
+    rlCacheActiveTexture(0);
+    rlCacheBindTexture(textureId);
+    glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+#endif
+}
+
+#if defined(GRAPHICS_API_OPENGL_11)
+// Enable vertex state pointer
+void rlEnableStatePointer(int vertexAttribType, void *buffer)
+{
+    if (buffer != NULL) glEnableClientState(vertexAttribType);
+    switch (vertexAttribType)
+    {
+        case GL_VERTEX_ARRAY: glVertexPointer(3, GL_FLOAT, 0, buffer); break;
+        case GL_TEXTURE_COORD_ARRAY: glTexCoordPointer(2, GL_FLOAT, 0, buffer); break;
+        case GL_NORMAL_ARRAY: if (buffer != NULL) glNormalPointer(GL_FLOAT, 0, buffer); break;
+        case GL_COLOR_ARRAY: if (buffer != NULL) glColorPointer(4, GL_UNSIGNED_BYTE, 0, buffer); break;
+        //case GL_INDEX_ARRAY: if (buffer != NULL) glIndexPointer(GL_SHORT, 0, buffer); break; // Indexed colors
+        default: break;
+    }
+}
+
+// Disable vertex state pointer
+void rlDisableStatePointer(int vertexAttribType)
+{
+    glDisableClientState(vertexAttribType);
+}
+#endif
+
+// Load vertex array object (VAO)
+unsigned int rlLoadVertexArray(void)
+{
+    rlRequireContext();
+
+    unsigned int vaoId = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.vao)
+    {
+        glGenVertexArrays(1, &vaoId);
+    }
+#endif
+    return vaoId;
+}
+
+// Set vertex attribute
+void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, void *pointer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glVertexAttribPointer(index, compSize, type, normalized, stride, pointer);
+#endif
+}
+
+// Set vertex attribute divisor
+void rlSetVertexAttributeDivisor(unsigned int index, int divisor)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glVertexAttribDivisor(index, divisor);
+#endif
+}
+
+// Unload vertex array object (VAO)
+void rlUnloadVertexArray(unsigned int vaoId)
+{
+    rlRequireContext();
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.vao)
+    {
+        rlCacheBindVertexArray(0);
+        glDeleteVertexArrays(1, &vaoId);
+        rlInvalidateStateCache();
+        TRACELOG(RL_LOG_INFO, "VAO: [ID %i] Unloaded vertex array data from VRAM (GPU)", vaoId);
+    }
+#endif
+}
+
+// Unload vertex buffer (VBO)
+void rlUnloadVertexBuffer(unsigned int vboId)
+{
+    rlRequireContext();
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glDeleteBuffers(1, &vboId);
+    rlInvalidateStateCache();
+    //TRACELOG(RL_LOG_INFO, "VBO: Unloaded vertex data from VRAM (GPU)");
+#endif
+}
+
+// Shaders management
+//-----------------------------------------------------------------------------------------------
+// Load shader from code strings
+// NOTE: If shader string is NULL, using default vertex/fragment shaders
+unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
+{
+    rlRequireContext();
+
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Try loading program from binary cache, shaders compilation and program linking are skipped
+    char cacheKey[RL_SHADER_CACHE_KEY_SIZE] = { 0 };
+
+    if (((vsCode != NULL) || (fsCode != NULL)) && rlGetShaderCacheKey(vsCode, fsCode, cacheKey))
+    {
+        id = rlLoadShaderBinary(cacheKey);
+        if (id > 0) return id;
+    }
+
+    // Default shaders are compiled on demand when default program was loaded from binary cache
+    if ((vsCode == NULL) && (fsCode != NULL) && (RLGL.State.defaultVShaderId == 0)) RLGL.State.defaultVShaderId = rlCompileShader(RLGL.State.defaultVShaderCode, GL_VERTEX_SHADER);
+    if ((fsCode == NULL) && (vsCode != NULL) && (RLGL.State.defaultFShaderId == 0)) RLGL.State.defaultFShaderId = rlCompileShader(RLGL.State.defaultFShaderCode, GL_FRAGMENT_SHADER);
+
+    unsigned int vertexShaderId = RLGL.State.defaultVShaderId;
+    unsigned int fragmentShaderId = RLGL.State.defaultFShaderId;
+
+    if (vsCode != NULL) vertexShaderId = rlCompileShader(vsCode, GL_VERTEX_SHADER);
+    if (fsCode != NULL) fragmentShaderId = rlCompileShader(fsCode, GL_FRAGMENT_SHADER);
+
+    if ((vertexShaderId == RLGL.State.defaultVShaderId) && (fragmentShaderId == RLGL.State.defaultFShaderId)) id = RLGL.State.defaultShaderId;
+    else
+    {
+        id = rlLoadShaderProgram(vertexShaderId, fragmentShaderId);
+
+        if (vertexShaderId != RLGL.State.defaultVShaderId)
+        {
+            // Detach shader before deletion to make sure memory is freed
+            glDetachShader(id, vertexShaderId);
+            glDeleteShader(vertexShaderId);
+        }
+        if (fragmentShaderId != RLGL.State.defaultFShaderId)
+        {
+            // Detach shader before deletion to make sure memory is freed
+            glDetachShader(id, fragmentShaderId);
+            glDeleteShader(fragmentShaderId);
+        }
+
+        if (id == 0)
+        {
+            TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load custom shader code");
+            id = RLGL.State.defaultShaderId;
+        }
+        else if (cacheKey[0] != '\0') rlSaveShaderBinary(id, cacheKey);
+    }
+
+    // Get available shader uniforms
+    // NOTE: This information is useful for debug...
+    int uniformCount = -1;
+
+    glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &uniformCount);
+
+    for (int i = 0; i < uniformCount; i++)
+    {
+        int namelen = -1;
+        int num = -1;
+        char name[256] = { 0 };     // Assume no variable names longer than 256
+        GLenum type = GL_ZERO;
+
+        // Get the name of the uniforms
+        glGetActiveUniform(id, i, sizeof(name) - 1, &namelen, &num, &type, name);
+
+        name[namelen] = 0;
+
+        TRACELOGD("SHADER: [ID %i] Active uniform (%s) set at location: %i", id, name, glGetUniformLocation(id, name));
+    }
+#endif
+
+    return id;
+}
+
+// Compile custom shader and return shader id
+unsigned int rlCompileShader(const char *shaderCode, int type)
+{
+    rlRequireContext();
+
+    unsigned int shader = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    shader = glCreateShader(type);
+    glShaderSource(shader, 1, &shaderCode, NULL);
+
+    GLint success = 0;
+    glCompileShader(shader);
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        switch (type)
+        {
+            case GL_VERTEX_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile vertex shader code", shader); break;
+            case GL_FRAGMENT_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile fragment shader code", shader); break;
+            //case GL_GEOMETRY_SHADER:
+        #if defined(GRAPHICS_API_OPENGL_43)
+            case GL_COMPUTE_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile compute shader code", shader); break;
+        #endif
+            default: break;
+        }
+
+        int maxLength = 0;
+        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+
+        if (maxLength > 0)
+        {
+            int length = 0;
+            char *log = ASC_CALLOC(maxLength, sizeof(char));
+            glGetShaderInfoLog(shader, maxLength, &length, log);
+            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Compile error: %s", shader, log);
+            ASC_FREE(log);
+        }
+    }
+    else
+    {
+        switch (type)
+        {
+            case GL_VERTEX_SHADER: TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Vertex shader compiled successfully", shader); break;
+            case GL_FRAGMENT_SHADER: TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Fragment shader compiled successfully", shader); break;
+            //case GL_GEOMETRY_SHADER:
+        #if defined(GRAPHICS_API_OPENGL_43)
+            case GL_COMPUTE_SHADER: TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Compute shader compiled successfully", shader); break;
+        #endif
+            default: break;
+        }
+    }
+#endif
+
+    return shader;
+}
+
+// Load custom shader strings and return program id
+unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+{
+    rlRequireContext();
+
+    unsigned int program = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    GLint success = 0;
+    program = glCreateProgram();
+
+    glAttachShader(program, vShaderId);
+    glAttachShader(program, fShaderId);
+
+    // NOTE: Default attribute shader locations must be binded before linking,
+    // changes must be reflected on shader binary cache key (rlGetShaderCacheKey())
+    glBindAttribLocation(program, 0, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    glBindAttribLocation(program, 1, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+    glBindAttribLocation(program, 2, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
+    glBindAttribLocation(program, 3, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+    glBindAttribLocation(program, 4, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
+    glBindAttribLocation(program, 5, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    glBindAttribLocation(program, 6, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXUNIT);
+    glBindAttribLocation(program, 7, RL_DEFAULT_SHADER_ATTRIB_NAME_SHAPE);
+    glBindAttribLocation(program, 8, RL_DEFAULT_SHADER_ATTRIB_NAME_DRAWUNIT);
+
+    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Program binary could be saved into cache after linking
+    if (RLGL.ExtSupported.programBinary) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+
+    glLinkProgram(program);
+
+    // NOTE: All uniform variables are intitialised to 0 when a program links
+
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link shader program", program);
+
+        int maxLength = 0;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+
+        if (maxLength > 0)
+        {
+            int length = 0;
+            char *log = ASC_CALLOC(maxLength, sizeof(char));
+            glGetProgramInfoLog(program, maxLength, &length, log);
+            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
+            ASC_FREE(log);
+        }
+
+        glDeleteProgram(program);
+
+        program = 0;
+    }
+    else
+    {
+        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
+        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
+        //GLint binarySize = 0;
+        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+
+        // Cache active uniforms locations, avoids glGetUniformLocation() calls later
+        rlLoadShaderUniforms(program);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", program);
+    }
+#endif
+    return program;
+}
+
+// Unload shader program
+void rlUnloadShaderProgram(unsigned int id)
+{
+    rlRequireContext();
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glDeleteProgram(id);
+    rlInvalidateStateCache();
+    rlUnloadShaderUniforms(id);
+
+    TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
+#endif
+}
+
+// Get shader location uniform
+// NOTE: Locations are cached by name, OpenGL is only queried for names not found on cache
+int rlGetLocationUniform(unsigned int shaderId, const char *uniformName)
+{
+    int location = -1;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlShaderUniforms *uniforms = rlGetShaderUniforms(shaderId, true);
+    rlUniformName *cached = rlFindUniformName(uniforms, uniformName, rlHashString(uniformName));
+
+    if (cached->name != NULL) return cached->location;
+
+    rlRequireContext();
+
+    location = glGetUniformLocation(shaderId, uniformName);
+    rlAddUniformName(uniforms, uniformName, location);
+
+    if (location == -1) TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to find shader uniform: %s", shaderId, uniformName);
+    else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Shader uniform (%s) set at location: %i", shaderId, uniformName, location);
+#endif
+    return location;
+}
+
+// Get shader location attribute
+int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
+{
+    rlRequireContext();
+
+    int location = -1;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    location = glGetAttribLocation(shaderId, attribName);
+
+    if (location == -1) TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to find shader attribute: %s", shaderId, attribName);
+    else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Shader attribute (%s) set at location: %i", shaderId, attribName, location);
+#endif
+    return location;
+}
+
+// Set shader value uniform
+void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (rlCheckThreadBatchUniform()) return;
+
+    // Value set out of uniforms cache, last value kept is not valid anymore
+    rlForgetUniformValue(RLGL.Uniforms.enabledProgramId, locIndex);
+
+    if (RLGL.currentCommands != NULL)
+    {
+        // Uniform values are copied into the command payload
+        int dataSize = rlGetUniformComponents(uniformType)*count*4;     // NOTE: float and int values are 4 bytes
+        void *data = rlRecordCommand(RL_COMMAND_UNIFORM, locIndex, uniformType, count, 0, dataSize);
+        if (data != NULL) memcpy(data, value, dataSize);
+        return;
+    }
+
+    rlCacheUniformsChanged();
+
+    switch (uniformType)
+    {
+        case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_VEC2: glUniform2fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_VEC3: glUniform3fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_VEC4: glUniform4fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_INT: glUniform1iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_IVEC2: glUniform2iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_IVEC3: glUniform3iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_IVEC4: glUniform4iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_SAMPLER2D: glUniform1iv(locIndex, count, (int *)value); break;
+        default: TRACELOG(RL_LOG_WARNING, "SHADER: Failed to set uniform value, data type not recognized");
+    }
+#endif
+}
+
+// Set shader value attribute
+void rlSetVertexAttributeDefault(int locIndex, const void *value, int attribType, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    switch (attribType)
+    {
+        case RL_SHADER_ATTRIB_FLOAT: if (count == 1) glVertexAttrib1fv(locIndex, (float *)value); break;
+        case RL_SHADER_ATTRIB_VEC2: if (count == 2) glVertexAttrib2fv(locIndex, (float *)value); break;
+        case RL_SHADER_ATTRIB_VEC3: if (count == 3) glVertexAttrib3fv(locIndex, (float *)value); break;
+        case RL_SHADER_ATTRIB_VEC4: if (count == 4) glVertexAttrib4fv(locIndex, (float *)value); break;
+        default: TRACELOG(RL_LOG_WARNING, "SHADER: Failed to set attrib default value, data type not recognized");
+    }
+#endif
+}
+
+// Set shader value uniform matrix
+void rlSetUniformMatrix(int locIndex, Matrix mat)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    float matfloat[16] = {
+        mat.m0, mat.m1, mat.m2, mat.m3,
+        mat.m4, mat.m5, mat.m6, mat.m7,
+        mat.m8, mat.m9, mat.m10, mat.m11,
+        mat.m12, mat.m13, mat.m14, mat.m15
+    };
+
+    if (rlCheckThreadBatchUniform()) return;
+
+    // Value set out of uniforms cache, last value kept is not valid anymore
+    rlForgetUniformValue(RLGL.Uniforms.enabledProgramId, locIndex);
+
+    if (RLGL.currentCommands != NULL)
+    {
+        float *data = (float *)rlRecordCommand(RL_COMMAND_UNIFORM_MATRIX, locIndex, 0, 0, 0, 16*sizeof(float));
+        if (data != NULL) memcpy(data, matfloat, 16*sizeof(float));
+        return;
+    }
+
+    rlCacheUniformsChanged();
+    glUniformMatrix4fv(locIndex, 1, false, matfloat);
+#endif
+}
+
+// Set shader value uniform sampler
+void rlSetUniformSampler(int locIndex, unsigned int textureId)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (rlCheckThreadBatchUniform()) return;
+
+    // Check if texture is already active
+    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) if (RLGL.State.activeTextureId[i] == textureId) return;
+
+    // Register a new active texture for the internal batch system
+    // NOTE: Default texture is always activated as GL_TEXTURE0
+    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
+    {
+        if (RLGL.State.activeTextureId[i] == 0)
+        {
+            int unit = 1 + i;
+            rlSetUniform(locIndex, &unit, RL_SHADER_UNIFORM_INT, 1);   // Activate new texture unit
+            RLGL.State.activeTextureId[i] = textureId; // Save texture id for binding on drawing
+            break;
+        }
+    }
+#endif
+}
+
+// Set shader uniform value, skipped if already set
+// NOTE: Last value set is kept per shader, current batch is only flushed (before setting the value)
+// when the value changes and batch geometry was drawn with this shader
+void rlSetShaderUniform(unsigned int id, int locIndex, const void *value, int uniformType, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int size = rlGetUniformComponents(uniformType)*count*4;     // NOTE: float and int values are 4 bytes
+
+    if (rlCheckThreadBatchUniform()) return;
+
+    if (rlPrepareUniformValue(id, locIndex, value, size))
+    {
+        rlEnableShader(id);
+        rlSetUniform(locIndex, value, uniformType, count);
+        rlStoreUniformValue(id, locIndex, value, size);
+    }
+#endif
+}
+
+// Set shader uniform matrix, skipped if already set
+void rlSetShaderUniformMatrix(unsigned int id, int locIndex, Matrix mat)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (rlCheckThreadBatchUniform()) return;
+
+    if (rlPrepareUniformValue(id, locIndex, &mat, sizeof(Matrix)))
+    {
+        rlEnableShader(id);
+        rlSetUniformMatrix(locIndex, mat);
+        rlStoreUniformValue(id, locIndex, &mat, sizeof(Matrix));
+    }
+#endif
+}
+
+// Set shader program binaries cache callbacks
+// NOTE: Must be set before rlglInit() to also cache default shader program
+void rlSetShaderCacheCallbacks(rlShaderCacheLoadCallback load, rlShaderCacheSaveCallback save)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.ShaderCache.load = load;
+    RLGL.ShaderCache.save = save;
+#endif
+}
+
+// Set shader currently active (id and locations)
+void rlSetShader(unsigned int id, int *locs)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.currentShaderId != id)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.currentShaderId = id;
+        RLGL.State.currentShaderLocs = locs;
+
+        // Recording a thread batch, shader is kept with the new batch and set on drawing
+        if (RLGL.threadBatch != NULL)
+        {
+            RLGL.threadBatch->shaderIds[RLGL.threadBatch->batchCount - 1] = id;
+            RLGL.threadBatch->shaderLocs[RLGL.threadBatch->batchCount - 1] = locs;
+        }
+    }
+#endif
+}
+
+// Load compute shader program
+unsigned int rlLoadComputeShaderProgram(unsigned int shaderId)
+{
+    rlRequireContext();
+
+    unsigned int program = 0;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    GLint success = 0;
+    program = glCreateProgram();
+    glAttachShader(program, shaderId);
+    glLinkProgram(program);
+
+    // NOTE: All uniform variables are intitialised to 0 when a program links
+
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link compute shader program", program);
+
+        int maxLength = 0;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+
+        if (maxLength > 0)
+        {
+            int length = 0;
+            char *log = ASC_CALLOC(maxLength, sizeof(char));
+            glGetProgramInfoLog(program, maxLength, &length, log);
+            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
+            ASC_FREE(log);
+        }
+
+        glDeleteProgram(program);
+
+        program = 0;
+    }
+    else
+    {
+        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
+        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
+        //GLint binarySize = 0;
+        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Compute shader program loaded successfully", program);
+    }
+#endif
+
+    return program;
+}
+
+// Dispatch compute shader (equivalent to *draw* for graphics pilepine)
+// NOTE: Dispatch is recorded while recording, so it is kept in order with batches draws
+void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned int groupZ)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (RLGL.currentCommands != NULL) { rlRecordCommand(RL_COMMAND_DISPATCH, groupX, groupY, groupZ, 0, 0); return; }
+
+    glDispatchCompute(groupX, groupY, groupZ);
+#endif
+}
+
+// Make compute shader buffers writes visible to following draws/dispatches reading them
+void rlComputeShaderBarrier(void)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (RLGL.currentCommands != NULL) { rlRecordCommand(RL_COMMAND_BARRIER, 0, 0, 0, 0, 0); return; }
+
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+#endif
+}
+
+// Load shader storage buffer object (SSBO)
+unsigned int rlLoadShaderBuffer(unsigned long long size, const void *data, int usageHint)
+{
+    rlRequireContext();
+
+    unsigned int ssbo = 0;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    glGenBuffers(1, &ssbo);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, size, data, usageHint? usageHint : RL_STREAM_COPY);
+#endif
+
+    return ssbo;
+}
+
+// Unload shader storage buffer object (SSBO)
+void rlUnloadShaderBuffer(unsigned int ssboId)
+{
+    rlRequireContext();
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    glDeleteBuffers(1, &ssboId);
+#endif
+}
+
+// Update SSBO buffer data
+void rlUpdateShaderBufferElements(unsigned int id, const void *data, unsigned long long dataSize, unsigned long long offset)
+{
+    rlRequireContext();
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, dataSize, data);
+#endif
+}
+
+// Get SSBO buffer size
+unsigned long long rlGetShaderBufferSize(unsigned int id)
+{
+    rlRequireContext();
+
+    long long size = 0;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glGetInteger64v(GL_SHADER_STORAGE_BUFFER_SIZE, &size);
+#endif
+
+    return (size > 0)? size : 0;
+}
+
+// Read SSBO buffer data
+void rlReadShaderBufferElements(unsigned int id, void *dest, unsigned long long count, unsigned long long offset)
+{
+    rlRequireContext();
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, count, dest);
+#endif
+}
+
+// Bind SSBO buffer
+void rlBindShaderBuffer(unsigned int id, unsigned int index)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (RLGL.currentCommands != NULL) { rlRecordCommand(RL_COMMAND_SHADER_BUFFER, id, index, 0, 0, 0); return; }
+
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, id);
+#endif
+}
+
+// Copy SSBO buffer data
+void rlCopyBuffersElements(unsigned int destId, unsigned int srcId, unsigned long long destOffset, unsigned long long srcOffset, unsigned long long count)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (RLGL.currentCommands != NULL)
+    {
+        unsigned long long copy[3] = { destOffset, srcOffset, count };
+        void *data = rlRecordCommand(RL_COMMAND_COPY_BUFFER, destId, srcId, 0, 0, sizeof(copy));
+        if (data != NULL) memcpy(data, copy, sizeof(copy));
+        return;
+    }
+
+    glBindBuffer(GL_COPY_READ_BUFFER, srcId);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, destId);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, srcOffset, destOffset, count);
+#endif
+}
+
+// Bind image texture
+void rlBindImageTexture(unsigned int id, unsigned int index, unsigned int format, int readonly)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (RLGL.currentCommands != NULL) { rlRecordCommand(RL_COMMAND_IMAGE_TEXTURE, id, index, format, readonly, 0); return; }
+
+    int glInternalFormat = 0, glFormat = 0, glType = 0;
+
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    glBindImageTexture(index, id, 0, 0, 0, readonly ? GL_READ_ONLY : GL_READ_WRITE, glInternalFormat);
+#endif
+}
+
+// Matrix state management
+//-----------------------------------------------------------------------------------------
+// Get internal modelview matrix
+Matrix rlGetMatrixModelview(void)
+{
+    Matrix matrix = rlMatrixIdentity();
+#if defined(GRAPHICS_API_OPENGL_11)
+    float mat[16];
+    glGetFloatv(GL_MODELVIEW_MATRIX, mat);
+    matrix.m0 = mat[0];
+    matrix.m1 = mat[1];
+    matrix.m2 = mat[2];
+    matrix.m3 = mat[3];
+    matrix.m4 = mat[4];
+    matrix.m5 = mat[5];
+    matrix.m6 = mat[6];
+    matrix.m7 = mat[7];
+    matrix.m8 = mat[8];
+    matrix.m9 = mat[9];
+    matrix.m10 = mat[10];
+    matrix.m11 = mat[11];
+    matrix.m12 = mat[12];
+    matrix.m13 = mat[13];
+    matrix.m14 = mat[14];
+    matrix.m15 = mat[15];
+#else
+    matrix = RLGL.State.modelview;
+#endif
+    return matrix;
+}
+
+// Get internal projection matrix
+Matrix rlGetMatrixProjection(void)
+{
+#if defined(GRAPHICS_API_OPENGL_11)
+    float mat[16];
+    glGetFloatv(GL_PROJECTION_MATRIX,mat);
+    Matrix m;
+    m.m0 = mat[0];
+    m.m1 = mat[1];
+    m.m2 = mat[2];
+    m.m3 = mat[3];
+    m.m4 = mat[4];
+    m.m5 = mat[5];
+    m.m6 = mat[6];
+    m.m7 = mat[7];
+    m.m8 = mat[8];
+    m.m9 = mat[9];
+    m.m10 = mat[10];
+    m.m11 = mat[11];
+    m.m12 = mat[12];
+    m.m13 = mat[13];
+    m.m14 = mat[14];
+    m.m15 = mat[15];
+    return m;
+#else
+    return RLGL.State.projection;
 #endif
-
-    return id;
 }
 
-// Load a new attributes element buffer
-unsigned int rlLoadVertexBufferElement(void *buffer, int size, bool dynamic)
+// Get internal accumulated transform matrix
+Matrix rlGetMatrixTransform(void)
 {
-    unsigned int id = 0;
-
+    Matrix mat = rlMatrixIdentity();
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glGenBuffers(1, &id);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+    // TODO: Consider possible transform matrices in the RLGL.State.stack
+    // Is this the right order? or should we start with the first stored matrix instead of the last one?
+    //Matrix matStackTransform = rlMatrixIdentity();
+    //for (int i = RLGL.State.stackCounter; i > 0; i--) matStackTransform = rlMatrixMultiply(RLGL.State.stack[i], matStackTransform);
+    mat = RLGL.State.transform;
 #endif
-
-    return id;
+    return mat;
 }
 
-// Enable vertex buffer (VBO)
-void rlEnableVertexBuffer(unsigned int id)
+// Get internal projection matrix for stereo render (selected eye)
+RLAPI Matrix rlGetMatrixProjectionStereo(int eye)
 {
+    Matrix mat = rlMatrixIdentity();
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, id);
+    mat = RLGL.State.projectionStereo[eye];
 #endif
+    return mat;
 }
 
-// Disable vertex buffer (VBO)
-void rlDisableVertexBuffer(void)
+// Get internal view offset matrix for stereo render (selected eye)
+RLAPI Matrix rlGetMatrixViewOffsetStereo(int eye)
 {
+    Matrix mat = rlMatrixIdentity();
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    mat = RLGL.State.viewOffsetStereo[eye];
 #endif
+    return mat;
 }
 
-// Enable vertex buffer element (VBO element)
-void rlEnableVertexBufferElement(unsigned int id)
+// Set a custom modelview matrix (replaces internal modelview matrix)
+void rlSetMatrixModelview(Matrix view)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+    RLGL.State.modelview = view;
+    rlUpdateMatrixState();
 #endif
 }
 
-// Disable vertex buffer element (VBO element)
-void rlDisableVertexBufferElement(void)
+// Set a custom projection matrix (replaces internal projection matrix)
+void rlSetMatrixProjection(Matrix projection)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    RLGL.State.projection = projection;
+    rlUpdateMatrixState();
 #endif
 }
 
-// Update vertex buffer with new data
-// NOTE: dataSize and offset must be provided in bytes
-void rlUpdateVertexBuffer(unsigned int id, void *data, int dataSize, int offset)
+// Set eyes projection matrices for stereo rendering
+void rlSetMatrixProjectionStereo(Matrix right, Matrix left)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, id);
-    glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
+    RLGL.State.projectionStereo[0] = right;
+    RLGL.State.projectionStereo[1] = left;
 #endif
 }
 
-// Update vertex buffer elements with new data
-// NOTE: dataSize and offset must be provided in bytes
-void rlUpdateVertexBufferElements(unsigned int id, void *data, int dataSize, int offset)
+// Set eyes view offsets matrices for stereo rendering
+void rlSetMatrixViewOffsetStereo(Matrix right, Matrix left)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
-    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
+    RLGL.State.viewOffsetStereo[0] = right;
+    RLGL.State.viewOffsetStereo[1] = left;
 #endif
 }
 
-// Enable vertex array object (VAO)
-bool rlEnableVertexArray(unsigned int vaoId)
+// Load and draw a quad in NDC
+void rlLoadDrawQuad(void)
 {
-    bool result = false;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao)
-    {
-        glBindVertexArray(vaoId);
-        result = true;
-    }
-#endif
-    return result;
-}
+    unsigned int quadVAO = 0;
+    unsigned int quadVBO = 0;
 
-// Disable vertex array object (VAO)
-void rlDisableVertexArray(void)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
-#endif
-}
+    float vertices[] = {
+         // Positions         Texcoords
+        -1.0f,  1.0f, 0.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f, 0.0f,   0.0f, 0.0f,
+         1.0f,  1.0f, 0.0f,   1.0f, 1.0f,
+         1.0f, -1.0f, 0.0f,   1.0f, 0.0f,
+    };
 
-// Enable vertex attribute index
-void rlEnableVertexAttribute(unsigned int index)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glEnableVertexAttribArray(index);
+    // Gen VAO to contain VBO
+    glGenVertexArrays(1, &quadVAO);
+    rlCacheBindVertexArray(quadVAO);
+
+    // Gen and fill vertex buffer (VBO)
+    glGenBuffers(1, &quadVBO);
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), &vertices, GL_STATIC_DRAW);
+
+    // Bind vertex attributes (position, texcoords)
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)0); // Positions
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)(3*sizeof(float))); // Texcoords
+
+    // Draw quad
+    rlCacheBindVertexArray(quadVAO);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    rlCacheBindVertexArray(0);
+
+    // Delete buffers (VBO and VAO)
+    glDeleteBuffers(1, &quadVBO);
+    glDeleteVertexArrays(1, &quadVAO);
+    rlInvalidateStateCache();
 #endif
 }
 
-// Disable vertex attribute index
-void rlDisableVertexAttribute(unsigned int index)
+// Load and draw a cube in NDC
+void rlLoadDrawCube(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glDisableVertexAttribArray(index);
-#endif
-}
+    unsigned int cubeVAO = 0;
+    unsigned int cubeVBO = 0;
 
-// Draw vertex array
-void rlDrawVertexArray(int offset, int count)
-{
-    glDrawArrays(GL_TRIANGLES, offset, count);
+    float vertices[] = {
+         // Positions          Normals               Texcoords
+        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
+         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
+         1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 0.0f,
+         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
+        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
+        -1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
+         1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 0.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
+        -1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
+        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+        -1.0f,  1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
+        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
+        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+         1.0f,  1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
+         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+         1.0f, -1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
+        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
+         1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 1.0f,
+         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
+         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
+        -1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 0.0f,
+        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
+         1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
+        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 0.0f
+    };
+
+    // Gen VAO to contain VBO
+    glGenVertexArrays(1, &cubeVAO);
+    rlCacheBindVertexArray(cubeVAO);
+
+    // Gen and fill vertex buffer (VBO)
+    glGenBuffers(1, &cubeVBO);
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+    // Bind vertex attributes (position, normals, texcoords)
+    rlCacheBindVertexArray(cubeVAO);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)0); // Positions
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(3*sizeof(float))); // Normals
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(6*sizeof(float))); // Texcoords
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, 0);
+    rlCacheBindVertexArray(0);
+
+    // Draw cube
+    rlCacheBindVertexArray(cubeVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 36);
+    rlCacheBindVertexArray(0);
+
+    // Delete VBO and VAO
+    glDeleteBuffers(1, &cubeVBO);
+    glDeleteVertexArrays(1, &cubeVAO);
+    rlInvalidateStateCache();
+#endif
 }
 
-// Draw vertex array elements
-void rlDrawVertexArrayElements(int offset, int count, void *buffer)
+// Get name string for pixel format
+const char *rlGetPixelFormatName(unsigned int format)
 {
-    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (unsigned short *)buffer + offset);
+    switch (format)
+    {
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: return "GRAYSCALE"; break;         // 8 bit per pixel (no alpha)
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: return "GRAY_ALPHA"; break;       // 8*2 bpp (2 channels)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: return "R5G6B5"; break;               // 16 bpp
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: return "R8G8B8"; break;               // 24 bpp
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: return "R5G5B5A1"; break;           // 16 bpp (1 bit alpha)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: return "R4G4B4A4"; break;           // 16 bpp (4 bit alpha)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: return "R8G8B8A8"; break;           // 32 bpp
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: return "R32"; break;                     // 32 bpp (1 channel - float)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: return "R32G32B32"; break;         // 32*3 bpp (3 channels - float)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: return "R32G32B32A32"; break;   // 32*4 bpp (4 channels - float)
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: return "DXT1_RGB"; break;             // 4 bpp (no alpha)
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: return "DXT1_RGBA"; break;           // 4 bpp (1 bit alpha)
+        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: return "DXT3_RGBA"; break;           // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: return "DXT5_RGBA"; break;           // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: return "ETC1_RGB"; break;             // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: return "ETC2_RGB"; break;             // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: return "ETC2_RGBA"; break;       // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: return "PVRT_RGB"; break;             // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: return "PVRT_RGBA"; break;           // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: return "ASTC_4x4_RGBA"; break;   // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: return "ASTC_8x8_RGBA"; break;   // 2 bpp
+        default: return "UNKNOWN"; break;
+    }
 }
 
-// Draw vertex array instanced
-void rlDrawVertexArrayInstanced(int offset, int count, int instances)
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Make sure OpenGL context is available for direct calls while recording
+static void rlRequireContext(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+    if ((RLGL.currentCommands != NULL) && (RLGL.contextCallback != NULL)) RLGL.contextCallback();
 #endif
 }
 
-// Draw vertex array elements instanced
-void rlDrawVertexArrayElementsInstanced(int offset, int count, void *buffer, int instances)
+// Bind GL_TEXTURE_2D on active unit (skipped if already bound)
+// NOTE: Only default and batch texture units are cached, other units always bind
+static void rlCacheBindTexture(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (unsigned short *)buffer + offset, instances);
-#endif
-}
+    int unit = RLGL.Cache.activeTextureUnit;
 
-#if defined(GRAPHICS_API_OPENGL_11)
-// Enable vertex state pointer
-void rlEnableStatePointer(int vertexAttribType, void *buffer)
-{
-    if (buffer != NULL) glEnableClientState(vertexAttribType);
-    switch (vertexAttribType)
+    if ((unit >= 0) && (unit < RL_CACHE_TEXTURE_UNITS))
     {
-        case GL_VERTEX_ARRAY: glVertexPointer(3, GL_FLOAT, 0, buffer); break;
-        case GL_TEXTURE_COORD_ARRAY: glTexCoordPointer(2, GL_FLOAT, 0, buffer); break;
-        case GL_NORMAL_ARRAY: if (buffer != NULL) glNormalPointer(GL_FLOAT, 0, buffer); break;
-        case GL_COLOR_ARRAY: if (buffer != NULL) glColorPointer(4, GL_UNSIGNED_BYTE, 0, buffer); break;
-        //case GL_INDEX_ARRAY: if (buffer != NULL) glIndexPointer(GL_SHORT, 0, buffer); break; // Indexed colors
-        default: break;
+        if (RLGL.Cache.textureId[unit] == id) { RLGL.Cache.elided++; return; }
+        RLGL.Cache.textureId[unit] = id;
     }
-}
 
-// Disable vertex state pointer
-void rlDisableStatePointer(int vertexAttribType)
-{
-    glDisableClientState(vertexAttribType);
-}
+    RLGL.Cache.issued++;
 #endif
+    glBindTexture(GL_TEXTURE_2D, id);
+}
 
-// Load vertex array object (VAO)
-unsigned int rlLoadVertexArray(void)
+// Enable/disable capability (skipped if already set)
+// NOTE: Only blend, depth test, cull face and scissor test are cached
+static void rlCacheCapability(int capability, bool enabled)
 {
-    unsigned int vaoId = 0;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao)
+    int index = -1;
+
+    switch (capability)
+    {
+        case GL_BLEND: index = 0; break;
+        case GL_DEPTH_TEST: index = 1; break;
+        case GL_CULL_FACE: index = 2; break;
+        case GL_SCISSOR_TEST: index = 3; break;
+        default: break;
+    }
+
+    if (index >= 0)
     {
-        glGenVertexArrays(1, &vaoId);
+        if (RLGL.Cache.capability[index] == (int)enabled) { RLGL.Cache.elided++; return; }
+        RLGL.Cache.capability[index] = (int)enabled;
     }
-#endif
-    return vaoId;
-}
 
-// Set vertex attribute
-void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, void *pointer)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glVertexAttribPointer(index, compSize, type, normalized, stride, pointer);
+    RLGL.Cache.issued++;
 #endif
+    if (enabled) glEnable(capability);
+    else glDisable(capability);
 }
 
-// Set vertex attribute divisor
-void rlSetVertexAttributeDivisor(unsigned int index, int divisor)
+// Set scissor rectangle (skipped if already set)
+static void rlCacheScissor(int x, int y, int width, int height)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glVertexAttribDivisor(index, divisor);
+    if ((RLGL.Cache.scissor[0] == x) && (RLGL.Cache.scissor[1] == y) &&
+        (RLGL.Cache.scissor[2] == width) && (RLGL.Cache.scissor[3] == height)) { RLGL.Cache.elided++; return; }
+
+    RLGL.Cache.scissor[0] = x;
+    RLGL.Cache.scissor[1] = y;
+    RLGL.Cache.scissor[2] = width;
+    RLGL.Cache.scissor[3] = height;
+    RLGL.Cache.issued++;
 #endif
+    glScissor(x, y, width, height);
 }
 
-// Unload vertex array object (VAO)
-void rlUnloadVertexArray(unsigned int vaoId)
+#if defined(RLGL_ENABLE_THREAD_BATCHES) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+// Start recording next batch of thread batch (current one full)
+// NOTE: Batches are reused between frames, only vertex data arrays are required (no indices, no VBOs)
+static void rlNextThreadBatch(rlThreadBatch *batch)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao)
+    if (batch->batchCount == batch->batchCapacity)
     {
-        glBindVertexArray(0);
-        glDeleteVertexArrays(1, &vaoId);
-        TRACELOG(RL_LOG_INFO, "VAO: [ID %i] Unloaded vertex array data from VRAM (GPU)", vaoId);
+        rlRenderBatch *batches = (rlRenderBatch *)ASC_REALLOC(batch->batches, (batch->batchCapacity + 1)*sizeof(rlRenderBatch));
+        batch->modelviews = (float *)ASC_REALLOC(batch->modelviews, (batch->batchCapacity + 1)*16*sizeof(float));
+        batch->blendModes = (int *)ASC_REALLOC(batch->blendModes, (batch->batchCapacity + 1)*sizeof(int));
+        batch->shaderIds = (unsigned int *)ASC_REALLOC(batch->shaderIds, (batch->batchCapacity + 1)*sizeof(unsigned int));
+        batch->shaderLocs = (int **)ASC_REALLOC(batch->shaderLocs, (batch->batchCapacity + 1)*sizeof(int *));
+        rlRenderBatch *recorded = &batches[batch->batchCapacity];
+        memset(recorded, 0, sizeof(rlRenderBatch));
+
+        recorded->bufferCount = 1;
+        recorded->vertexBuffer = (rlVertexBuffer *)ASC_CALLOC(1, sizeof(rlVertexBuffer));
+        recorded->vertexBuffer[0].elementCount = batch->bufferElements;
+        recorded->vertexBuffer[0].vertices = (float *)ASC_MALLOC(batch->bufferElements*3*4*sizeof(float));
+        recorded->vertexBuffer[0].texcoords = (float *)ASC_MALLOC(batch->bufferElements*2*4*sizeof(float));
+        recorded->vertexBuffer[0].colors = (unsigned char *)ASC_MALLOC(batch->bufferElements*4*4*sizeof(unsigned char));
+        recorded->vertexBuffer[0].texunits = (unsigned char *)ASC_MALLOC(batch->bufferElements*4*sizeof(unsigned char));
+        recorded->vertexBuffer[0].shapes = (float *)ASC_MALLOC(batch->bufferElements*4*4*sizeof(float));
+        recorded->draws = (rlDrawCall *)ASC_MALLOC(RL_DEFAULT_BATCH_DRAWCALLS*sizeof(rlDrawCall));
+        recorded->drawCapacity = RL_DEFAULT_BATCH_DRAWCALLS;
+
+        batch->batches = batches;
+        batch->batchCapacity++;
     }
-#endif
+
+    rlRenderBatch *recorded = &batch->batches[batch->batchCount];
+    batch->blendModes[batch->batchCount] = RLGL.State.currentBlendMode;
+    batch->shaderIds[batch->batchCount] = RLGL.State.currentShaderId;
+    batch->shaderLocs[batch->batchCount] = RLGL.State.currentShaderLocs;
+    batch->batchCount++;
+
+    for (int i = 0; i < recorded->drawCapacity; i++)
+    {
+        recorded->draws[i].mode = RL_QUADS;
+        recorded->draws[i].vertexCount = 0;
+        recorded->draws[i].vertexAlignment = 0;
+        recorded->draws[i].textureId = RLGL.State.defaultTextureId;
+        recorded->draws[i].extraTextureCount = 0;
+    }
+
+    recorded->drawCounter = 1;
+    recorded->shapeVertexCount = 0;
+    recorded->currentDepth = (RLGL.State.depthLayer >= 0)? RL_DEPTH_LAYER_Z(RLGL.State.depthLayer) : -1.0f;
+
+    RLGL.currentBatch = recorded;
+    RLGL.State.vertexCounter = 0;
+    RLGL.State.textureUnit = 0;
 }
+#endif
 
-// Unload vertex buffer (VBO)
-void rlUnloadVertexBuffer(unsigned int vboId)
-{
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glDeleteBuffers(1, &vboId);
-    //TRACELOG(RL_LOG_INFO, "VBO: Unloaded vertex data from VRAM (GPU)");
-#endif
+// Compare quads depth, nearer quads first (greater z with default ortho projection), same depth keeps submission order
+static int rlCompareQuadDepth(const void *a, const void *b)
+{
+    const rlQuadDepth *quadA = (const rlQuadDepth *)a;
+    const rlQuadDepth *quadB = (const rlQuadDepth *)b;
+
+    if (quadA->depth != quadB->depth) return (quadA->depth > quadB->depth)? -1 : 1;
+
+    return quadA->index - quadB->index;
 }
 
-// Shaders management
-//-----------------------------------------------------------------------------------------------
-// Load shader from code strings
-// NOTE: If shader string is NULL, using default vertex/fragment shaders
-unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
+// Reorder quads data (quadSize bytes per quad) in sorted order, scratch must fit all quads data
+static void rlReorderQuads(void *data, int quadSize, const rlQuadDepth *quads, int quadCount, unsigned char *scratch)
 {
-    unsigned int id = 0;
+    memcpy(scratch, data, quadCount*quadSize);
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned int vertexShaderId = RLGL.State.defaultVShaderId;
-    unsigned int fragmentShaderId = RLGL.State.defaultFShaderId;
+    for (int i = 0; i < quadCount; i++) memcpy((unsigned char *)data + i*quadSize, scratch + quads[i].index*quadSize, quadSize);
+}
 
-    if (vsCode != NULL) vertexShaderId = rlCompileShader(vsCode, GL_VERTEX_SHADER);
-    if (fsCode != NULL) fragmentShaderId = rlCompileShader(fsCode, GL_FRAGMENT_SHADER);
+// Sort quads of every batch draw call front to back (by depth), vertex data is reordered in place
+// NOTE: Only valid on opaque mode, depth test resolves layering and blending order is not relevant
+static void rlSortBatchQuads(rlRenderBatch *batch)
+{
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
 
-    if ((vertexShaderId == RLGL.State.defaultVShaderId) && (fragmentShaderId == RLGL.State.defaultFShaderId)) id = RLGL.State.defaultShaderId;
-    else
+    for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
     {
-        id = rlLoadShaderProgram(vertexShaderId, fragmentShaderId);
+        int quadCount = batch->draws[i].vertexCount/4;
 
-        if (vertexShaderId != RLGL.State.defaultVShaderId)
-        {
-            // Detach shader before deletion to make sure memory is freed
-            glDetachShader(id, vertexShaderId);
-            glDeleteShader(vertexShaderId);
-        }
-        if (fragmentShaderId != RLGL.State.defaultFShaderId)
+        if ((batch->draws[i].mode == RL_QUADS) && (quadCount > 1))
         {
-            // Detach shader before deletion to make sure memory is freed
-            glDetachShader(id, fragmentShaderId);
-            glDeleteShader(fragmentShaderId);
-        }
+            // Quads already sorted are not reordered (i.e. all quads in one layer)
+            bool sorted = true;
+            for (int q = 1; (q < quadCount) && sorted; q++) sorted = (buffer->vertices[3*(vertexOffset + 4*q) + 2] <= buffer->vertices[3*(vertexOffset + 4*(q - 1)) + 2]);
 
-        if (id == 0)
-        {
-            TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load custom shader code");
-            id = RLGL.State.defaultShaderId;
-        }
-    }
+            if (!sorted)
+            {
+                if (quadCount > RLGL.Sort.capacity)
+                {
+                    RLGL.Sort.capacity = quadCount;
+                    RLGL.Sort.quads = (rlQuadDepth *)ASC_REALLOC(RLGL.Sort.quads, RLGL.Sort.capacity*sizeof(rlQuadDepth));
+                    RLGL.Sort.scratch = (unsigned char *)ASC_REALLOC(RLGL.Sort.scratch, RLGL.Sort.capacity*4*4*sizeof(float));    // Biggest quad data: shapes
+                }
 
-    // Get available shader uniforms
-    // NOTE: This information is useful for debug...
-    int uniformCount = -1;
+                rlQuadDepth *quads = RLGL.Sort.quads;
+                unsigned char *scratch = RLGL.Sort.scratch;
 
-    glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &uniformCount);
+                for (int q = 0; q < quadCount; q++)
+                {
+                    quads[q].depth = buffer->vertices[3*(vertexOffset + 4*q) + 2];
+                    quads[q].index = q;
+                }
 
-    for (int i = 0; i < uniformCount; i++)
-    {
-        int namelen = -1;
-        int num = -1;
-        char name[256] = { 0 };     // Assume no variable names longer than 256
-        GLenum type = GL_ZERO;
+                qsort(quads, quadCount, sizeof(rlQuadDepth), rlCompareQuadDepth);
 
-        // Get the name of the uniforms
-        glGetActiveUniform(id, i, sizeof(name) - 1, &namelen, &num, &type, name);
+                rlReorderQuads(buffer->vertices + 3*vertexOffset, 3*4*sizeof(float), quads, quadCount, scratch);
+                rlReorderQuads(buffer->texcoords + 2*vertexOffset, 2*4*sizeof(float), quads, quadCount, scratch);
+                rlReorderQuads(buffer->colors + 4*vertexOffset, 4*4*sizeof(unsigned char), quads, quadCount, scratch);
+                rlReorderQuads(buffer->texunits + vertexOffset, 4*sizeof(unsigned char), quads, quadCount, scratch);
 
-        name[namelen] = 0;
+                // Shape parameters are only uploaded up to last shape vertex, draw call could have shapes moved after it
+                if (batch->shapeVertexCount > vertexOffset)
+                {
+                    rlReorderQuads(buffer->shapes + 4*vertexOffset, 4*4*sizeof(float), quads, quadCount, scratch);
+                    if (batch->shapeVertexCount < (vertexOffset + 4*quadCount)) batch->shapeVertexCount = vertexOffset + 4*quadCount;
+                }
+            }
+        }
 
-        TRACELOGD("SHADER: [ID %i] Active uniform (%s) set at location: %i", id, name, glGetUniformLocation(id, name));
+        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
     }
-#endif
-
-    return id;
 }
 
-// Compile custom shader and return shader id
-unsigned int rlCompileShader(const char *shaderCode, int type)
+// Load default shader (just vertex positioning and texture coloring)
+// NOTE: This shader program is used for internal buffers
+// NOTE: Loaded: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
+static void rlLoadShaderDefault(void)
 {
-    unsigned int shader = 0;
+    RLGL.State.defaultShaderLocs = (int *)ASC_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    shader = glCreateShader(type);
-    glShaderSource(shader, 1, &shaderCode, NULL);
+    // NOTE: All locations must be reseted to -1 (no location)
+    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.defaultShaderLocs[i] = -1;
 
-    GLint success = 0;
-    glCompileShader(shader);
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    // Vertex shader directly defined, no external file required
+    const char *defaultVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute float vertexTexUnit;     \n"
+    "attribute vec4 vertexShape;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexUnit;         \n"
+    "varying vec4 fragShape;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in float vertexTexUnit;            \n"
+    "in vec4 vertexShape;               \n"
+    "in float vertexDrawUnit;           \n"     // Draw textures units base (multi-draw indirect), 0 otherwise
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+    "out float fragTexUnit;             \n"
+    "out vec4 fragShape;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute float vertexTexUnit;     \n"
+    "attribute vec4 vertexShape;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexUnit;         \n"
+    "varying vec4 fragShape;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    fragTexUnit = vertexTexUnit;   \n"
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    "    if (vertexTexUnit < 7.5) fragTexUnit += vertexDrawUnit; \n"
+#endif
+    "    fragShape = vertexShape;       \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
 
-    if (success == GL_FALSE)
-    {
-        switch (type)
-        {
-            case GL_VERTEX_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile vertex shader code", shader); break;
-            case GL_FRAGMENT_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile fragment shader code", shader); break;
-            //case GL_GEOMETRY_SHADER:
-        #if defined(GRAPHICS_API_OPENGL_43)
-            case GL_COMPUTE_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile compute shader code", shader); break;
-        #endif
-            default: break;
-        }
+    // Fragment shader directly defined, no external file required
+    const char *defaultFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#endif
 
-        int maxLength = 0;
-        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+    // Batch fragment shader, samples up to 8 textures selected by vertex texture unit (multi-texture batching)
+    // or evaluates a shape signed distance field (vertex texture units over 7, see rlSetShape())
+    // NOTE: Only used by default shader program, custom shaders are combined with single texture fragment shader
+    const char *defaultBatchFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexUnit;         \n"
+    "varying vec4 fragShape;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform sampler2D batchTextures[7]; \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = vec4(1.0);   \n"
+    "    if (fragTexUnit > 7.5)         \n"     // Shape: signed distance from fragment position (fragTexCoord) to shape border
+    "    {                              \n"
+    "        float d = 0.0;             \n"
+    "        if (mod(floor(fragTexUnit + 0.5), 2.0) < 0.5) \n"   // Rounded box (units 8, 10): half size (xy), corners radius (z), unit rounded (interpolated)
+    "        {                          \n"
+    "            vec2 q = abs(fragTexCoord) - fragShape.xy + fragShape.z; \n"
+    "            d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - fragShape.z; \n"
+    "        }                          \n"
+    "        else                       \n"     // Ellipse: radius (xy), distance approximation
+    "        {                          \n"
+    "            float k0 = length(fragTexCoord/fragShape.xy); \n"
+    "            float k1 = length(fragTexCoord/(fragShape.xy*fragShape.xy)); \n"
+    "            d = (k1 > 0.0)? k0*(k0 - 1.0)/k1 : -min(fragShape.x, fragShape.y); \n"
+    "        }                          \n"
+    "        if (fragShape.w > 0.0) d = abs(d + fragShape.w*0.5) - fragShape.w*0.5; \n"    // Outline (thickness inside border)
+    "        vec2 w = fwidth(fragTexCoord); \n"
+    "        texelColor.a = clamp(0.5 - d/max(0.5*(w.x + w.y), 0.0001), 0.0, 1.0); \n"   // Anti-aliasing: distance in pixels
+    "        if (fragTexUnit > 9.5) texelColor.rgb = vec3(texelColor.a); \n"     // Premultiplied alpha (units 10, 11): coverage scales color
+    "    }                              \n"
+    "    else if (fragTexUnit < 0.5) texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    else if (fragTexUnit < 1.5) texelColor = texture2D(batchTextures[0], fragTexCoord); \n"
+    "    else if (fragTexUnit < 2.5) texelColor = texture2D(batchTextures[1], fragTexCoord); \n"
+    "    else if (fragTexUnit < 3.5) texelColor = texture2D(batchTextures[2], fragTexCoord); \n"
+    "    else if (fragTexUnit < 4.5) texelColor = texture2D(batchTextures[3], fragTexCoord); \n"
+    "    else if (fragTexUnit < 5.5) texelColor = texture2D(batchTextures[4], fragTexCoord); \n"
+    "    else if (fragTexUnit < 6.5) texelColor = texture2D(batchTextures[5], fragTexCoord); \n"
+    "    else texelColor = texture2D(batchTextures[6], fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "#ifdef RL_ALPHA_TEST               \n"     // Opaque mode: transparent fragments do not write depth
+    "    if (gl_FragColor.a < 0.5) discard; \n"
+    "#endif                             \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "in float fragTexUnit;              \n"
+    "in vec4 fragShape;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform sampler2D batchTextures[7]; \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 dx = dFdx(fragTexCoord);  \n"     // Derivatives computed out of non-uniform control flow (mipmaps)
+    "    vec2 dy = dFdy(fragTexCoord);  \n"
+    "    vec4 texelColor = vec4(1.0);   \n"
+    "    if (fragTexUnit > 7.5)         \n"     // Shape: signed distance from fragment position (fragTexCoord) to shape border
+    "    {                              \n"
+    "        float d = 0.0;             \n"
+    "        if (mod(floor(fragTexUnit + 0.5), 2.0) < 0.5) \n"   // Rounded box (units 8, 10): half size (xy), corners radius (z), unit rounded (interpolated)
+    "        {                          \n"
+    "            vec2 q = abs(fragTexCoord) - fragShape.xy + fragShape.z; \n"
+    "            d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - fragShape.z; \n"
+    "        }                          \n"
+    "        else                       \n"     // Ellipse: radius (xy), distance approximation
+    "        {                          \n"
+    "            float k0 = length(fragTexCoord/fragShape.xy); \n"
+    "            float k1 = length(fragTexCoord/(fragShape.xy*fragShape.xy)); \n"
+    "            d = (k1 > 0.0)? k0*(k0 - 1.0)/k1 : -min(fragShape.x, fragShape.y); \n"
+    "        }                          \n"
+    "        if (fragShape.w > 0.0) d = abs(d + fragShape.w*0.5) - fragShape.w*0.5; \n"    // Outline (thickness inside border)
+    "        texelColor.a = clamp(0.5 - d/max(0.5*(length(dx) + length(dy)), 0.0001), 0.0, 1.0); \n"   // Anti-aliasing: distance in pixels
+    "        if (fragTexUnit > 9.5) texelColor.rgb = vec3(texelColor.a); \n"     // Premultiplied alpha (units 10, 11): coverage scales color
+    "    }                              \n"
+    "    else if (fragTexUnit < 0.5) texelColor = textureGrad(texture0, fragTexCoord, dx, dy); \n"
+    "    else if (fragTexUnit < 1.5) texelColor = textureGrad(batchTextures[0], fragTexCoord, dx, dy); \n"
+    "    else if (fragTexUnit < 2.5) texelColor = textureGrad(batchTextures[1], fragTexCoord, dx, dy); \n"
+    "    else if (fragTexUnit < 3.5) texelColor = textureGrad(batchTextures[2], fragTexCoord, dx, dy); \n"
+    "    else if (fragTexUnit < 4.5) texelColor = textureGrad(batchTextures[3], fragTexCoord, dx, dy); \n"
+    "    else if (fragTexUnit < 5.5) texelColor = textureGrad(batchTextures[4], fragTexCoord, dx, dy); \n"
+    "    else if (fragTexUnit < 6.5) texelColor = textureGrad(batchTextures[5], fragTexCoord, dx, dy); \n"
+    "    else texelColor = textureGrad(batchTextures[6], fragTexCoord, dx, dy); \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "#ifdef RL_ALPHA_TEST               \n"     // Opaque mode: transparent fragments do not write depth
+    "    if (finalColor.a < 0.5) discard; \n"
+    "#endif                             \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "#ifdef GL_OES_standard_derivatives \n"     // Derivatives required for shapes anti-aliasing (if available)
+    "#extension GL_OES_standard_derivatives : enable \n"
+    "#endif                             \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexUnit;         \n"
+    "varying vec4 fragShape;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform sampler2D batchTextures[7]; \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = vec4(1.0);   \n"
+    "    if (fragTexUnit > 7.5)         \n"     // Shape: signed distance from fragment position (fragTexCoord) to shape border
+    "    {                              \n"
+    "        float d = 0.0;             \n"
+    "        if (mod(floor(fragTexUnit + 0.5), 2.0) < 0.5) \n"   // Rounded box (units 8, 10): half size (xy), corners radius (z), unit rounded (interpolated)
+    "        {                          \n"
+    "            vec2 q = abs(fragTexCoord) - fragShape.xy + fragShape.z; \n"
+    "            d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - fragShape.z; \n"
+    "        }                          \n"
+    "        else                       \n"     // Ellipse: radius (xy), distance approximation
+    "        {                          \n"
+    "            float k0 = length(fragTexCoord/fragShape.xy); \n"
+    "            float k1 = length(fragTexCoord/(fragShape.xy*fragShape.xy)); \n"
+    "            d = (k1 > 0.0)? k0*(k0 - 1.0)/k1 : -min(fragShape.x, fragShape.y); \n"
+    "        }                          \n"
+    "        if (fragShape.w > 0.0) d = abs(d + fragShape.w*0.5) - fragShape.w*0.5; \n"    // Outline (thickness inside border)
+    "#ifdef GL_OES_standard_derivatives \n"
+    "        vec2 w = fwidth(fragTexCoord); \n"
+    "        texelColor.a = clamp(0.5 - d/max(0.5*(w.x + w.y), 0.0001), 0.0, 1.0); \n"   // Anti-aliasing: distance in pixels
+    "#else                              \n"
+    "        texelColor.a = clamp(0.5 - d, 0.0, 1.0); \n"     // Shape units considered pixels
+    "#endif                             \n"
+    "        if (fragTexUnit > 9.5) texelColor.rgb = vec3(texelColor.a); \n"     // Premultiplied alpha (units 10, 11): coverage scales color
+    "    }                              \n"
+    "    else if (fragTexUnit < 0.5) texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    else if (fragTexUnit < 1.5) texelColor = texture2D(batchTextures[0], fragTexCoord); \n"
+    "    else if (fragTexUnit < 2.5) texelColor = texture2D(batchTextures[1], fragTexCoord); \n"
+    "    else if (fragTexUnit < 3.5) texelColor = texture2D(batchTextures[2], fragTexCoord); \n"
+    "    else if (fragTexUnit < 4.5) texelColor = texture2D(batchTextures[3], fragTexCoord); \n"
+    "    else if (fragTexUnit < 5.5) texelColor = texture2D(batchTextures[4], fragTexCoord); \n"
+    "    else if (fragTexUnit < 6.5) texelColor = texture2D(batchTextures[5], fragTexCoord); \n"
+    "    else texelColor = texture2D(batchTextures[6], fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "#ifdef RL_ALPHA_TEST               \n"     // Opaque mode: transparent fragments do not write depth
+    "    if (gl_FragColor.a < 0.5) discard; \n"
+    "#endif                             \n"
+    "}                                  \n";
+#endif
 
-        if (maxLength > 0)
-        {
-            int length = 0;
-            char *log = ASC_CALLOC(maxLength, sizeof(char));
-            glGetShaderInfoLog(shader, maxLength, &length, log);
-            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Compile error: %s", shader, log);
-            ASC_FREE(log);
-        }
-    }
-    else
+    RLGL.State.defaultVShaderCode = defaultVShaderCode;
+    RLGL.State.defaultFShaderCode = defaultFShaderCode;
+    RLGL.State.defaultBatchFShaderCode = defaultBatchFShaderCode;
+
+    // Try loading default program from binary cache
+    char cacheKey[RL_SHADER_CACHE_KEY_SIZE] = { 0 };
+    if (rlGetShaderCacheKey(defaultVShaderCode, defaultBatchFShaderCode, cacheKey)) RLGL.State.defaultShaderId = rlLoadShaderBinary(cacheKey);
+
+    if (RLGL.State.defaultShaderId == 0)
     {
-        switch (type)
-        {
-            case GL_VERTEX_SHADER: TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Vertex shader compiled successfully", shader); break;
-            case GL_FRAGMENT_SHADER: TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Fragment shader compiled successfully", shader); break;
-            //case GL_GEOMETRY_SHADER:
-        #if defined(GRAPHICS_API_OPENGL_43)
-            case GL_COMPUTE_SHADER: TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Compute shader compiled successfully", shader); break;
-        #endif
-            default: break;
-        }
+        // NOTE: Compiled vertex shader is kept for re-use, default fragment shader is compiled on demand
+        RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
+        unsigned int batchFShaderId = rlCompileShader(defaultBatchFShaderCode, GL_FRAGMENT_SHADER);   // Compile batch fragment shader
+
+        RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, batchFShaderId);
+
+        glDetachShader(RLGL.State.defaultShaderId, batchFShaderId);
+        glDeleteShader(batchFShaderId);
+
+        if ((RLGL.State.defaultShaderId > 0) && (cacheKey[0] != '\0')) rlSaveShaderBinary(RLGL.State.defaultShaderId, cacheKey);
     }
-#endif
 
-    return shader;
+    if (RLGL.State.defaultShaderId > 0)
+    {
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader loaded successfully", RLGL.State.defaultShaderId);
+
+        // Set default shader locations: attributes locations
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexPosition");
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexTexCoord");
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexColor");
+
+        // Set default shader locations: uniform locations
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_MVP]  = glGetUniformLocation(RLGL.State.defaultShaderId, "mvp");
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "colDiffuse");
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "texture0");
+
+        // Set additional samplers texture units (multi-texture batching), sampler2D texture0 is set on batch draw
+        int batchUnits[7] = { 1, 2, 3, 4, 5, 6, 7 };
+        rlCacheUseProgram(RLGL.State.defaultShaderId);
+        glUniform1iv(glGetUniformLocation(RLGL.State.defaultShaderId, "batchTextures"), 7, batchUnits);
+    }
+    else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
 }
 
-// Load custom shader strings and return program id
-unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+// Unload default shader
+// NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
+static void rlUnloadShaderDefault(void)
 {
-    unsigned int program = 0;
+    rlCacheUseProgram(0);
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    GLint success = 0;
-    program = glCreateProgram();
+    // NOTE: Default shaders are not compiled if default program was loaded from binary cache
+    if (RLGL.State.defaultVShaderId > 0)
+    {
+        glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
+        glDeleteShader(RLGL.State.defaultVShaderId);
+    }
+    if (RLGL.State.defaultFShaderId > 0) glDeleteShader(RLGL.State.defaultFShaderId);   // Not attached to default program
 
-    glAttachShader(program, vShaderId);
-    glAttachShader(program, fShaderId);
+    glDeleteProgram(RLGL.State.defaultShaderId);
+    rlInvalidateStateCache();
+    rlUnloadShaderUniforms(RLGL.State.defaultShaderId);
 
-    // NOTE: Default attribute shader locations must be binded before linking
-    glBindAttribLocation(program, 0, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
-    glBindAttribLocation(program, 1, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
-    glBindAttribLocation(program, 2, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
-    glBindAttribLocation(program, 3, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
-    glBindAttribLocation(program, 4, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
-    glBindAttribLocation(program, 5, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    if (RLGL.State.alphaTestShaderId > 0)
+    {
+        glDeleteProgram(RLGL.State.alphaTestShaderId);
+        rlUnloadShaderUniforms(RLGL.State.alphaTestShaderId);
+        RLGL.State.alphaTestShaderId = 0;
+    }
 
-    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
+    ASC_FREE(RLGL.State.defaultShaderLocs);
 
-    glLinkProgram(program);
+    TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
+}
 
-    // NOTE: All uniform variables are intitialised to 0 when a program links
+// Load alpha tested variant of default shader (opaque mode)
+// NOTE: Default batch fragment shader compiled with RL_ALPHA_TEST defined, attributes locations are the same
+static void rlLoadShaderAlphaTest(void)
+{
+    rlRequireContext();
 
-    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    // Define RL_ALPHA_TEST after version directive (first line)
+    const char *code = RLGL.State.defaultBatchFShaderCode;
+    const char *define = "#define RL_ALPHA_TEST\n";
+    int versionLength = (int)(strchr(code, '\n') - code) + 1;
 
-    if (success == GL_FALSE)
+    char *fsCode = (char *)ASC_MALLOC(strlen(code) + strlen(define) + 1);
+    memcpy(fsCode, code, versionLength);
+    strcpy(fsCode + versionLength, define);
+    strcat(fsCode, code + versionLength);
+
+    // Try loading program from binary cache
+    char cacheKey[RL_SHADER_CACHE_KEY_SIZE] = { 0 };
+    if (rlGetShaderCacheKey(RLGL.State.defaultVShaderCode, fsCode, cacheKey)) RLGL.State.alphaTestShaderId = rlLoadShaderBinary(cacheKey);
+
+    if (RLGL.State.alphaTestShaderId == 0)
     {
-        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link shader program", program);
+        if (RLGL.State.defaultVShaderId == 0) RLGL.State.defaultVShaderId = rlCompileShader(RLGL.State.defaultVShaderCode, GL_VERTEX_SHADER);
+        unsigned int fShaderId = rlCompileShader(fsCode, GL_FRAGMENT_SHADER);
 
-        int maxLength = 0;
-        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+        RLGL.State.alphaTestShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, fShaderId);
 
-        if (maxLength > 0)
+        if (RLGL.State.alphaTestShaderId > 0)
         {
-            int length = 0;
-            char *log = ASC_CALLOC(maxLength, sizeof(char));
-            glGetProgramInfoLog(program, maxLength, &length, log);
-            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
-            ASC_FREE(log);
+            glDetachShader(RLGL.State.alphaTestShaderId, RLGL.State.defaultVShaderId);
+            glDetachShader(RLGL.State.alphaTestShaderId, fShaderId);
         }
+        glDeleteShader(fShaderId);
 
-        glDeleteProgram(program);
-
-        program = 0;
+        if ((RLGL.State.alphaTestShaderId > 0) && (cacheKey[0] != '\0')) rlSaveShaderBinary(RLGL.State.alphaTestShaderId, cacheKey);
     }
-    else
+
+    ASC_FREE(fsCode);
+
+    if (RLGL.State.alphaTestShaderId > 0)
     {
-        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
-        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
-        //GLint binarySize = 0;
-        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Alpha tested default shader loaded successfully", RLGL.State.alphaTestShaderId);
 
-        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", program);
+        for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.alphaTestShaderLocs[i] = RLGL.State.defaultShaderLocs[i];
+
+        RLGL.State.alphaTestShaderLocs[RL_SHADER_LOC_MATRIX_MVP] = glGetUniformLocation(RLGL.State.alphaTestShaderId, "mvp");
+        RLGL.State.alphaTestShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.alphaTestShaderId, "colDiffuse");
+        RLGL.State.alphaTestShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.alphaTestShaderId, "texture0");
+
+        int batchUnits[7] = { 1, 2, 3, 4, 5, 6, 7 };
+        rlCacheUseProgram(RLGL.State.alphaTestShaderId);
+        glUniform1iv(glGetUniformLocation(RLGL.State.alphaTestShaderId, "batchTextures"), 7, batchUnits);
     }
-#endif
-    return program;
+    else TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load alpha tested default shader, opaque mode is not alpha tested");
 }
 
-// Unload shader program
-void rlUnloadShaderProgram(unsigned int id)
+// Update state depending on matrices, required after any matrix change
+// NOTE: Transform is 2D affine when z does not modify x/y and is kept unchanged (usual 2D translate/rotate/scale)
+static void rlUpdateMatrixState(void)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glDeleteProgram(id);
+    Matrix *mat = &RLGL.State.transform;
 
-    TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
-#endif
+    RLGL.State.transformAffine = (mat->m2 == 0.0f) && (mat->m3 == 0.0f) && (mat->m6 == 0.0f) && (mat->m7 == 0.0f) &&
+                                 (mat->m8 == 0.0f) && (mat->m9 == 0.0f) && (mat->m10 == 1.0f) && (mat->m11 == 0.0f) &&
+                                 (mat->m14 == 0.0f) && (mat->m15 == 1.0f);
+
+    RLGL.State.cullDirty = true;
 }
 
-// Get shader location uniform
-int rlGetLocationUniform(unsigned int shaderId, const char *uniformName)
+// Upload batch vertex data to GPU
+// NOTE: Only OpenGL calls and provided state are used, it can be called from render thread
+static void rlUpdateBatchBuffers(const rlBatchState *state, const float *vertices, const float *texcoords, const float *shapes, const unsigned char *colors, const unsigned char *texunits)
 {
-    int location = -1;
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    location = glGetUniformLocation(shaderId, uniformName);
+    // Activate elements VAO
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(state->vaoId);
 
-    if (location == -1) TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to find shader uniform: %s", shaderId, uniformName);
-    else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Shader uniform (%s) set at location: %i", shaderId, uniformName, location);
-#endif
-    return location;
-}
+    // Vertex positions buffer
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, state->vboId[0]);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, state->vertexCount*3*sizeof(float), vertices);
 
-// Get shader location attribute
-int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
-{
-    int location = -1;
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    location = glGetAttribLocation(shaderId, attribName);
+    // Texture coordinates buffer
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, state->vboId[1]);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, state->vertexCount*2*sizeof(float), texcoords);
 
-    if (location == -1) TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to find shader attribute: %s", shaderId, attribName);
-    else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Shader attribute (%s) set at location: %i", shaderId, attribName, location);
-#endif
-    return location;
-}
+    // Colors buffer
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, state->vboId[2]);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, state->vertexCount*4*sizeof(unsigned char), colors);
 
-// Set shader value uniform
-void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    switch (uniformType)
+    // Texture units buffer
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, state->vboId[4]);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, state->vertexCount*sizeof(unsigned char), texunits);
+
+    // Shapes buffer, only required up to last shape vertex
+    if (state->shapeVertexCount > 0)
     {
-        case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_VEC2: glUniform2fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_VEC3: glUniform3fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_VEC4: glUniform4fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_INT: glUniform1iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_IVEC2: glUniform2iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_IVEC3: glUniform3iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_IVEC4: glUniform4iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_SAMPLER2D: glUniform1iv(locIndex, count, (int *)value); break;
-        default: TRACELOG(RL_LOG_WARNING, "SHADER: Failed to set uniform value, data type not recognized");
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, state->vboId[5]);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, state->shapeVertexCount*4*sizeof(float), shapes);
     }
-#endif
+
+    // NOTE: glMapBuffer() causes sync issue.
+    // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
+    // To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer().
+    // If you do that, the previous data in PBO will be discarded and glMapBuffer() returns a new
+    // allocated pointer immediately even if GPU is still working with the previous data.
+
+    // NOTE: VAO is kept bound, batch draw follows and binds it again (elided by state cache)
 }
 
-// Set shader value attribute
-void rlSetVertexAttributeDefault(int locIndex, const void *value, int attribType, int count)
+// Draw batch vertex buffers
+// NOTE: Only OpenGL calls and provided state are used, it can be called from render thread
+static void rlDrawBatchBuffers(const rlBatchState *state, const rlDrawCall *draws)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    switch (attribType)
+    // Set current shader and upload current MVP matrix (skipped if already uploaded to this shader)
+    bool uniformsUploaded = (RLGL.Cache.uniformProgramId == state->shaderId);
+
+    rlCacheUseProgram(state->shaderId);
+    if (uniformsUploaded && (memcmp(RLGL.Cache.mvp, state->mvp, 16*sizeof(float)) == 0)) RLGL.Cache.elided++;
+    else
     {
-        case RL_SHADER_ATTRIB_FLOAT: if (count == 1) glVertexAttrib1fv(locIndex, (float *)value); break;
-        case RL_SHADER_ATTRIB_VEC2: if (count == 2) glVertexAttrib2fv(locIndex, (float *)value); break;
-        case RL_SHADER_ATTRIB_VEC3: if (count == 3) glVertexAttrib3fv(locIndex, (float *)value); break;
-        case RL_SHADER_ATTRIB_VEC4: if (count == 4) glVertexAttrib4fv(locIndex, (float *)value); break;
-        default: TRACELOG(RL_LOG_WARNING, "SHADER: Failed to set attrib default value, data type not recognized");
+        glUniformMatrix4fv(state->shaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, state->mvp);
+        memcpy(RLGL.Cache.mvp, state->mvp, 16*sizeof(float));
+        RLGL.Cache.issued++;
     }
-#endif
-}
 
-// Set shader value uniform matrix
-void rlSetUniformMatrix(int locIndex, Matrix mat)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    float matfloat[16] = {
-        mat.m0, mat.m1, mat.m2, mat.m3,
-        mat.m4, mat.m5, mat.m6, mat.m7,
-        mat.m8, mat.m9, mat.m10, mat.m11,
-        mat.m12, mat.m13, mat.m14, mat.m15
-    };
-    glUniformMatrix4fv(locIndex, 1, false, matfloat);
-#endif
-}
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(state->vaoId);
+    else
+    {
+        // Bind vertex attrib: position (shader-location = 0)
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, state->vboId[0]);
+        glVertexAttribPointer(state->shaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(state->shaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+
+        // Bind vertex attrib: texcoord (shader-location = 1)
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, state->vboId[1]);
+        glVertexAttribPointer(state->shaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(state->shaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+
+        // Bind vertex attrib: color (shader-location = 3)
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, state->vboId[2]);
+        glVertexAttribPointer(state->shaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        glEnableVertexAttribArray(state->shaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+
+        // Bind vertex attrib: texture unit (shader-location = 6)
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, state->vboId[4]);
+        glVertexAttribPointer(6, 1, GL_UNSIGNED_BYTE, GL_FALSE, 0, 0);
+        glEnableVertexAttribArray(6);
+
+        // Bind vertex attrib: shape (shader-location = 7)
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, state->vboId[5]);
+        glVertexAttribPointer(7, 4, GL_FLOAT, GL_FALSE, 0, 0);
+        glEnableVertexAttribArray(7);
+
+        rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, state->vboId[3]);
+    }
 
-// Set shader value uniform sampler
-void rlSetUniformSampler(int locIndex, unsigned int textureId)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Check if texture is already active
-    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) if (RLGL.State.activeTextureId[i] == textureId) return;
+    // Setup some default shader values
+    // NOTE: Only required once per shader, until any uniform is set out of the batch (or color changes)
+    if (uniformsUploaded && (memcmp(RLGL.Cache.color, state->color, 4*sizeof(float)) == 0)) RLGL.Cache.elided++;
+    else
+    {
+        glUniform4fv(state->shaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1, state->color);
+        memcpy(RLGL.Cache.color, state->color, 4*sizeof(float));
+        RLGL.Cache.issued++;
+    }
 
-    // Register a new active texture for the internal batch system
-    // NOTE: Default texture is always activated as GL_TEXTURE0
+    if (uniformsUploaded) RLGL.Cache.elided++;
+    else
+    {
+        glUniform1i(state->shaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+        RLGL.Cache.issued++;
+    }
+
+    RLGL.Cache.uniformProgramId = state->shaderId;
+
+    // Activate additional sampler textures
+    // Those additional textures will be common for all draw calls of the batch
     for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
     {
-        if (RLGL.State.activeTextureId[i] == 0)
+        if (state->activeTextureId[i] > 0)
         {
-            glUniform1i(locIndex, 1 + i);              // Activate new texture unit
-            RLGL.State.activeTextureId[i] = textureId; // Save texture id for binding on drawing
-            break;
+            rlCacheActiveTexture(1 + i);
+            rlCacheBindTexture(state->activeTextureId[i]);
         }
     }
+
+    // Activate default sampler2D texture0 (one texture is always active for default batch shader)
+    // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
+    rlCacheActiveTexture(0);
+
+    for (int i = 0, vertexOffset = 0; i < state->drawCounter; i++)
+    {
+#if defined(GRAPHICS_API_OPENGL_43)
+        // Quads draw calls run submitted with one multi-draw indirect call
+        if (RLGL.ExtSupported.multiDrawIndirect && (state->instances == 0) &&
+            (draws[i].mode != RL_LINES) && (draws[i].mode != RL_TRIANGLES))
+        {
+            i = rlDrawBatchMultiDraw(state, draws, i, vertexOffset, &vertexOffset) - 1;
+            continue;
+        }
 #endif
-}
 
-// Set shader currently active (id and locations)
-void rlSetShader(unsigned int id, int *locs)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.State.currentShaderId != id)
+        // Bind current draw call texture, activated as GL_TEXTURE0 and binded to sampler2D texture0 by default
+        rlCacheBindTexture(draws[i].textureId);
+
+        // Bind draw call additional textures (multi-texture batching), default shader selects them per vertex
+        if (draws[i].extraTextureCount > 0)
+        {
+            for (int t = 0; t < draws[i].extraTextureCount; t++)
+            {
+                rlCacheActiveTexture(1 + t);
+                rlCacheBindTexture(draws[i].extraTextureId[t]);
+            }
+
+            rlCacheActiveTexture(0);
+        }
+
+        if ((draws[i].mode == RL_LINES) || (draws[i].mode == RL_TRIANGLES))
+        {
+            if (state->instances == 0)
+            {
+                glDrawArrays(draws[i].mode, vertexOffset, draws[i].vertexCount);
+            }
+            else
+            {
+                glDrawArraysInstanced(draws[i].mode, vertexOffset, draws[i].vertexCount, state->instances);
+            }
+        }
+        else
+        {
+            if (state->instances == 0)
+            {
+#if defined(GRAPHICS_API_OPENGL_33)
+                // We need to define the number of indices to be processed: elementCount*6
+                // NOTE: The final parameter tells the GPU the offset in bytes from the
+                // start of the index buffer to the location of the first index to process
+                glDrawElements(GL_TRIANGLES, draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+                glDrawElements(GL_TRIANGLES, draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
+#endif
+            }
+            else
+            {
+                glDrawElementsInstanced(GL_TRIANGLES, draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)), state->instances);
+            }
+        }
+
+        vertexOffset += (draws[i].vertexCount + draws[i].vertexAlignment);
+    }
+
+    if (!RLGL.ExtSupported.vao)
     {
-        rlDrawRenderBatch(RLGL.currentBatch);
-        RLGL.State.currentShaderId = id;
-        RLGL.State.currentShaderLocs = locs;
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, 0);
+        rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     }
-#endif
-}
 
-// Load compute shader program
-unsigned int rlLoadComputeShaderProgram(unsigned int shaderId)
-{
-    unsigned int program = 0;
+    // NOTE: Shader program and textures are kept bound for next batch draw (state cache),
+    // VAO is unbound to avoid other buffers/attributes setup modifying it
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0); // Unbind VAO
+}
 
 #if defined(GRAPHICS_API_OPENGL_43)
-    GLint success = 0;
-    program = glCreateProgram();
-    glAttachShader(program, shaderId);
-    glLinkProgram(program);
+// Draw batch quads draw calls run with one multi-draw indirect call, returns draw call following the run
+// NOTE: With default shader, draw calls textures are bound to consecutive units ranges and the shader
+// offsets vertex texture unit by draw range base (instanced attribute read at draw base instance),
+// other shaders only sample texture0, run continues while texture is the same
+static int rlDrawBatchMultiDraw(const rlBatchState *state, const rlDrawCall *draws, int first, int vertexOffset, int *vertexEnd)
+{
+    int last = first;
+    bool unitRanges = ((state->shaderId == RLGL.State.defaultShaderId) || (state->shaderId == RLGL.State.alphaTestShaderId));
+    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) if (state->activeTextureId[i] > 0) unitRanges = false;
 
-    // NOTE: All uniform variables are intitialised to 0 when a program links
+    if (RLGL.MultiDraw.capacity < state->drawCounter)
+    {
+        RLGL.MultiDraw.commands = (rlDrawIndirectCommand *)ASC_REALLOC(RLGL.MultiDraw.commands, state->drawCounter*sizeof(rlDrawIndirectCommand));
+        RLGL.MultiDraw.capacity = state->drawCounter;
+    }
 
-    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    int count = 0;
+    int unitCount = 0;
+    unsigned int textureId = 0;
 
-    if (success == GL_FALSE)
+    for (; last < state->drawCounter; last++)
     {
-        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link compute shader program", program);
+        const rlDrawCall *draw = &draws[last];
 
-        int maxLength = 0;
-        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+        if ((draw->mode == RL_LINES) || (draw->mode == RL_TRIANGLES)) break;
 
-        if (maxLength > 0)
+        if (draw->vertexCount > 0)
         {
-            int length = 0;
-            char *log = ASC_CALLOC(maxLength, sizeof(char));
-            glGetProgramInfoLog(program, maxLength, &length, log);
-            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
-            ASC_FREE(log);
-        }
+            int drawUnits = 1 + draw->extraTextureCount;
 
-        glDeleteProgram(program);
+            if (unitRanges)
+            {
+                if ((unitCount + drawUnits) > RL_DEFAULT_BATCH_DRAW_TEXTURES) break;
+
+                for (int t = 0; t < drawUnits; t++)
+                {
+                    rlCacheActiveTexture(unitCount + t);
+                    rlCacheBindTexture((t == 0)? draw->textureId : draw->extraTextureId[t - 1]);
+                }
+            }
+            else
+            {
+                if ((count > 0) && (draw->textureId != textureId)) break;
+
+                textureId = draw->textureId;
+                rlCacheActiveTexture(0);
+                rlCacheBindTexture(textureId);
+            }
+
+            rlDrawIndirectCommand *command = &RLGL.MultiDraw.commands[count];
+            command->count = draw->vertexCount/4*6;
+            command->instanceCount = 1;
+            command->firstIndex = vertexOffset/4*6;
+            command->baseVertex = 0;
+            command->baseInstance = unitCount;
+
+            if (unitRanges) unitCount += drawUnits;
+            count++;
+        }
 
-        program = 0;
+        vertexOffset += (draw->vertexCount + draw->vertexAlignment);
     }
-    else
+
+    rlCacheActiveTexture(0);
+
+    if (count > 0)
     {
-        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
-        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
-        //GLint binarySize = 0;
-        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+        if (RLGL.MultiDraw.commandsId == 0) glGenBuffers(1, &RLGL.MultiDraw.commandsId);
 
-        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Compute shader program loaded successfully", program);
+        // NOTE: Buffer is orphaned on every submission, previous commands could still be in use
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, RLGL.MultiDraw.commandsId);
+        glBufferData(GL_DRAW_INDIRECT_BUFFER, count*sizeof(rlDrawIndirectCommand), RLGL.MultiDraw.commands, GL_STREAM_DRAW);
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, 0, count, 0);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
     }
-#endif
 
-    return program;
-}
+    *vertexEnd = vertexOffset;
 
-// Dispatch compute shader (equivalent to *draw* for graphics pilepine)
-void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned int groupZ)
-{
-#if defined(GRAPHICS_API_OPENGL_43)
-    glDispatchCompute(groupX, groupY, groupZ);
-#endif
+    return last;
 }
 
-// Load shader storage buffer object (SSBO)
-unsigned int rlLoadShaderBuffer(unsigned long long size, const void *data, int usageHint)
+// Enable draw textures units base attribute on bound VAO (shader-location = 8)
+// NOTE: Attribute values are read at draw base instance, divisor is bigger than any instances count
+// so every instance reads it, draw calls not using multi-draw indirect read base 0
+static void rlEnableDrawUnitsAttrib(void)
 {
-    unsigned int ssbo = 0;
+    if (RLGL.MultiDraw.unitsId == 0)
+    {
+        float units[RL_DEFAULT_BATCH_DRAW_TEXTURES] = { 0 };
+        for (int i = 0; i < RL_DEFAULT_BATCH_DRAW_TEXTURES; i++) units[i] = (float)i;
 
-#if defined(GRAPHICS_API_OPENGL_43)
-    glGenBuffers(1, &ssbo);
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
-    glBufferData(GL_SHADER_STORAGE_BUFFER, size, data, usageHint? usageHint : RL_STREAM_COPY);
-#endif
+        glGenBuffers(1, &RLGL.MultiDraw.unitsId);
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, RLGL.MultiDraw.unitsId);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(units), units, GL_STATIC_DRAW);
+    }
 
-    return ssbo;
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, RLGL.MultiDraw.unitsId);
+    glEnableVertexAttribArray(8);
+    glVertexAttribPointer(8, 1, GL_FLOAT, GL_FALSE, 0, 0);
+    glVertexAttribDivisor(8, 0x40000000);
 }
+#endif  // GRAPHICS_API_OPENGL_43
 
-// Unload shader storage buffer object (SSBO)
-void rlUnloadShaderBuffer(unsigned int ssboId)
+// Get draw texture unit for texture, texture is added to the draw as additional texture if possible
+// NOTE: Multi-texture batching is only available with default shader and no additional active textures,
+// default shader selects the texture to sample by vertex texture unit
+static int rlGetDrawTextureUnit(rlDrawCall *draw, unsigned int id)
 {
-#if defined(GRAPHICS_API_OPENGL_43)
-    glDeleteBuffers(1, &ssboId);
-#endif
+    int unit = -1;
+
+    if ((draw->vertexCount > 0) &&
+        (RLGL.State.currentShaderId == RLGL.State.defaultShaderId) &&
+        (RLGL.State.activeTextureId[0] == 0))
+    {
+        for (int i = 0; i < draw->extraTextureCount; i++)
+        {
+            if (draw->extraTextureId[i] == id)
+            {
+                unit = 1 + i;
+                break;
+            }
+        }
+
+        if ((unit < 0) && (draw->extraTextureCount < (RL_DEFAULT_BATCH_DRAW_TEXTURES - 1)))
+        {
+            draw->extraTextureId[draw->extraTextureCount] = id;
+            draw->extraTextureCount++;
+            unit = draw->extraTextureCount;
+        }
+    }
+
+    return unit;
 }
 
-// Update SSBO buffer data
-void rlUpdateShaderBufferElements(unsigned int id, const void *data, unsigned long long dataSize, unsigned long long offset)
+// Get approximated sine and cosine of angle in radians (max error ~0.001), scalar version of rlSpriteArray() SIMD path
+// NOTE: Angle is reduced to [-PI, PI], sine approximated as y = B*a + C*a*|a| refined as y = P*(y*|y| - y) + y
+static void rlGetSpriteSinCos(float angle, float *sinValue, float *cosValue)
 {
-#if defined(GRAPHICS_API_OPENGL_43)
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
-    glBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, dataSize, data);
-#endif
+    const float b = 4.0f/PI;
+    const float c = -4.0f/(PI*PI);
+    const float p = 0.225f;
+
+    float turns = floorf(angle*(1.0f/(2.0f*PI)) + 0.5f);
+    angle -= turns*2.0f*PI;
+    float angleCos = angle + PI/2.0f;
+    if (angleCos > PI) angleCos -= 2.0f*PI;
+
+    float s = b*angle + c*angle*fabsf(angle);
+    float co = b*angleCos + c*angleCos*fabsf(angleCos);
+
+    *sinValue = p*(s*fabsf(s) - s) + s;
+    *cosValue = p*(co*fabsf(co) - co) + co;
 }
 
-// Get SSBO buffer size
-unsigned long long rlGetShaderBufferSize(unsigned int id)
+// Record a command into current command buffer
+// NOTE: Returns a pointer to the command payload (dataSize bytes), buffer grows if required
+static void *rlRecordCommand(int type, int p0, int p1, int p2, int p3, int dataSize)
 {
-    long long size = 0;
+    rlCommandBuffer *cmds = RLGL.currentCommands;
+    int size = (sizeof(rlCommand) + dataSize + 7) & ~7;     // Keep commands 8-byte aligned
 
-#if defined(GRAPHICS_API_OPENGL_43)
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
-    glGetInteger64v(GL_SHADER_STORAGE_BUFFER_SIZE, &size);
-#endif
+    if ((cmds->size + size) > cmds->capacity)
+    {
+        int capacity = (cmds->capacity > 0)? cmds->capacity : RL_DEFAULT_COMMAND_BUFFER_SIZE;
+        while ((cmds->size + size) > capacity) capacity *= 2;
 
-    return (size > 0)? size : 0;
+        unsigned char *data = (unsigned char *)ASC_REALLOC(cmds->data, capacity);
+        if (data == NULL)
+        {
+            TRACELOG(RL_LOG_ERROR, "RLGL: Failed to grow command buffer to %i bytes", capacity);
+            return NULL;
+        }
+
+        cmds->data = data;
+        cmds->capacity = capacity;
+    }
+
+    rlCommand *cmd = (rlCommand *)(cmds->data + cmds->size);
+    cmd->type = type;
+    cmd->size = size;
+    cmd->params[0] = p0;
+    cmd->params[1] = p1;
+    cmd->params[2] = p2;
+    cmd->params[3] = p3;
+
+    cmds->size += size;
+    cmds->commandCount++;
+
+    return (dataSize > 0)? (cmds->data + cmds->size - size + sizeof(rlCommand)) : NULL;
 }
 
-// Read SSBO buffer data
-void rlReadShaderBufferElements(unsigned int id, void *dest, unsigned long long count, unsigned long long offset)
+// Use shader program (skipped if already in use)
+static void rlCacheUseProgram(unsigned int id)
 {
-#if defined(GRAPHICS_API_OPENGL_43)
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
-    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, count, dest);
-#endif
+    if (RLGL.Cache.programId == id) { RLGL.Cache.elided++; return; }
+
+    glUseProgram(id);
+    RLGL.Cache.programId = id;
+    RLGL.Cache.issued++;
 }
 
-// Bind SSBO buffer
-void rlBindShaderBuffer(unsigned int id, unsigned int index)
+// Bind vertex array object (skipped if already bound)
+static void rlCacheBindVertexArray(unsigned int id)
 {
-#if defined(GRAPHICS_API_OPENGL_43)
-    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, id);
-#endif
+    if (RLGL.Cache.vaoId == id) { RLGL.Cache.elided++; return; }
+
+    glBindVertexArray(id);
+    RLGL.Cache.vaoId = id;
+    RLGL.Cache.elementBufferId = RL_CACHE_INVALID_ID;   // Element buffer binding is part of VAO state
+    RLGL.Cache.issued++;
 }
 
-// Copy SSBO buffer data
-void rlCopyBuffersElements(unsigned int destId, unsigned int srcId, unsigned long long destOffset, unsigned long long srcOffset, unsigned long long count)
+// Bind array/element buffer (skipped if already bound)
+static void rlCacheBindBuffer(int target, unsigned int id)
 {
-#if defined(GRAPHICS_API_OPENGL_43)
-    glBindBuffer(GL_COPY_READ_BUFFER, srcId);
-    glBindBuffer(GL_COPY_WRITE_BUFFER, destId);
-    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, srcOffset, destOffset, count);
-#endif
+    unsigned int *bound = (target == GL_ELEMENT_ARRAY_BUFFER)? &RLGL.Cache.elementBufferId : &RLGL.Cache.arrayBufferId;
+
+    if (*bound == id) { RLGL.Cache.elided++; return; }
+
+    glBindBuffer(target, id);
+    *bound = id;
+    RLGL.Cache.issued++;
 }
 
-// Bind image texture
-void rlBindImageTexture(unsigned int id, unsigned int index, unsigned int format, int readonly)
+// Set active texture unit (skipped if already active)
+static void rlCacheActiveTexture(int unit)
 {
-#if defined(GRAPHICS_API_OPENGL_43)
-    int glInternalFormat = 0, glFormat = 0, glType = 0;
+    if (RLGL.Cache.activeTextureUnit == unit) { RLGL.Cache.elided++; return; }
 
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
-    glBindImageTexture(index, id, 0, 0, 0, readonly ? GL_READ_ONLY : GL_READ_WRITE, glInternalFormat);
-#endif
+    glActiveTexture(GL_TEXTURE0 + unit);
+    RLGL.Cache.activeTextureUnit = unit;
+    RLGL.Cache.issued++;
 }
 
-// Matrix state management
-//-----------------------------------------------------------------------------------------
-// Get internal modelview matrix
-Matrix rlGetMatrixModelview(void)
+// Set blending factors and equation (skipped if already set)
+static void rlCacheBlendMode(int srcFactor, int dstFactor, int equation)
 {
-    Matrix matrix = rlMatrixIdentity();
-#if defined(GRAPHICS_API_OPENGL_11)
-    float mat[16];
-    glGetFloatv(GL_MODELVIEW_MATRIX, mat);
-    matrix.m0 = mat[0];
-    matrix.m1 = mat[1];
-    matrix.m2 = mat[2];
-    matrix.m3 = mat[3];
-    matrix.m4 = mat[4];
-    matrix.m5 = mat[5];
-    matrix.m6 = mat[6];
-    matrix.m7 = mat[7];
-    matrix.m8 = mat[8];
-    matrix.m9 = mat[9];
-    matrix.m10 = mat[10];
-    matrix.m11 = mat[11];
-    matrix.m12 = mat[12];
-    matrix.m13 = mat[13];
-    matrix.m14 = mat[14];
-    matrix.m15 = mat[15];
-#else
-    matrix = RLGL.State.modelview;
-#endif
-    return matrix;
+    if ((RLGL.Cache.blendSrcFactor == srcFactor) && (RLGL.Cache.blendDstFactor == dstFactor) &&
+        (RLGL.Cache.blendEquation == equation)) { RLGL.Cache.elided++; return; }
+
+    glBlendFunc(srcFactor, dstFactor);
+    glBlendEquation(equation);
+    RLGL.Cache.blendSrcFactor = srcFactor;
+    RLGL.Cache.blendDstFactor = dstFactor;
+    RLGL.Cache.blendEquation = equation;
+    RLGL.Cache.issued++;
 }
 
-// Get internal projection matrix
-Matrix rlGetMatrixProjection(void)
+// Mark batch default uniforms as unknown
+// NOTE: Any uniform set out of the batch could overwrite colDiffuse/texture0/mvp of program in use
+static void rlCacheUniformsChanged(void)
 {
-#if defined(GRAPHICS_API_OPENGL_11)
-    float mat[16];
-    glGetFloatv(GL_PROJECTION_MATRIX,mat);
-    Matrix m;
-    m.m0 = mat[0];
-    m.m1 = mat[1];
-    m.m2 = mat[2];
-    m.m3 = mat[3];
-    m.m4 = mat[4];
-    m.m5 = mat[5];
-    m.m6 = mat[6];
-    m.m7 = mat[7];
-    m.m8 = mat[8];
-    m.m9 = mat[9];
-    m.m10 = mat[10];
-    m.m11 = mat[11];
-    m.m12 = mat[12];
-    m.m13 = mat[13];
-    m.m14 = mat[14];
-    m.m15 = mat[15];
-    return m;
-#else
-    return RLGL.State.projection;
-#endif
+    RLGL.Cache.uniformProgramId = RL_CACHE_INVALID_ID;
 }
 
-// Get internal accumulated transform matrix
-Matrix rlGetMatrixTransform(void)
+// Get shader program uniforms cache (created if required)
+// NOTE: Returns NULL if not found and not created
+static rlShaderUniforms *rlGetShaderUniforms(unsigned int id, bool create)
 {
-    Matrix mat = rlMatrixIdentity();
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // TODO: Consider possible transform matrices in the RLGL.State.stack
-    // Is this the right order? or should we start with the first stored matrix instead of the last one?
-    //Matrix matStackTransform = rlMatrixIdentity();
-    //for (int i = RLGL.State.stackCounter; i > 0; i--) matStackTransform = rlMatrixMultiply(RLGL.State.stack[i], matStackTransform);
-    mat = RLGL.State.transform;
-#endif
-    return mat;
+    for (int i = 0; i < RLGL.Uniforms.programCount; i++)
+    {
+        if (RLGL.Uniforms.programs[i].programId == id) return &RLGL.Uniforms.programs[i];
+    }
+
+    if (!create) return NULL;
+
+    RLGL.Uniforms.programs = (rlShaderUniforms *)ASC_REALLOC(RLGL.Uniforms.programs, (RLGL.Uniforms.programCount + 1)*sizeof(rlShaderUniforms));
+
+    rlShaderUniforms *uniforms = &RLGL.Uniforms.programs[RLGL.Uniforms.programCount];
+    uniforms->programId = id;
+    uniforms->nameCount = 0;
+    uniforms->nameCapacity = 32;
+    uniforms->names = (rlUniformName *)ASC_CALLOC(uniforms->nameCapacity, sizeof(rlUniformName));
+    uniforms->valueCount = 0;
+    uniforms->valueCapacity = 32;
+    uniforms->values = (rlUniformValue *)ASC_MALLOC(uniforms->valueCapacity*sizeof(rlUniformValue));
+    for (int i = 0; i < uniforms->valueCapacity; i++) uniforms->values[i].location = -1;
+
+    RLGL.Uniforms.programCount++;
+
+    return uniforms;
 }
 
-// Get internal projection matrix for stereo render (selected eye)
-RLAPI Matrix rlGetMatrixProjectionStereo(int eye)
+// Load shader program active uniforms locations into cache
+// NOTE: Array uniforms are reported as "name[0]", they are also cached as "name"
+static void rlLoadShaderUniforms(unsigned int id)
 {
-    Matrix mat = rlMatrixIdentity();
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    mat = RLGL.State.projectionStereo[eye];
-#endif
-    return mat;
+    rlUnloadShaderUniforms(id);     // Program id could be reused, previous cache is not valid
+
+    int uniformCount = 0;
+    int maxLength = 0;
+    glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &uniformCount);
+    glGetProgramiv(id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+    rlShaderUniforms *uniforms = rlGetShaderUniforms(id, true);
+    char *name = (char *)ASC_CALLOC(maxLength + 1, sizeof(char));
+
+    for (int i = 0; i < uniformCount; i++)
+    {
+        int length = 0;
+        int size = 0;
+        GLenum type = GL_FLOAT;
+        glGetActiveUniform(id, i, maxLength + 1, &length, &size, &type, name);
+
+        int location = glGetUniformLocation(id, name);
+        rlAddUniformName(uniforms, name, location);
+
+        if ((length > 3) && (strcmp(name + length - 3, "[0]") == 0))
+        {
+            name[length - 3] = '\0';
+            rlAddUniformName(uniforms, name, location);
+        }
+    }
+
+    ASC_FREE(name);
+
+    TRACELOG(RL_LOG_DEBUG, "SHADER: [ID %i] Active uniforms locations cached: %i", id, uniformCount);
 }
 
-// Get internal view offset matrix for stereo render (selected eye)
-RLAPI Matrix rlGetMatrixViewOffsetStereo(int eye)
+// Unload shader program uniforms cache
+static void rlUnloadShaderUniforms(unsigned int id)
 {
-    Matrix mat = rlMatrixIdentity();
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    mat = RLGL.State.viewOffsetStereo[eye];
-#endif
-    return mat;
+    rlShaderUniforms *uniforms = rlGetShaderUniforms(id, false);
+
+    if (uniforms != NULL)
+    {
+        for (int i = 0; i < uniforms->nameCapacity; i++) ASC_FREE(uniforms->names[i].name);
+        ASC_FREE(uniforms->names);
+        ASC_FREE(uniforms->values);
+
+        // Move last program cache into the free position
+        *uniforms = RLGL.Uniforms.programs[RLGL.Uniforms.programCount - 1];
+        RLGL.Uniforms.programCount--;
+    }
 }
 
-// Set a custom modelview matrix (replaces internal modelview matrix)
-void rlSetMatrixModelview(Matrix view)
+// Find uniform name slot (empty slot if not found)
+static rlUniformName *rlFindUniformName(rlShaderUniforms *uniforms, const char *name, unsigned int hash)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    RLGL.State.modelview = view;
-#endif
+    unsigned int mask = uniforms->nameCapacity - 1;
+    unsigned int index = hash & mask;
+
+    while ((uniforms->names[index].name != NULL) &&
+           ((uniforms->names[index].hash != hash) || (strcmp(uniforms->names[index].name, name) != 0))) index = (index + 1) & mask;
+
+    return &uniforms->names[index];
 }
 
-// Set a custom projection matrix (replaces internal projection matrix)
-void rlSetMatrixProjection(Matrix projection)
+// Add uniform location by name
+static void rlAddUniformName(rlShaderUniforms *uniforms, const char *name, int location)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    RLGL.State.projection = projection;
-#endif
+    // Keep table load under 3/4, rehash into a table twice bigger
+    if ((uniforms->nameCount + 1)*4 > uniforms->nameCapacity*3)
+    {
+        rlUniformName *names = uniforms->names;
+        int capacity = uniforms->nameCapacity;
+
+        uniforms->nameCapacity *= 2;
+        uniforms->names = (rlUniformName *)ASC_CALLOC(uniforms->nameCapacity, sizeof(rlUniformName));
+
+        for (int i = 0; i < capacity; i++)
+        {
+            if (names[i].name != NULL) *rlFindUniformName(uniforms, names[i].name, names[i].hash) = names[i];
+        }
+
+        ASC_FREE(names);
+    }
+
+    unsigned int hash = rlHashString(name);
+    rlUniformName *slot = rlFindUniformName(uniforms, name, hash);
+
+    if (slot->name == NULL)
+    {
+        int length = (int)strlen(name);
+        slot->name = (char *)ASC_MALLOC(length + 1);
+        memcpy(slot->name, name, length + 1);
+        slot->hash = hash;
+        uniforms->nameCount++;
+    }
+
+    slot->location = location;
 }
 
-// Set eyes projection matrices for stereo rendering
-void rlSetMatrixProjectionStereo(Matrix right, Matrix left)
+// Get uniform value slot by location
+// NOTE: Returns NULL if not found and not created
+static rlUniformValue *rlGetUniformValue(rlShaderUniforms *uniforms, int location, bool create)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    RLGL.State.projectionStereo[0] = right;
-    RLGL.State.projectionStereo[1] = left;
-#endif
+    unsigned int mask = uniforms->valueCapacity - 1;
+    unsigned int index = (unsigned int)location & mask;
+
+    while ((uniforms->values[index].location != -1) && (uniforms->values[index].location != location)) index = (index + 1) & mask;
+
+    if (uniforms->values[index].location == location) return &uniforms->values[index];
+    if (!create) return NULL;
+
+    // Keep table load under 3/4, rehash into a table twice bigger
+    if ((uniforms->valueCount + 1)*4 > uniforms->valueCapacity*3)
+    {
+        rlUniformValue *values = uniforms->values;
+        int capacity = uniforms->valueCapacity;
+
+        uniforms->valueCapacity *= 2;
+        uniforms->values = (rlUniformValue *)ASC_MALLOC(uniforms->valueCapacity*sizeof(rlUniformValue));
+        for (int i = 0; i < uniforms->valueCapacity; i++) uniforms->values[i].location = -1;
+
+        mask = uniforms->valueCapacity - 1;
+        for (int i = 0; i < capacity; i++)
+        {
+            if (values[i].location == -1) continue;
+
+            index = (unsigned int)values[i].location & mask;
+            while (uniforms->values[index].location != -1) index = (index + 1) & mask;
+            uniforms->values[index] = values[i];
+        }
+
+        ASC_FREE(values);
+
+        index = (unsigned int)location & mask;
+        while (uniforms->values[index].location != -1) index = (index + 1) & mask;
+    }
+
+    uniforms->values[index].location = location;
+    uniforms->values[index].size = 0;
+    uniforms->valueCount++;
+
+    return &uniforms->values[index];
 }
 
-// Set eyes view offsets matrices for stereo rendering
-void rlSetMatrixViewOffsetStereo(Matrix right, Matrix left)
+// Mark uniform value as unknown (set out of uniforms cache)
+static void rlForgetUniformValue(unsigned int id, int location)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    RLGL.State.viewOffsetStereo[0] = right;
-    RLGL.State.viewOffsetStereo[1] = left;
-#endif
+    if (location < 0) return;
+
+    rlShaderUniforms *uniforms = rlGetShaderUniforms(id, false);
+    rlUniformValue *value = (uniforms != NULL)? rlGetUniformValue(uniforms, location, false) : NULL;
+
+    if (value != NULL) value->size = 0;
 }
 
-// Load and draw a quad in NDC
-void rlLoadDrawQuad(void)
+// Check uniform value change, flushing batch if required
+// NOTE: Returns false if value is already set, nothing to update
+static bool rlPrepareUniformValue(unsigned int id, int locIndex, const void *value, int size)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned int quadVAO = 0;
-    unsigned int quadVBO = 0;
+    if (locIndex < 0) return false;     // Uniform not found on shader, OpenGL ignores it
 
-    float vertices[] = {
-         // Positions         Texcoords
-        -1.0f,  1.0f, 0.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f, 0.0f,   0.0f, 0.0f,
-         1.0f,  1.0f, 0.0f,   1.0f, 1.0f,
-         1.0f, -1.0f, 0.0f,   1.0f, 0.0f,
-    };
+    rlShaderUniforms *uniforms = rlGetShaderUniforms(id, true);
+    rlUniformValue *current = rlGetUniformValue(uniforms, locIndex, true);
 
-    // Gen VAO to contain VBO
-    glGenVertexArrays(1, &quadVAO);
-    glBindVertexArray(quadVAO);
+    if ((current->size == size) && (memcmp(current->data, value, size) == 0))
+    {
+        RLGL.Cache.elided++;
+        return false;
+    }
 
-    // Gen and fill vertex buffer (VBO)
-    glGenBuffers(1, &quadVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), &vertices, GL_STATIC_DRAW);
+    // Geometry already on batch was drawn with previous value
+    if ((RLGL.State.currentShaderId == id) && (RLGL.State.vertexCounter > 0)) rlDrawRenderBatch(RLGL.currentBatch);
 
-    // Bind vertex attributes (position, texcoords)
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)0); // Positions
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)(3*sizeof(float))); // Texcoords
+    return true;
+}
 
-    // Draw quad
-    glBindVertexArray(quadVAO);
-    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    glBindVertexArray(0);
+// Keep uniform value set
+// NOTE: Values bigger than RL_UNIFORM_VALUE_MAX_SIZE are not kept, they are always updated
+static void rlStoreUniformValue(unsigned int id, int locIndex, const void *value, int size)
+{
+    if (size > RL_UNIFORM_VALUE_MAX_SIZE) return;
 
-    // Delete buffers (VBO and VAO)
-    glDeleteBuffers(1, &quadVBO);
-    glDeleteVertexArrays(1, &quadVAO);
-#endif
+    rlUniformValue *current = rlGetUniformValue(rlGetShaderUniforms(id, true), locIndex, true);
+
+    memcpy(current->data, value, size);
+    current->size = size;
 }
 
-// Load and draw a cube in NDC
-void rlLoadDrawCube(void)
+// Check if a thread batch is being recorded
+// NOTE: Recorded geometry is drawn with the uniform values set when the thread batch is drawn,
+// uniform values can not be kept per recorded batch, so they can not be set while recording
+static bool rlCheckThreadBatchUniform(void)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned int cubeVAO = 0;
-    unsigned int cubeVBO = 0;
-
-    float vertices[] = {
-         // Positions          Normals               Texcoords
-        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
-         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
-         1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 0.0f,
-         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
-        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
-        -1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
-         1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 0.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
-        -1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
-        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-        -1.0f,  1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
-        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
-        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-         1.0f,  1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
-         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-         1.0f, -1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
-        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
-         1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 1.0f,
-         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
-         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
-        -1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 0.0f,
-        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
-         1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
-        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 0.0f
-    };
+    if (RLGL.threadBatch == NULL) return false;
 
-    // Gen VAO to contain VBO
-    glGenVertexArrays(1, &cubeVAO);
-    glBindVertexArray(cubeVAO);
+    TRACELOG(RL_LOG_WARNING, "SHADER: Uniform values can not be set while recording a thread batch");
 
-    // Gen and fill vertex buffer (VBO)
-    glGenBuffers(1, &cubeVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    return true;
+}
 
-    // Bind vertex attributes (position, normals, texcoords)
-    glBindVertexArray(cubeVAO);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)0); // Positions
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(3*sizeof(float))); // Normals
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(6*sizeof(float))); // Texcoords
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+// Get uniform type components count
+static int rlGetUniformComponents(int uniformType)
+{
+    int componentCount = 1;
 
-    // Draw cube
-    glBindVertexArray(cubeVAO);
-    glDrawArrays(GL_TRIANGLES, 0, 36);
-    glBindVertexArray(0);
+    switch (uniformType)
+    {
+        case RL_SHADER_UNIFORM_VEC2: case RL_SHADER_UNIFORM_IVEC2: componentCount = 2; break;
+        case RL_SHADER_UNIFORM_VEC3: case RL_SHADER_UNIFORM_IVEC3: componentCount = 3; break;
+        case RL_SHADER_UNIFORM_VEC4: case RL_SHADER_UNIFORM_IVEC4: componentCount = 4; break;
+        default: break;
+    }
 
-    // Delete VBO and VAO
-    glDeleteBuffers(1, &cubeVBO);
-    glDeleteVertexArrays(1, &cubeVAO);
-#endif
+    return componentCount;
 }
 
-// Get name string for pixel format
-const char *rlGetPixelFormatName(unsigned int format)
+// Compute string hash (FNV-1a)
+static unsigned int rlHashString(const char *text)
 {
-    switch (format)
+    unsigned int hash = 2166136261u;
+
+    if (text == NULL) return hash;
+
+    for (int i = 0; text[i] != '\0'; i++)
     {
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: return "GRAYSCALE"; break;         // 8 bit per pixel (no alpha)
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: return "GRAY_ALPHA"; break;       // 8*2 bpp (2 channels)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: return "R5G6B5"; break;               // 16 bpp
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: return "R8G8B8"; break;               // 24 bpp
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: return "R5G5B5A1"; break;           // 16 bpp (1 bit alpha)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: return "R4G4B4A4"; break;           // 16 bpp (4 bit alpha)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: return "R8G8B8A8"; break;           // 32 bpp
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: return "R32"; break;                     // 32 bpp (1 channel - float)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: return "R32G32B32"; break;         // 32*3 bpp (3 channels - float)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: return "R32G32B32A32"; break;   // 32*4 bpp (4 channels - float)
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: return "DXT1_RGB"; break;             // 4 bpp (no alpha)
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: return "DXT1_RGBA"; break;           // 4 bpp (1 bit alpha)
-        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: return "DXT3_RGBA"; break;           // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: return "DXT5_RGBA"; break;           // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: return "ETC1_RGB"; break;             // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: return "ETC2_RGB"; break;             // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: return "ETC2_RGBA"; break;       // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: return "PVRT_RGB"; break;             // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: return "PVRT_RGBA"; break;           // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: return "ASTC_4x4_RGBA"; break;   // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: return "ASTC_8x8_RGBA"; break;   // 2 bpp
-        default: return "UNKNOWN"; break;
+        hash ^= (unsigned char)text[i];
+        hash *= 16777619u;
     }
+
+    return hash;
 }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-// Load default shader (just vertex positioning and texture coloring)
-// NOTE: This shader program is used for internal buffers
-// NOTE: Loaded: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
-static void rlLoadShaderDefault(void)
+// Get shader program binary cache key (false if cache not available)
+// NOTE: Key is made of shaders code and driver strings hashes, NULL code means default shader code
+static bool rlGetShaderCacheKey(const char *vsCode, const char *fsCode, char *key)
 {
-    RLGL.State.defaultShaderLocs = (int *)ASC_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+    if (!RLGL.ExtSupported.programBinary || (RLGL.ShaderCache.load == NULL) || (RLGL.ShaderCache.save == NULL)) return false;
 
-    // NOTE: All locations must be reseted to -1 (no location)
-    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.defaultShaderLocs[i] = -1;
+    // NOTE: Attribute locations binded on linking (rlLoadShaderProgram()) are kept into program binary
+    const char *layout = RL_SHADER_CACHE_VERSION
+        " 0:" RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION " 1:" RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD
+        " 2:" RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL " 3:" RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR
+        " 4:" RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT " 5:" RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2
+        " 6:" RL_DEFAULT_SHADER_ATTRIB_NAME_TEXUNIT " 7:" RL_DEFAULT_SHADER_ATTRIB_NAME_SHAPE
+        " 8:" RL_DEFAULT_SHADER_ATTRIB_NAME_DRAWUNIT;
 
-    // Vertex shader directly defined, no external file required
-    const char *defaultVShaderCode =
-#if defined(GRAPHICS_API_OPENGL_21)
-    "#version 120                       \n"
-    "attribute vec3 vertexPosition;     \n"
-    "attribute vec2 vertexTexCoord;     \n"
-    "attribute vec4 vertexColor;        \n"
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-#elif defined(GRAPHICS_API_OPENGL_33)
-    "#version 330                       \n"
-    "in vec3 vertexPosition;            \n"
-    "in vec2 vertexTexCoord;            \n"
-    "in vec4 vertexColor;               \n"
-    "out vec2 fragTexCoord;             \n"
-    "out vec4 fragColor;                \n"
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    "#version 100                       \n"
-    "attribute vec3 vertexPosition;     \n"
-    "attribute vec2 vertexTexCoord;     \n"
-    "attribute vec4 vertexColor;        \n"
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-#endif
-    "uniform mat4 mvp;                  \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    fragTexCoord = vertexTexCoord; \n"
-    "    fragColor = vertexColor;       \n"
-    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
-    "}                                  \n";
+    unsigned int hashes[6] = {
+        rlHashString((vsCode != NULL)? vsCode : RLGL.State.defaultVShaderCode),
+        rlHashString((fsCode != NULL)? fsCode : RLGL.State.defaultFShaderCode),
+        RLGL.ShaderCache.driverHash[0], RLGL.ShaderCache.driverHash[1], RLGL.ShaderCache.driverHash[2],
+        rlHashString(layout)
+    };
 
-    // Fragment shader directly defined, no external file required
-    const char *defaultFShaderCode =
-#if defined(GRAPHICS_API_OPENGL_21)
-    "#version 120                       \n"
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-    "uniform sampler2D texture0;        \n"
-    "uniform vec4 colDiffuse;           \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
-    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
-    "}                                  \n";
-#elif defined(GRAPHICS_API_OPENGL_33)
-    "#version 330       \n"
-    "in vec2 fragTexCoord;              \n"
-    "in vec4 fragColor;                 \n"
-    "out vec4 finalColor;               \n"
-    "uniform sampler2D texture0;        \n"
-    "uniform vec4 colDiffuse;           \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
-    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
-    "}                                  \n";
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    "#version 100                       \n"
-    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-    "uniform sampler2D texture0;        \n"
-    "uniform vec4 colDiffuse;           \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
-    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
-    "}                                  \n";
-#endif
+    const char *digits = "0123456789abcdef";
+
+    for (int i = 0; i < 6; i++)
+    {
+        for (int j = 0; j < 8; j++) key[i*8 + j] = digits[(hashes[i] >> (28 - j*4)) & 0xf];
+    }
 
-    // NOTE: Compiled vertex/fragment shaders are kept for re-use
-    RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
-    RLGL.State.defaultFShaderId = rlCompileShader(defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+    key[RL_SHADER_CACHE_KEY_SIZE - 1] = '\0';
 
-    RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+    return true;
+}
 
-    if (RLGL.State.defaultShaderId > 0)
+// Load shader program from binary cache (0 if not found or not valid)
+// NOTE: Cached data: binary format (unsigned int) followed by program binary
+static unsigned int rlLoadShaderBinary(const char *key)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33)
+    int dataSize = 0;
+    unsigned char *data = RLGL.ShaderCache.load(key, &dataSize);
+
+    if (data == NULL) return 0;
+
+    if (dataSize > (int)sizeof(unsigned int))
     {
-        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader loaded successfully", RLGL.State.defaultShaderId);
+        unsigned int format = 0;
+        memcpy(&format, data, sizeof(unsigned int));
 
-        // Set default shader locations: attributes locations
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexPosition");
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexTexCoord");
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexColor");
+        id = glCreateProgram();
+        glProgramBinary(id, format, data + sizeof(unsigned int), dataSize - sizeof(unsigned int));
 
-        // Set default shader locations: uniform locations
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_MVP]  = glGetUniformLocation(RLGL.State.defaultShaderId, "mvp");
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "colDiffuse");
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "texture0");
+        // NOTE: Binary is rejected if driver changed or binary is corrupted, program is not linked
+        GLint success = 0;
+        glGetProgramiv(id, GL_LINK_STATUS, &success);
+
+        if (success == GL_FALSE)
+        {
+            glDeleteProgram(id);
+            id = 0;
+        }
     }
-    else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
+
+    ASC_FREE(data);
+
+    if (id > 0)
+    {
+        rlLoadShaderUniforms(id);
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded from binary cache (%s)", id, key);
+    }
+    else TRACELOG(RL_LOG_WARNING, "SHADER: Program binary cache not valid (%s), compiling from source", key);
+#endif
+    return id;
 }
 
-// Unload default shader
-// NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
-static void rlUnloadShaderDefault(void)
+// Save shader program binary into cache
+static void rlSaveShaderBinary(unsigned int id, const char *key)
 {
-    glUseProgram(0);
+#if defined(GRAPHICS_API_OPENGL_33)
+    GLint binarySize = 0;
+    glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+
+    if (binarySize > 0)
+    {
+        unsigned char *data = (unsigned char *)ASC_MALLOC(sizeof(unsigned int) + binarySize);
+        GLsizei length = 0;
+        GLenum format = 0;
 
-    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
-    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
-    glDeleteShader(RLGL.State.defaultVShaderId);
-    glDeleteShader(RLGL.State.defaultFShaderId);
+        glGetProgramBinary(id, binarySize, &length, &format, data + sizeof(unsigned int));
 
-    glDeleteProgram(RLGL.State.defaultShaderId);
+        if (length > 0)
+        {
+            unsigned int binaryFormat = (unsigned int)format;
+            memcpy(data, &binaryFormat, sizeof(unsigned int));
+            RLGL.ShaderCache.save(key, data, sizeof(unsigned int) + length);
 
-    ASC_FREE(RLGL.State.defaultShaderLocs);
+            TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader binary saved into cache (%s)", id, key);
+        }
 
-    TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
+        ASC_FREE(data);
+    }
+#endif
 }
 
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
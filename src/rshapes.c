@@ -40,7 +40,8 @@
 
 #include "rlgl.h"       // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 
-#include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf()
+#include <stdlib.h>     // Required for: malloc(), free() [Used by ASC_MALLOC(), ASC_FREE() defaults]
+#include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf(), powf(), ceilf(), atan2f()
 #include <float.h>      // Required for: FLT_EPSILON
 
 //----------------------------------------------------------------------------------
@@ -53,6 +54,26 @@
     #define SMOOTH_CIRCLE_ERROR_RATE  0.5f
 #endif
 
+// Segments used to tessellate shapes when they can not be evaluated per fragment
+// NOTE: Only used with OpenGL 1.1 or custom shaders, rounded boxes use segments per corner
+#define SHAPE_FALLBACK_SEGMENTS         36
+#define SHAPE_FALLBACK_CORNER_SEGMENTS   9
+
+// Maximum sides of regular polygons with precomputed unit polygon table
+// NOTE: Polygons with more sides (or computed from radius) are rotated incrementally
+#ifndef SHAPE_POLY_TABLE_MAX_SIDES
+    #define SHAPE_POLY_TABLE_MAX_SIDES      64
+#endif
+
+// Offset of unit polygon of n sides in polygon tables (tables from 3 sides)
+#define SHAPE_POLY_TABLE_OFFSET(sides)  ((sides)*((sides) - 1)/2 - 3)
+
+// Maximum vertex added to render batch at once by shapes drawn from vertex arrays
+#define SHAPE_VERTEX_CHUNK             768
+
+// Maximum length of lines joins, relative to line half thickness (sharp angles are cut)
+#define SHAPE_LINE_MITER_LIMIT          4.0f
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -64,10 +85,40 @@
 Texture2D texShapes = { 1, 1, 1, 1, 7 };        // Texture used on shapes drawing (usually a white pixel)
 Rectangle texShapesRec = { 0, 0, 1, 1 };        // Texture source rectangle used on shapes drawing
 
+// Unit polygons points (radius 1.0f, no rotation), from 3 to SHAPE_POLY_TABLE_MAX_SIDES sides
+// NOTE: Computed once on InitWindow(), read-only afterwards (shapes can be drawn from any thread)
+static Vector2 polyTables[SHAPE_POLY_TABLE_OFFSET(SHAPE_POLY_TABLE_MAX_SIDES + 1)] = { 0 };
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
+static void DrawShapeSDF(int type, Vector2 center, Vector2 halfSize, float radius, float thickness, float rotation, Color color);   // Draw shape as a single quad
+static int GetShapeOutline(int type, Vector2 halfSize, float radius, Vector2 *points);    // Get shape outline points (tessellated fallback)
+static int GetPolySides(int sides, float radius);                   // Get regular polygon sides, computed from radius if not provided
+static void GetPolyPoints(int sides, float radius, float rotation, Vector2 center, Vector2 *points);     // Get regular polygon points
+static void DrawVertexArray(const float *vertices, int vertexCount, Color color);   // Draw triangles vertex array, split on batch limits
+static Vector2 GetLineJoinOffset(const Vector2 *points, int pointCount, int index, float halfThick);  // Get line join offset from point (miter)
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Internal
+//----------------------------------------------------------------------------------
+
+// Load unit polygons tables
+// NOTE: Required by Shape_DrawPoly(), called on InitWindow()
+void LoadShapesTables(void)
+{
+    for (int sides = 3; sides <= SHAPE_POLY_TABLE_MAX_SIDES; sides++)
+    {
+        Vector2 *points = polyTables + SHAPE_POLY_TABLE_OFFSET(sides);
+
+        for (int i = 0; i < sides; i++)
+        {
+            float angle = DEG2RAD*360.0f*(float)i/(float)sides;
+            points[i] = (Vector2){ sinf(angle), cosf(angle) };
+        }
+    }
+}
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -85,42 +136,96 @@ void Shape_SetTexture(Texture2D texture, Rectangle source)
 // Draw a line
 void Shape_DrawLine(int startPosX, int startPosY, int endPosX, int endPosY, Color color)
 {
+#if defined(SUPPORT_LINES_AS_QUADS)
+    Shape_DrawLineEx((Vector2){ (float)startPosX, (float)startPosY }, (Vector2){ (float)endPosX, (float)endPosY }, 1.0f, color);
+#else
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
         rlVertex2i(startPosX, startPosY);
         rlVertex2i(endPosX, endPosY);
     rlEnd();
+#endif
 }
 
 // Draw a line  (Vector version)
 void Shape_DrawLineV(Vector2 startPos, Vector2 endPos, Color color)
 {
+#if defined(SUPPORT_LINES_AS_QUADS)
+    Shape_DrawLineEx(startPos, endPos, 1.0f, color);
+#else
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
         rlVertex2f(startPos.x, startPos.y);
         rlVertex2f(endPos.x, endPos.y);
     rlEnd();
+#endif
 }
 
 // Draw a line defining thickness
 void Shape_DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color)
 {
-    Vector2 delta = { endPos.x - startPos.x, endPos.y - startPos.y };
-    float length = sqrtf(delta.x*delta.x + delta.y*delta.y);
+    Vector2 points[2] = { startPos, endPos };
 
-    if ((length > 0) && (thick > 0))
-    {
-        float scale = thick/(2*length);
-        Vector2 radius = { -scale*delta.y, scale*delta.x };
-        Vector2 strip[4] = {
-            { startPos.x - radius.x, startPos.y - radius.y },
-            { startPos.x + radius.x, startPos.y + radius.y },
-            { endPos.x - radius.x, endPos.y - radius.y },
-            { endPos.x + radius.x, endPos.y + radius.y }
-        };
-
-        Shape_DrawTriangleStrip(strip, 4, color);
-    }
+    Shape_DrawLines(points, 2, thick, color);
+}
+
+// Draw lines sequence defining thickness
+// NOTE: Consecutive segments share joins points (miter), no overlapping or gaps between segments
+void Shape_DrawLines(Vector2 *points, int pointCount, float thick, Color color)
+{
+    if ((pointCount < 2) || (thick <= 0.0f)) return;
+
+    float halfThick = thick*0.5f;
+    Vector2 offset = GetLineJoinOffset(points, pointCount, 0, halfThick);
+
+    rlSetTexture(texShapes.id);
+
+#if defined(SUPPORT_QUADS_DRAW_MODE)
+    rlBegin(RL_QUADS);
+#else
+    rlBegin(RL_TRIANGLES);
+#endif
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
+        for (int i = 1; i < pointCount; i++)
+        {
+            Vector2 nextOffset = GetLineJoinOffset(points, pointCount, i, halfThick);
+
+            Vector2 topLeft = { points[i - 1].x - offset.x, points[i - 1].y - offset.y };
+            Vector2 bottomLeft = { points[i - 1].x + offset.x, points[i - 1].y + offset.y };
+            Vector2 bottomRight = { points[i].x + nextOffset.x, points[i].y + nextOffset.y };
+            Vector2 topRight = { points[i].x - nextOffset.x, points[i].y - nextOffset.y };
+
+#if defined(SUPPORT_QUADS_DRAW_MODE)
+            rlCheckRenderBatchLimit(4);
+
+            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+            rlVertex2f(topLeft.x, topLeft.y);
+
+            rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            rlVertex2f(bottomLeft.x, bottomLeft.y);
+
+            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            rlVertex2f(bottomRight.x, bottomRight.y);
+
+            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+            rlVertex2f(topRight.x, topRight.y);
+#else
+            rlCheckRenderBatchLimit(6);
+
+            rlVertex2f(topLeft.x, topLeft.y);
+            rlVertex2f(bottomLeft.x, bottomLeft.y);
+            rlVertex2f(bottomRight.x, bottomRight.y);
+
+            rlVertex2f(topLeft.x, topLeft.y);
+            rlVertex2f(bottomRight.x, bottomRight.y);
+            rlVertex2f(topRight.x, topRight.y);
+#endif
+            offset = nextOffset;
+        }
+    rlEnd();
+
+    rlSetTexture(0);
 }
 
 // Draw a color-filled rectangle
@@ -145,8 +250,6 @@ void Shape_DrawRecRec(Rectangle rec, Color color)
 // Draw a color-filled rectangle with pro parameters
 void Shape_DrawRecPro(Rectangle rec, Vector2 origin, float rotation, Color color)
 {
-    rlCheckRenderBatchLimit(4);
-
     Vector2 topLeft = { 0 };
     Vector2 topRight = { 0 };
     Vector2 bottomLeft = { 0 };
@@ -184,6 +287,11 @@ void Shape_DrawRecPro(Rectangle rec, Vector2 origin, float rotation, Color color
         bottomRight.y = y + (dx + rec.width)*sinRotation + (dy + rec.height)*cosRotation;
     }
 
+    // Reject quad out of view before adding any vertex (if view culling enabled)
+    if (rlIsQuadCulled(topLeft.x, topLeft.y, bottomLeft.x, bottomLeft.y, bottomRight.x, bottomRight.y, topRight.x, topRight.y)) return;
+
+    rlCheckRenderBatchLimit(4);
+
     rlSetTexture(texShapes.id);
     rlBegin(RL_QUADS);
 
@@ -206,6 +314,61 @@ void Shape_DrawRecPro(Rectangle rec, Vector2 origin, float rotation, Color color
     rlSetTexture(0);
 }
 
+// Draw a color-filled circle
+void Shape_DrawCircle(int centerX, int centerY, float radius, Color color)
+{
+    Shape_DrawCircleV((Vector2){ (float)centerX, (float)centerY }, radius, color);
+}
+
+// Draw a color-filled circle (Vector version)
+void Shape_DrawCircleV(Vector2 center, float radius, Color color)
+{
+    DrawShapeSDF(RL_SHAPE_ROUNDED_BOX, center, (Vector2){ radius, radius }, radius, 0.0f, 0.0f, color);
+}
+
+// Draw a color-filled ellipse
+void Shape_DrawEllipse(Vector2 center, float radiusH, float radiusV, Color color)
+{
+    DrawShapeSDF(RL_SHAPE_ELLIPSE, center, (Vector2){ radiusH, radiusV }, 0.0f, 0.0f, 0.0f, color);
+}
+
+// Draw a color-filled ring
+void Shape_DrawRing(Vector2 center, float innerRadius, float outerRadius, Color color)
+{
+    if (innerRadius > outerRadius)
+    {
+        float tmp = outerRadius;
+        outerRadius = innerRadius;
+        innerRadius = tmp;
+    }
+
+    DrawShapeSDF(RL_SHAPE_ROUNDED_BOX, center, (Vector2){ outerRadius, outerRadius }, outerRadius, outerRadius - innerRadius, 0.0f, color);
+}
+
+// Draw a color-filled capsule (line with rounded ends)
+void Shape_DrawCapsule(Vector2 startPos, Vector2 endPos, float radius, Color color)
+{
+    float dx = endPos.x - startPos.x;
+    float dy = endPos.y - startPos.y;
+    float length = sqrtf(dx*dx + dy*dy);
+
+    Vector2 center = { startPos.x + dx*0.5f, startPos.y + dy*0.5f };
+    DrawShapeSDF(RL_SHAPE_ROUNDED_BOX, center, (Vector2){ length*0.5f + radius, radius }, radius, 0.0f, atan2f(dy, dx)*RAD2DEG, color);
+}
+
+// Draw a color-filled rectangle with rounded corners
+// NOTE: Roundness goes from 0.0f (rectangle) to 1.0f (corners radius is half the shortest side)
+void Shape_DrawRecRounded(Rectangle rec, float roundness, Color color)
+{
+    if (roundness < 0.0f) roundness = 0.0f;
+    if (roundness > 1.0f) roundness = 1.0f;
+
+    float radius = roundness*((rec.width < rec.height)? rec.width : rec.height)*0.5f;
+    Vector2 center = { rec.x + rec.width*0.5f, rec.y + rec.height*0.5f };
+
+    DrawShapeSDF(RL_SHAPE_ROUNDED_BOX, center, (Vector2){ rec.width*0.5f, rec.height*0.5f }, radius, 0.0f, 0.0f, color);
+}
+
 //// Draw a vertical-gradient-filled rectangle
 //// NOTE: Gradient goes from bottom (color1) to top (color2)
 //void DrawRectangleGradientV(int posX, int posY, int width, int height, Color color1, Color color2)
@@ -516,35 +679,44 @@ void Shape_DrawTriangleStrip(Vector2 *points, int pointCount, Color color)
 {
     if (pointCount >= 3)
     {
-        rlCheckRenderBatchLimit(3*(pointCount - 2));
+        // Strip is converted to triangles in chunks, vertex are added to batch at once
+        float vertices[2*3*(SHAPE_VERTEX_CHUNK/3)] = { 0 };
+        int vertexCount = 0;
 
-        rlBegin(RL_TRIANGLES);
-            rlColor4ub(color.r, color.g, color.b, color.a);
+        rlSetTexture(texShapes.id);
+        rlTexCoord2f((texShapesRec.x + texShapesRec.width*0.5f)/texShapes.width, (texShapesRec.y + texShapesRec.height*0.5f)/texShapes.height);
+
+        for (int i = 2; i < pointCount; i++)
+        {
+            // Keep triangles winding, odd triangles have last two points swapped
+            Vector2 v1 = points[i];
+            Vector2 v2 = ((i%2) == 0)? points[i - 2] : points[i - 1];
+            Vector2 v3 = ((i%2) == 0)? points[i - 1] : points[i - 2];
 
-            for (int i = 2; i < pointCount; i++)
+            vertices[2*vertexCount] = v1.x;
+            vertices[2*vertexCount + 1] = v1.y;
+            vertices[2*vertexCount + 2] = v2.x;
+            vertices[2*vertexCount + 3] = v2.y;
+            vertices[2*vertexCount + 4] = v3.x;
+            vertices[2*vertexCount + 5] = v3.y;
+            vertexCount += 3;
+
+            if ((vertexCount == 3*(SHAPE_VERTEX_CHUNK/3)) || (i == (pointCount - 1)))
             {
-                if ((i%2) == 0)
-                {
-                    rlVertex2f(points[i].x, points[i].y);
-                    rlVertex2f(points[i - 2].x, points[i - 2].y);
-                    rlVertex2f(points[i - 1].x, points[i - 1].y);
-                }
-                else
-                {
-                    rlVertex2f(points[i].x, points[i].y);
-                    rlVertex2f(points[i - 1].x, points[i - 1].y);
-                    rlVertex2f(points[i - 2].x, points[i - 2].y);
-                }
+                DrawVertexArray(vertices, vertexCount, color);
+                vertexCount = 0;
             }
-        rlEnd();
+        }
+
+        rlSetTexture(0);
     }
 }
 
 // Draw a regular polygon of n sides (Vector version)
+// NOTE: If sides is 0, sides are computed from radius to look smooth (level of detail)
 void Shape_DrawPoly(Vector2 center, int sides, float radius, float rotation, Color color)
 {
-    if (sides < 3) sides = 3;
-    float centralAngle = 0.0f;
+    sides = GetPolySides(sides, radius);
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlCheckRenderBatchLimit(4*sides); // Each side is a quad
@@ -552,46 +724,380 @@ void Shape_DrawPoly(Vector2 center, int sides, float radius, float rotation, Col
     rlCheckRenderBatchLimit(3*sides);
 #endif
 
-    rlPushMatrix();
-        rlTranslatef(center.x, center.y, 0.0f);
-        rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+    // Polygon points with rotation, last point closes the polygon
+    Vector2 localPoints[SHAPE_POLY_TABLE_MAX_SIDES + 1] = { 0 };
+    Vector2 *points = (sides <= SHAPE_POLY_TABLE_MAX_SIDES)? localPoints : (Vector2 *)ASC_MALLOC((sides + 1)*sizeof(Vector2));
+
+    GetPolyPoints(sides, radius, rotation, center, points);
+    points[sides] = points[0];
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
-        rlSetTexture(texShapes.id);
+    rlSetTexture(texShapes.id);
 
-        rlBegin(RL_QUADS);
-            for (int i = 0; i < sides; i++)
-            {
-                rlColor4ub(color.r, color.g, color.b, color.a);
+    rlBegin(RL_QUADS);
+        rlColor4ub(color.r, color.g, color.b, color.a);
 
-                rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(0, 0);
+        for (int i = 0; i < sides; i++)
+        {
+            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+            rlVertex2f(center.x, center.y);
 
-                rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
+            rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            rlVertex2f(points[i].x, points[i].y);
 
-                rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
+            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+            rlVertex2f(points[i].x, points[i].y);
 
-                centralAngle += 360.0f/(float)sides;
-                rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
-            }
-        rlEnd();
-        rlSetTexture(0);
+            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+            rlVertex2f(points[i + 1].x, points[i + 1].y);
+        }
+    rlEnd();
+    rlSetTexture(0);
 #else
-        rlBegin(RL_TRIANGLES);
-            for (int i = 0; i < sides; i++)
+    rlBegin(RL_TRIANGLES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
+        for (int i = 0; i < sides; i++)
+        {
+            rlVertex2f(center.x, center.y);
+            rlVertex2f(points[i].x, points[i].y);
+            rlVertex2f(points[i + 1].x, points[i + 1].y);
+        }
+    rlEnd();
+#endif
+
+    if (points != localPoints) ASC_FREE(points);
+}
+
+// Load regular polygon mesh centered at origin
+// NOTE: If sides is 0, sides are computed from radius to look smooth (level of detail)
+ShapeMesh Shape_LoadPoly(int sides, float radius, float rotation)
+{
+    ShapeMesh mesh = { 0 };
+
+    sides = GetPolySides(sides, radius);
+
+    Vector2 *points = (Vector2 *)ASC_MALLOC((sides + 1)*sizeof(Vector2));
+    GetPolyPoints(sides, radius, rotation, (Vector2){ 0.0f, 0.0f }, points);
+    points[sides] = points[0];
+
+    mesh.vertexCount = 3*sides;
+    mesh.vertices = (float *)ASC_MALLOC(2*mesh.vertexCount*sizeof(float));
+
+    for (int i = 0; i < sides; i++)
+    {
+        float *triangle = mesh.vertices + 6*i;
+
+        triangle[0] = 0.0f;
+        triangle[1] = 0.0f;
+        triangle[2] = points[i].x;
+        triangle[3] = points[i].y;
+        triangle[4] = points[i + 1].x;
+        triangle[5] = points[i + 1].y;
+    }
+
+    ASC_FREE(points);
+
+    return mesh;
+}
+
+// Load triangle strip mesh defined by points
+// NOTE: Every new vertex connects with previous two
+ShapeMesh Shape_LoadTriangleStrip(Vector2 *points, int pointCount)
+{
+    ShapeMesh mesh = { 0 };
+
+    if (pointCount >= 3)
+    {
+        mesh.vertexCount = 3*(pointCount - 2);
+        mesh.vertices = (float *)ASC_MALLOC(2*mesh.vertexCount*sizeof(float));
+
+        for (int i = 2; i < pointCount; i++)
+        {
+            float *triangle = mesh.vertices + 6*(i - 2);
+
+            // Keep triangles winding, odd triangles have last two points swapped
+            Vector2 v2 = ((i%2) == 0)? points[i - 2] : points[i - 1];
+            Vector2 v3 = ((i%2) == 0)? points[i - 1] : points[i - 2];
+
+            triangle[0] = points[i].x;
+            triangle[1] = points[i].y;
+            triangle[2] = v2.x;
+            triangle[3] = v2.y;
+            triangle[4] = v3.x;
+            triangle[5] = v3.y;
+        }
+    }
+
+    return mesh;
+}
+
+// Unload shape mesh from memory (RAM)
+void Shape_UnloadMesh(ShapeMesh mesh)
+{
+    ASC_FREE(mesh.vertices);
+}
+
+// Draw shape mesh at position
+// NOTE: Mesh vertex are added to render batch as raw vertex ranges, no tessellation required
+void Shape_DrawMesh(ShapeMesh mesh, Vector2 position, Color color)
+{
+    if (mesh.vertexCount <= 0) return;
+
+    rlSetTexture(texShapes.id);
+    rlTexCoord2f((texShapesRec.x + texShapesRec.width*0.5f)/texShapes.width, (texShapesRec.y + texShapesRec.height*0.5f)/texShapes.height);
+
+    rlPushMatrix();
+        rlTranslatef(position.x, position.y, 0.0f);
+
+        for (int i = 0; i < mesh.vertexCount; i += SHAPE_VERTEX_CHUNK)
+        {
+            int vertexCount = mesh.vertexCount - i;
+            if (vertexCount > SHAPE_VERTEX_CHUNK) vertexCount = SHAPE_VERTEX_CHUNK;
+
+            DrawVertexArray(mesh.vertices + 2*i, vertexCount, color);
+        }
+    rlPopMatrix();
+
+    rlSetTexture(0);
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Draw shape as a single quad, shape border is evaluated per fragment by default shader (signed distance field)
+// NOTE: Shape is tessellated if it can not be evaluated per fragment (OpenGL 1.1, custom shader)
+static void DrawShapeSDF(int type, Vector2 center, Vector2 halfSize, float radius, float thickness, float rotation, Color color)
+{
+    if ((halfSize.x <= 0.0f) || (halfSize.y <= 0.0f)) return;
+
+    if (radius > halfSize.x) radius = halfSize.x;
+    if (radius > halfSize.y) radius = halfSize.y;
+
+    // Quad is expanded one unit around shape to keep anti-aliased border
+    Vector2 corners[4] = {
+        { -halfSize.x - 1.0f, -halfSize.y - 1.0f },     // Top-left
+        { -halfSize.x - 1.0f, halfSize.y + 1.0f },      // Bottom-left
+        { halfSize.x + 1.0f, halfSize.y + 1.0f },       // Bottom-right
+        { halfSize.x + 1.0f, -halfSize.y - 1.0f }       // Top-right
+    };
+    Vector2 positions[4] = { 0 };
+
+    float sinRotation = sinf(rotation*DEG2RAD);
+    float cosRotation = cosf(rotation*DEG2RAD);
+
+    for (int i = 0; i < 4; i++)
+    {
+        positions[i].x = center.x + corners[i].x*cosRotation - corners[i].y*sinRotation;
+        positions[i].y = center.y + corners[i].x*sinRotation + corners[i].y*cosRotation;
+    }
+
+    // Reject shape out of view before adding any vertex (if view culling enabled)
+    if (rlIsQuadCulled(positions[0].x, positions[0].y, positions[1].x, positions[1].y, positions[2].x, positions[2].y, positions[3].x, positions[3].y)) return;
+
+    if (rlSetShape(type, halfSize.x, halfSize.y, radius, thickness))
+    {
+        rlCheckRenderBatchLimit(4);
+
+        rlBegin(RL_QUADS);
+            rlColor4ub(color.r, color.g, color.b, color.a);
+
+            for (int i = 0; i < 4; i++)
             {
+                // Texture coordinates define fragment position from shape center
+                rlTexCoord2f(corners[i].x, corners[i].y);
+                rlVertex2f(positions[i].x, positions[i].y);
+            }
+        rlEnd();
+
+        rlSetShape(RL_SHAPE_NONE, 0.0f, 0.0f, 0.0f, 0.0f);
+    }
+    else
+    {
+        Vector2 outer[4*(SHAPE_FALLBACK_CORNER_SEGMENTS + 1)] = { 0 };
+        Vector2 inner[4*(SHAPE_FALLBACK_CORNER_SEGMENTS + 1)] = { 0 };
+
+        int pointCount = GetShapeOutline(type, halfSize, radius, outer);
+
+        // Outline shapes are drawn between outer and inner outlines, filled shapes around center
+        if (thickness > 0.0f)
+        {
+            Vector2 innerHalfSize = { halfSize.x - thickness, halfSize.y - thickness };
+            if (innerHalfSize.x < 0.0f) innerHalfSize.x = 0.0f;
+            if (innerHalfSize.y < 0.0f) innerHalfSize.y = 0.0f;
+
+            GetShapeOutline(type, innerHalfSize, (radius > thickness)? radius - thickness : 0.0f, inner);
+        }
+
+        rlCheckRenderBatchLimit(4*pointCount);
+
+        rlPushMatrix();
+            rlTranslatef(center.x, center.y, 0.0f);
+            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+
+            rlSetTexture(texShapes.id);
+
+            rlBegin(RL_QUADS);
                 rlColor4ub(color.r, color.g, color.b, color.a);
 
-                rlVertex2f(0, 0);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
+                for (int i = 0; i < pointCount; i++)
+                {
+                    int next = (i + 1)%pointCount;
+
+                    rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+                    rlVertex2f(inner[i].x, inner[i].y);
 
-                centralAngle += 360.0f/(float)sides;
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
+                    rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+                    rlVertex2f(outer[i].x, outer[i].y);
+
+                    rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+                    rlVertex2f(outer[next].x, outer[next].y);
+
+                    rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+                    rlVertex2f(inner[next].x, inner[next].y);
+                }
+            rlEnd();
+            rlSetTexture(0);
+        rlPopMatrix();
+    }
+}
+
+// Get shape outline points around shape center (same winding as Shape_DrawPoly())
+// NOTE: Points array must fit 4*(SHAPE_FALLBACK_CORNER_SEGMENTS + 1) points
+static int GetShapeOutline(int type, Vector2 halfSize, float radius, Vector2 *points)
+{
+    int pointCount = 0;
+
+    if (type == RL_SHAPE_ELLIPSE)
+    {
+        for (int i = 0; i < SHAPE_FALLBACK_SEGMENTS; i++)
+        {
+            float angle = DEG2RAD*360.0f*(float)i/SHAPE_FALLBACK_SEGMENTS;
+            points[pointCount++] = (Vector2){ sinf(angle)*halfSize.x, cosf(angle)*halfSize.y };
+        }
+    }
+    else
+    {
+        // Corners arcs: bottom-right, top-right, top-left, bottom-left
+        for (int corner = 0; corner < 4; corner++)
+        {
+            float cx = (corner < 2)? halfSize.x - radius : radius - halfSize.x;
+            float cy = ((corner == 0) || (corner == 3))? halfSize.y - radius : radius - halfSize.y;
+
+            for (int i = 0; i <= SHAPE_FALLBACK_CORNER_SEGMENTS; i++)
+            {
+                float angle = DEG2RAD*90.0f*((float)corner + (float)i/SHAPE_FALLBACK_CORNER_SEGMENTS);
+                points[pointCount++] = (Vector2){ cx + sinf(angle)*radius, cy + cosf(angle)*radius };
             }
-        rlEnd();
-#endif
-    rlPopMatrix();
+        }
+    }
+
+    return pointCount;
+}
+
+// Get regular polygon sides, computed from radius if not provided (smooth polygon)
+// NOTE: Segments are computed so that error is below SMOOTH_CIRCLE_ERROR_RATE units
+static int GetPolySides(int sides, float radius)
+{
+    if ((sides <= 0) && (radius > SMOOTH_CIRCLE_ERROR_RATE))
+    {
+        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
+        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
+        sides = (int)ceilf(2*PI/th);
+    }
+
+    if (sides < 3) sides = 3;
+
+    return sides;
+}
+
+// Get regular polygon points
+// NOTE: Unit polygon tables are scaled and rotated with a single 2x2 transform
+static void GetPolyPoints(int sides, float radius, float rotation, Vector2 center, Vector2 *points)
+{
+    float sinRotation = sinf(rotation*DEG2RAD);
+    float cosRotation = cosf(rotation*DEG2RAD);
+
+    // Rotation and scale transform: [ a -b ]
+    //                               [ b  a ]
+    float a = cosRotation*radius;
+    float b = sinRotation*radius;
+
+    if (sides <= SHAPE_POLY_TABLE_MAX_SIDES)
+    {
+        const Vector2 *unit = polyTables + SHAPE_POLY_TABLE_OFFSET(sides);
+
+        for (int i = 0; i < sides; i++)
+        {
+            points[i].x = center.x + unit[i].x*a - unit[i].y*b;
+            points[i].y = center.y + unit[i].x*b + unit[i].y*a;
+        }
+    }
+    else
+    {
+        // No table available, unit point rotated incrementally by central angle
+        float sinStep = sinf(2*PI/(float)sides);
+        float cosStep = cosf(2*PI/(float)sides);
+        Vector2 unit = { 0.0f, 1.0f };
+
+        for (int i = 0; i < sides; i++)
+        {
+            points[i].x = center.x + unit.x*a - unit.y*b;
+            points[i].y = center.y + unit.x*b + unit.y*a;
+
+            // Increasing angle from (sinf(angle), cosf(angle))
+            unit = (Vector2){ unit.x*cosStep + unit.y*sinStep, unit.y*cosStep - unit.x*sinStep };
+        }
+    }
+}
+
+// Draw triangles vertex array with current texture and texcoord
+// NOTE: Vertex count must fit in a render batch, see SHAPE_VERTEX_CHUNK
+static void DrawVertexArray(const float *vertices, int vertexCount, Color color)
+{
+    rlCheckRenderBatchLimit(vertexCount);
+
+    rlBegin(RL_TRIANGLES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        rlVertexArray2f(vertices, vertexCount);
+    rlEnd();
+}
+
+// Get line join offset from point, perpendicular to lines (left side is point - offset)
+// NOTE: Join between two segments is the miter point, limited to SHAPE_LINE_MITER_LIMIT
+static Vector2 GetLineJoinOffset(const Vector2 *points, int pointCount, int index, float halfThick)
+{
+    Vector2 normals[2] = { 0 };
+    int normalCount = 0;
+
+    // Normals of segments before and after point (zero length segments are skipped)
+    for (int i = index - 1; i <= index; i++)
+    {
+        if ((i < 0) || (i >= (pointCount - 1))) continue;
+
+        float dx = points[i + 1].x - points[i].x;
+        float dy = points[i + 1].y - points[i].y;
+        float length = sqrtf(dx*dx + dy*dy);
+
+        if (length > 0.0f) normals[normalCount++] = (Vector2){ -dy/length, dx/length };
+    }
+
+    if (normalCount == 0) return (Vector2){ 0.0f, 0.0f };
+    if (normalCount == 1) return (Vector2){ normals[0].x*halfThick, normals[0].y*halfThick };
+
+    // Miter direction is the normals bisector, length keeps thickness along both segments
+    Vector2 miter = { normals[0].x + normals[1].x, normals[0].y + normals[1].y };
+    float miterLength = sqrtf(miter.x*miter.x + miter.y*miter.y);
+
+    if (miterLength < FLT_EPSILON) return (Vector2){ normals[0].x*halfThick, normals[0].y*halfThick };  // Segments going back
+
+    miter.x /= miterLength;
+    miter.y /= miterLength;
+
+    float cosHalfAngle = miter.x*normals[0].x + miter.y*normals[0].y;
+    float scale = halfThick/cosHalfAngle;
+    if (scale > halfThick*SHAPE_LINE_MITER_LIMIT) scale = halfThick*SHAPE_LINE_MITER_LIMIT;
+
+    return (Vector2){ miter.x*scale, miter.y*scale };
 }
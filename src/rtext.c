@@ -83,7 +83,18 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Glyphs loading parameters shared by all job batches
+typedef struct GlyphLoadBatch {
+    const stbtt_fontinfo *fontInfo;     // Font info (read-only)
+    GlyphInfo *chars;                   // Output glyphs
+    const int *fontChars;               // Codepoints to load
+    float scaleFactor;                  // Font scale factor for requested size
+    int ascent;                         // Font ascent (baseline), unscaled
+    int fontSize;                       // Font size in pixels
+    int type;                           // Font type (FONT_DEFAULT, FONT_BITMAP, FONT_SDF)
+} GlyphLoadBatch;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -112,6 +123,9 @@ extern void UnloadFontDefault(void);
 #endif
 
 static Color *LoadImageColors(Image image);
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static void Glyph_LoadBatch(void *data, int start, int end);                                  // Load glyphs data for chars [start, end), run as job system batch
+#endif
 
 static GlyphInfo *Glyph_Load(const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount, int type);      // Load font data for further use
 static Image Glyph_GenAtlas(const GlyphInfo *chars, Rectangle **recs, int glyphCount, int fontSize, int padding, int packMethod);      // Generate image font atlas using chars info
@@ -585,66 +599,9 @@ static GlyphInfo *Glyph_Load(const unsigned char *fileData, int dataSize, int fo
             chars = (GlyphInfo *)ASC_MALLOC(glyphCount*sizeof(GlyphInfo));
 
             // NOTE: Using simple packaging, one char after another
-            for (int i = 0; i < glyphCount; i++)
-            {
-                int chw = 0, chh = 0;   // Character width and height (on generation)
-                int ch = fontChars[i];  // Character value to get info for
-                chars[i].value = ch;
-
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
-
-                if (type != FONT_SDF) chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-                else if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-                else chars[i].image.data = NULL;
-
-                stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                // Load characters images
-                chars[i].image.width = chw;
-                chars[i].image.height = chh;
-                chars[i].image.mipmaps = 1;
-                chars[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-
-                chars[i].offsetY += (int)((float)ascent*scaleFactor);
-
-                // NOTE: We create an empty image for space character, it could be further required for atlas packing
-                if (ch == 32)
-                {
-                    Image imSpace = {
-                        .data = calloc(chars[i].advanceX*fontSize, 2),
-                        .width = chars[i].advanceX,
-                        .height = fontSize,
-                        .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE,
-                        .mipmaps = 1
-                    };
-
-                    chars[i].image = imSpace;
-                }
-
-                if (type == FONT_BITMAP)
-                {
-                    // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                    // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                    for (int p = 0; p < chw*chh; p++)
-                    {
-                        if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                        else ((unsigned char *)chars[i].image.data)[p] = 255;
-                    }
-                }
-
-                // Get bounding box for character (may be offset to account for chars that dip above or below the line)
-                /*
-                int chX1, chY1, chX2, chY2;
-                stbtt_GetCodepointBitmapBox(&fontInfo, ch, scaleFactor, scaleFactor, &chX1, &chY1, &chX2, &chY2);
-
-                TRACELOGD("FONT: Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
-                TRACELOGD("FONT: Character offsetY: %i", (int)((float)ascent*scaleFactor) + chY1);
-                */
-            }
+            // NOTE: Glyphs are independent, they are rasterized in parallel batches (module: jobs)
+            GlyphLoadBatch batch = { &fontInfo, chars, fontChars, scaleFactor, ascent, fontSize, type };
+            Job_ParallelFor(Glyph_LoadBatch, &batch, glyphCount, 16, NULL);
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
 
@@ -1521,6 +1478,82 @@ static Font LoadBMFont(const char *fileName)
 #endif
 
 
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Load glyphs data for chars [start, end), run as job system batch
+static void Glyph_LoadBatch(void *data, int start, int end)
+{
+    GlyphLoadBatch *batch = (GlyphLoadBatch *)data;
+    const stbtt_fontinfo *fontInfo = batch->fontInfo;
+    GlyphInfo *chars = batch->chars;
+    const int *fontChars = batch->fontChars;
+    float scaleFactor = batch->scaleFactor;
+    int ascent = batch->ascent;
+    int fontSize = batch->fontSize;
+    int type = batch->type;
+
+    for (int i = start; i < end; i++)
+    {
+        int chw = 0, chh = 0;   // Character width and height (on generation)
+        int ch = fontChars[i];  // Character value to get info for
+        chars[i].value = ch;
+
+        //  Render a unicode codepoint to a bitmap
+        //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+        //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+        //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+
+        if (type != FONT_SDF) chars[i].image.data = stbtt_GetCodepointBitmap(fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
+        else if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
+        else chars[i].image.data = NULL;
+
+        stbtt_GetCodepointHMetrics(fontInfo, ch, &chars[i].advanceX, NULL);
+        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
+
+        // Load characters images
+        chars[i].image.width = chw;
+        chars[i].image.height = chh;
+        chars[i].image.mipmaps = 1;
+        chars[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+        chars[i].offsetY += (int)((float)ascent*scaleFactor);
+
+        // NOTE: We create an empty image for space character, it could be further required for atlas packing
+        if (ch == 32)
+        {
+            Image imSpace = {
+                .data = calloc(chars[i].advanceX*fontSize, 2),
+                .width = chars[i].advanceX,
+                .height = fontSize,
+                .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE,
+                .mipmaps = 1
+            };
+
+            chars[i].image = imSpace;
+        }
+
+        if (type == FONT_BITMAP)
+        {
+            // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+            // NOTE: For optimum results, bitmap font should be generated at base pixel size
+            for (int p = 0; p < chw*chh; p++)
+            {
+                if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
+                else ((unsigned char *)chars[i].image.data)[p] = 255;
+            }
+        }
+
+        // Get bounding box for character (may be offset to account for chars that dip above or below the line)
+        /*
+        int chX1, chY1, chX2, chY2;
+        stbtt_GetCodepointBitmapBox(fontInfo, ch, scaleFactor, scaleFactor, &chX1, &chY1, &chX2, &chY2);
+
+        TRACELOGD("FONT: Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
+        TRACELOGD("FONT: Character offsetY: %i", (int)((float)ascent*scaleFactor) + chY1);
+        */
+    }
+}
+#endif
+
 // Load color data from image as a Color array (RGBA - 32bit)
 // NOTE: Memory allocated should be freed using UnloadImageColors();
 static Color *LoadImageColors(Image image)
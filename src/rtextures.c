@@ -36,6 +36,7 @@
 *       stb_image        - Multiple image formats loading (JPEG, PNG, BMP, TGA, PSD, GIF, PIC)
 *                          NOTE: stb_image has been slightly modified to support Android platform.
 *       stb_image_resize - Multiple image resize algorythms
+*       stb_rect_pack    - Rectangles packing algorythms, required for texture atlas generation
 *
 *
 *   LICENSE: zlib/libpng
@@ -68,6 +69,7 @@
 
 #include "utils.h"              // Required for: TRACELOG() and fopen() Android mapping
 #include "rlgl.h"               // OpenGL abstraction layer to OpenGL 1.1, 3.3 or ES2
+#include "raymath.h"            // Required for: MatrixMultiply() [Used in Tilemap_Draw()]
 
 #include <stdlib.h>             // Required for: malloc(), free()
 #include <string.h>             // Required for: strlen() [Used in Image_FromTextEx()]
@@ -143,6 +145,20 @@
     #include "external/stb_image_resize.h"  // Required for: stbir_resize_uint8() [Image_Resize()]
 //#endif
 
+// NOTE: stbrp_setup_heuristic() is not used, unused static function warning is disabled
+#if defined(__GNUC__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wunused-function"
+#endif
+
+#define STBRP_STATIC
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "external/stb_rect_pack.h"         // Required for: stbrp_pack_rects() [Atlas_AddImages()]
+
+#if defined(__GNUC__)
+    #pragma GCC diagnostic pop
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -150,15 +166,142 @@
     #define PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD  50    // Threshold over 255 to set alpha as 0
 #endif
 
+#ifndef RENDER_TEXTURE_POOL_SIZE
+    #define RENDER_TEXTURE_POOL_SIZE            32      // Maximum render textures kept in transient pool (RenderTexture_Acquire())
+#endif
+#ifndef RENDER_TEXTURE_POOL_IDLE_FRAMES
+    #define RENDER_TEXTURE_POOL_IDLE_FRAMES     60      // Frames a released render texture is kept idle in pool before being unloaded
+#endif
+
+#ifndef TILEMAP_CHUNK_SIZE
+    #define TILEMAP_CHUNK_SIZE          32      // Tilemap chunk size in tiles (chunk vertex are indexed with 16bit indices, 128 max)
+#endif
+#define TILEMAP_MAX_ANIMATIONS          15      // Maximum animated tiles per tilemap (tilemap shader animOffset[] size minus slot 0)
+#define TILEMAP_VERTEX_FLOATS            5      // Tilemap chunk vertex floats: position (2), texcoord (2), animation slot (1)
+
+#define PARTICLES_MAX_EMISSIONS         16      // Maximum particles bursts pending per update (particles compute shader emit arrays size)
+#define PARTICLES_WORKGROUP_SIZE       256      // Particles compute shader local workgroup size
+
+#define POSTFX_MAX_PASSES               16      // Maximum passes per post-processing chain
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Atlas page rectangles packing state
+// NOTE: Packing context points to its own nodes, it can not be moved once initialized
+typedef struct AtlasPacker {
+    stbrp_context context;      // Skyline packing context (kept between packings, allows incremental packing)
+    stbrp_node nodes[];         // Packing nodes (one per page pixel column)
+} AtlasPacker;
+
+// Transient render textures pool entry
+typedef struct RenderTexturePoolEntry {
+    RenderTexture2D target;     // Pooled render texture
+    bool inUse;                 // Render texture acquired, not released yet
+    unsigned int releaseFrame;  // Pool frame of last release (idle entries unloaded after RENDER_TEXTURE_POOL_IDLE_FRAMES)
+} RenderTexturePoolEntry;
+
+// Tilemap chunk, tiles baked into a static vertex buffer (4 vertex per tile, empty tiles degenerated)
+typedef struct TilemapChunk {
+    unsigned int vaoId;         // Vertex array object id (0 if not baked yet)
+    unsigned int vboId;         // Vertex buffer id
+    bool dirty;                 // Chunk must be baked before drawing
+    bool visible;               // Chunk visible on current draw
+} TilemapChunk;
+
+// Tilemap animated tile, frames are the following tiles in tileset
+typedef struct TilemapAnimation {
+    int tile;                   // Animated tile (first frame)
+    int frameCount;             // Number of frames
+    float frameTime;            // Frame duration in seconds
+} TilemapAnimation;
+
+// Tilemap internal data
+typedef struct TilemapData {
+    bool baked;                 // Chunks baked into vertex buffers (drawn through batch if not supported)
+    unsigned int eboId;         // Quads elements buffer, shared by chunks vertex arrays
+    int animationCount;         // Number of animated tiles
+    TilemapAnimation animations[TILEMAP_MAX_ANIMATIONS];   // Animated tiles, animation slot is index + 1
+    int chunkCountX;            // Number of chunks horizontally
+    int chunkCountY;            // Number of chunks vertically
+    TilemapChunk chunks[];      // Tilemap chunks (row-major)
+} TilemapData;
+
+// Particle, matches particles shaders storage buffer layout (std430, 40 bytes)
+typedef struct Particle {
+    Vector2 position;           // Particle position
+    Vector2 velocity;           // Particle velocity
+    float life;                 // Remaining life in seconds (dead if <= 0.0f)
+    float lifetime;             // Lifetime in seconds
+    float sizeStart;            // Size at emission
+    float sizeEnd;              // Size at end of lifetime
+    unsigned int colorStart;    // Color at emission (packed RGBA, R on lower byte)
+    unsigned int colorEnd;      // Color at end of lifetime (packed RGBA, R on lower byte)
+} Particle;
+
+// Particle system internal data
+typedef struct ParticleSystemData {
+    unsigned int ssboId;        // Particles storage buffer id (GPU simulation)
+    unsigned int vaoId;         // Empty vertex array object, particles quads generated from storage buffer
+    Particle *particles;        // Particles array (CPU simulation, NULL on GPU simulation)
+    int head;                   // Next particle to emit (particles are recycled as a ring buffer)
+    unsigned int seed;          // Random seed, advanced on every emission
+    int emissionCount;          // Pending emissions, applied on next update (GPU simulation)
+    int emitRanges[4*PARTICLES_MAX_EMISSIONS];      // Pending emissions: first, count, colorStart, colorEnd
+    float emitParams[12*PARTICLES_MAX_EMISSIONS];   // Pending emissions: position, area, velocity, spread, speed variation, lifetime, sizes, seed
+} ParticleSystemData;
+
+// Particles update job data (CPU simulation)
+typedef struct ParticlesUpdateJob {
+    Particle *particles;        // Particles array
+    Vector2 gravity;            // Particles acceleration
+    float deltaTime;            // Update time step
+} ParticlesUpdateJob;
+
+// Post-processing pass
+typedef struct PostFXPass {
+    Shader shader;              // Full screen pass shader (not used by per-pixel passes)
+    char *code;                 // Per-pixel pass GLSL function body (NULL for full screen passes)
+    Vector4 params;             // Per-pixel pass params (params argument)
+} PostFXPass;
+
+// Post-processing stage, one full screen pass: pass shader or per-pixel passes fused in a generated shader
+typedef struct PostFXStage {
+    Shader shader;              // Stage shader
+    int firstPass;              // First pass run by stage
+    int passCount;              // Number of passes run by stage
+    int paramsLoc;              // Fused per-pixel passes params location (-1 if not found or full screen passes)
+    bool ownsShader;            // Stage shader is generated (fused per-pixel passes) and unloaded with stage
+} PostFXStage;
+
+// Post-processing chain internal data
+typedef struct PostFXData {
+    PostFXPass passes[POSTFX_MAX_PASSES];   // Passes, in order
+    PostFXStage stages[POSTFX_MAX_PASSES];  // Stages, built from passes when dirty
+    bool dirty;                 // Stages must be built before next run
+    RenderTexture2D scene;      // Scene render texture (acquired on PostFX_Begin(), released on PostFX_End())
+} PostFXData;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+// Transient render textures pool (RenderTexture_Acquire()/RenderTexture_Release())
+static RenderTexturePoolEntry renderTexturePool[RENDER_TEXTURE_POOL_SIZE] = { 0 };
+static int renderTexturePoolCount = 0;
+static unsigned int renderTexturePoolFrame = 0;                 // Advanced on every Buffer_Update()
+static RenderTexturePoolStats renderTexturePoolStats = { 0 };   // Pool hits, misses and evictions
+
+// Tilemap shader, shared by all tilemaps (loaded with first tilemap, unloaded with last one)
+static unsigned int tilemapShaderId = 0;
+static int tilemapShaderLocs[3] = { -1, -1, -1 };       // Locations: mvp, colDiffuse, animOffset
+static int tilemapCount = 0;
+
+// Particles compute and draw shaders, shared by all particle systems (loaded with first system, unloaded with last one)
+static unsigned int particlesComputeId = 0;
+static int particlesComputeLocs[6] = { -1, -1, -1, -1, -1, -1 };  // Locations: deltaTime, gravity, particleCount, emissionCount, emitRanges, emitParams
+static unsigned int particlesShaderId = 0;
+static int particlesShaderLocs[3] = { -1, -1, -1 };     // Locations: mvp, colDiffuse, premultiplied
+static int particleSystemCount = 0;
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -193,6 +336,24 @@ static Rectangle GetImageAlphaBorder(Image image, float threshold);
 static Color GetImageColor(Image image, int x, int y);                                                    // Get image pixel color at (x, y) position
 
 static Vector4 *Image_LoadDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+
+static bool AddAtlasPage(Atlas *atlas);                                                                   // Add an empty page to atlas (texture and packing state)
+static AtlasSprite UpdateAtlasSprite(Atlas *atlas, int page, Image image, int x, int y);                  // Copy image into atlas page at packed position
+
+static RenderTexture2D LoadRenderTextureFormat(int width, int height, int format);                       // Load render texture with color texture of given format and depth renderbuffer
+
+static void LoadTilemapShader(void);                                                                      // Load tilemap shader (texcoords offset by tile animation slot)
+static Rectangle GetTilemapTileSource(Tilemap tilemap, int tile);                                         // Get tile rectangle in tileset (empty if not valid)
+static void GetTilemapTileVertex(Tilemap tilemap, int x, int y, float *vertices);                         // Get tilemap tile vertex data (4 vertex)
+static void BakeTilemapChunk(Tilemap tilemap, int chunkX, int chunkY);                                    // Bake tilemap chunk tiles into chunk vertex buffer
+
+static void LoadParticlesShaders(void);                                                                   // Load particles compute and draw shaders (OpenGL 4.3 only)
+static float GetParticlesRandom(unsigned int *state);                                                     // Get random value in [0.0f, 1.0f), xorshift state advanced
+static void UpdateParticlesBatch(void *data, int start, int end);                                         // Update particles [start, end), run as job system batch
+
+static void BuildPostFXStages(PostFX *fx);                                                                // Build post-processing stages (consecutive per-pixel passes fused)
+static Shader LoadPostFXShader(const PostFXPass *passes, int count);                                      // Load fused per-pixel passes shader
+static void DrawPostFXQuad(unsigned int textureId);                                                       // Draw texture as full screen quad (render texture orientation)
 
 #ifdef SUPPORT_IMAGE_DRAWING
 static int Glyph_GetIndex(Font font, int codepoint);
@@ -2610,13 +2771,69 @@ Texture2D Texture_Load(const char *fileName)
 
 // Load a texture from image data
 // NOTE: image is not unloaded, it must be done manually
+// NOTE: Color is premultiplied if premultiplied alpha is enabled (FLAG_PREMULTIPLIED_ALPHA), except compressed formats,
+// formats other than 8 bit RGBA are only premultiplied with image manipulation functions (SUPPORT_IMAGE_MANIPULATION)
 Texture2D Texture_LoadFromImage(Image image)
 {
     Texture2D texture = { 0 };
 
     if ((image.data != NULL) && (image.width != 0) && (image.height != 0))
     {
-        texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
+        // Premultiplied alpha blending requires premultiplied texture color, provided image is not modified
+        bool premultiply = rlIsPremultipliedAlpha() &&
+            ((image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+             (image.format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) ||
+             (image.format == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4) ||
+             (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ||
+             (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32));
+
+        if (premultiply && (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+        {
+            // NOTE: Default color format is premultiplied directly (all mipmap levels),
+            // it does not require image manipulation functions (SUPPORT_IMAGE_MANIPULATION)
+            Image premultiplied = Image_Copy(image);
+            unsigned char *data = (unsigned char *)premultiplied.data;
+            int width = image.width;
+            int height = image.height;
+            int pixelCount = 0;
+
+            for (int i = 0; i < image.mipmaps; i++)
+            {
+                pixelCount += width*height;
+
+                width /= 2;
+                height /= 2;
+
+                // Security check for NPOT textures
+                if (width < 1) width = 1;
+                if (height < 1) height = 1;
+            }
+
+            for (int i = 0; (data != NULL) && (i < pixelCount); i++)
+            {
+                data[i*4] = (unsigned char)((data[i*4]*data[i*4 + 3] + 127)/255);
+                data[i*4 + 1] = (unsigned char)((data[i*4 + 1]*data[i*4 + 3] + 127)/255);
+                data[i*4 + 2] = (unsigned char)((data[i*4 + 2]*data[i*4 + 3] + 127)/255);
+            }
+
+            texture.id = rlLoadTexture(premultiplied.data, premultiplied.width, premultiplied.height, premultiplied.format, premultiplied.mipmaps);
+            Image_Free(premultiplied);
+        }
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+        else if (premultiply)
+        {
+            Image premultiplied = Image_Copy(image);
+            Image_AlphaPremultiply(&premultiplied);
+            texture.id = rlLoadTexture(premultiplied.data, premultiplied.width, premultiplied.height, premultiplied.format, premultiplied.mipmaps);
+            Image_Free(premultiplied);
+        }
+#endif
+        else
+        {
+            if (premultiply) TRACELOG(LOG_WARNING, "IMAGE: Pixel format can not be premultiplied without SUPPORT_IMAGE_MANIPULATION, texture color not premultiplied");
+
+            texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
+        }
     }
     else TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
 
@@ -2632,40 +2849,7 @@ Texture2D Texture_LoadFromImage(Image image)
 // NOTE: Render texture is loaded by default with RGBA color attachment and depth RenderBuffer
 RenderTexture2D RenderTexture_Load(int width, int height)
 {
-    RenderTexture2D target = { 0 };
-
-    target.id = rlLoadFramebuffer(width, height);   // Load an empty framebuffer
-
-    if (target.id > 0)
-    {
-        rlEnableFramebuffer(target.id);
-
-        // Create color texture (default to RGBA)
-        target.texture.id = rlLoadTexture(NULL, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
-        target.texture.width = width;
-        target.texture.height = height;
-        target.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-        target.texture.mipmaps = 1;
-
-        // Create depth renderbuffer/texture
-        target.depth.id = rlLoadTextureDepth(width, height, true);
-        target.depth.width = width;
-        target.depth.height = height;
-        target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
-        target.depth.mipmaps = 1;
-
-        // Attach color texture and depth renderbuffer/texture to FBO
-        rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
-        rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
-
-        // Check if fbo is complete with attachments (valid)
-        if (rlFramebufferComplete(target.id)) TRACELOG(LOG_INFO, "FBO: [ID %i] Framebuffer object created successfully", target.id);
-
-        rlDisableFramebuffer();
-    }
-    else TRACELOG(LOG_WARNING, "FBO: Framebuffer object can not be created");
-
-    return target;
+    return LoadRenderTextureFormat(width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);  // Default to RGBA
 }
 
 // Unload texture from GPU memory (VRAM)
@@ -2693,6 +2877,110 @@ void RenderTexture_Free(RenderTexture2D target)
     }
 }
 
+//------------------------------------------------------------------------------------
+// Transient render textures pool functions
+//------------------------------------------------------------------------------------
+// Get render texture from pool, an idle render texture with same size and format is reused if available
+// NOTE: Contents are not cleared, render textures not fitting in pool are loaded anyway (unloaded on release)
+RenderTexture2D RenderTexture_Acquire(int width, int height, int format)
+{
+    for (int i = 0; i < renderTexturePoolCount; i++)
+    {
+        RenderTexturePoolEntry *entry = &renderTexturePool[i];
+
+        if (!entry->inUse && (entry->target.texture.width == width) && (entry->target.texture.height == height) && (entry->target.texture.format == format))
+        {
+            entry->inUse = true;
+            renderTexturePoolStats.hits++;
+
+            return entry->target;
+        }
+    }
+
+    RenderTexture2D target = LoadRenderTextureFormat(width, height, format);
+
+    if (target.id == 0) return target;
+
+    renderTexturePoolStats.misses++;
+
+    if (renderTexturePoolCount < RENDER_TEXTURE_POOL_SIZE)
+    {
+        renderTexturePool[renderTexturePoolCount].target = target;
+        renderTexturePool[renderTexturePoolCount].inUse = true;
+        renderTexturePoolCount++;
+    }
+    else TRACELOG(LOG_WARNING, "FBO: Render textures pool full (%i render textures), render texture not pooled", RENDER_TEXTURE_POOL_SIZE);
+
+    return target;
+}
+
+// Return render texture to pool, kept idle for reuse
+void RenderTexture_Release(RenderTexture2D target)
+{
+    if (target.id == 0) return;
+
+    for (int i = 0; i < renderTexturePoolCount; i++)
+    {
+        if (renderTexturePool[i].target.id == target.id)
+        {
+            renderTexturePool[i].inUse = false;
+            renderTexturePool[i].releaseFrame = renderTexturePoolFrame;
+            return;
+        }
+    }
+
+    // Render texture was not pooled
+    RenderTexture_Free(target);
+}
+
+// Get transient render textures pool statistics
+RenderTexturePoolStats RenderTexture_GetPoolStats(void)
+{
+    RenderTexturePoolStats stats = renderTexturePoolStats;
+
+    stats.count = renderTexturePoolCount;
+
+    for (int i = 0; i < renderTexturePoolCount; i++)
+    {
+        RenderTexture2D target = renderTexturePool[i].target;
+
+        if (renderTexturePool[i].inUse) stats.inUse++;
+
+        // NOTE: Depth renderbuffer is estimated as 32bit per pixel (24bit depth, padded)
+        stats.memory += Color_GetPixelDataSize(target.texture.width, target.texture.height, target.texture.format) + 4*target.texture.width*target.texture.height;
+    }
+
+    return stats;
+}
+
+// Advance pool frame, unload render textures idle for more than RENDER_TEXTURE_POOL_IDLE_FRAMES
+// NOTE: Called on Buffer_Update(), after frame is submitted
+void UpdateRenderTexturePool(void)
+{
+    renderTexturePoolFrame++;
+
+    for (int i = renderTexturePoolCount - 1; i >= 0; i--)
+    {
+        if (!renderTexturePool[i].inUse && ((renderTexturePoolFrame - renderTexturePool[i].releaseFrame) > RENDER_TEXTURE_POOL_IDLE_FRAMES))
+        {
+            RenderTexture_Free(renderTexturePool[i].target);
+            renderTexturePoolStats.evictions++;
+
+            renderTexturePoolCount--;
+            renderTexturePool[i] = renderTexturePool[renderTexturePoolCount];
+        }
+    }
+}
+
+// Unload all pooled render textures (acquired ones included)
+// NOTE: Called on Window_Close()
+void UnloadRenderTexturePool(void)
+{
+    for (int i = 0; i < renderTexturePoolCount; i++) RenderTexture_Free(renderTexturePool[i].target);
+
+    renderTexturePoolCount = 0;
+}
+
 //------------------------------------------------------------------------------------
 // Texture configuration functions
 //------------------------------------------------------------------------------------
@@ -2885,6 +3173,9 @@ void Texture_DrawPro(Texture2D texture, Rectangle source, Rectangle dest, Vector
             bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
         }
 
+        // Reject quad out of view before adding any vertex (if view culling enabled)
+        if (rlIsQuadCulled(topLeft.x, topLeft.y, bottomLeft.x, bottomLeft.y, bottomRight.x, bottomRight.y, topRight.x, topRight.y)) return;
+
         rlCheckRenderBatchLimit(4);     // Make sure there is enough free space on the batch buffer
 
         rlSetTexture(texture.id);
@@ -2958,154 +3249,1136 @@ void Texture_DrawPro(Texture2D texture, Rectangle source, Rectangle dest, Vector
     }
 }
 
-// Get color with alpha applied, alpha goes from 0.0f to 1.0f
-Color Color_Fade(Color color, float alpha)
+//------------------------------------------------------------------------------------
+// Texture atlas functions
+//------------------------------------------------------------------------------------
+// Load an empty texture atlas, pages are created on demand when images are added
+// NOTE: Padding adds empty pixels between sprites, extrude repeats sprite border pixels around it
+// (avoids bleeding of neighbour sprites with bilinear filtering)
+Atlas Atlas_Load(int width, int height, int padding, int extrude)
 {
-    if (alpha < 0.0f) alpha = 0.0f;
-    else if (alpha > 1.0f) alpha = 1.0f;
+    Atlas atlas = { 0 };
 
-    return (Color){color.r, color.g, color.b, (unsigned char)(255.0f*alpha)};
+    atlas.width = width;
+    atlas.height = height;
+    atlas.padding = (padding > 0)? padding : 0;
+    atlas.extrude = (extrude > 0)? extrude : 0;
+
+    return atlas;
 }
-
-// Get src alpha-blended into dst color with tint
-Color Color_AlphaBlend(Color dst, Color src, Color tint)
-{
-    Color out = WHITE;
-
-    // Apply color tint to source color
-    src.r = (unsigned char)(((unsigned int)src.r*(unsigned int)tint.r) >> 8);
-    src.g = (unsigned char)(((unsigned int)src.g*(unsigned int)tint.g) >> 8);
-    src.b = (unsigned char)(((unsigned int)src.b*(unsigned int)tint.b) >> 8);
-    src.a = (unsigned char)(((unsigned int)src.a*(unsigned int)tint.a) >> 8);
-
-//#define COLORALPHABLEND_FLOAT
-#define COLORALPHABLEND_INTEGERS
-#if defined(COLORALPHABLEND_INTEGERS)
-    if (src.a == 0) out = dst;
-    else if (src.a == 255) out = src;
-    else
-    {
-        unsigned int alpha = (unsigned int)src.a + 1;     // We are shifting by 8 (dividing by 256), so we need to take that excess into account
-        out.a = (unsigned char)(((unsigned int)alpha*256 + (unsigned int)dst.a*(256 - alpha)) >> 8);
-
-        if (out.a > 0)
-        {
-            out.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
-            out.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
-            out.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
-        }
-    }
-#endif
-#if defined(COLORALPHABLEND_FLOAT)
-    if (src.a == 0) out = dst;
-    else if (src.a == 255) out = src;
-    else
-    {
-        Vector4 fdst = ColorNormalize(dst);
-        Vector4 fsrc = ColorNormalize(src);
-        Vector4 ftint = ColorNormalize(tint);
-        Vector4 fout = { 0 };
-
-        fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
-
-        if (fout.w > 0.0f)
-        {
-            fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
-            fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
-            fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
-        }
-
-        out = (Color){ (unsigned char)(fout.x*255.0f), (unsigned char)(fout.y*255.0f), (unsigned char)(fout.z*255.0f), (unsigned char)(fout.w*255.0f) };
-    }
-#endif
-
-    return out;
-}
 
-// Get color from a pixel from certain format
-Color Color_GetPixel(void *srcPtr, int format)
+// Unload texture atlas pages from GPU memory (VRAM) and packing data
+void Atlas_Free(Atlas atlas)
 {
-    Color color = { 0 };
+    AtlasPacker **packers = (AtlasPacker **)atlas.packers;
 
-    switch (format)
+    for (int i = 0; i < atlas.pageCount; i++)
     {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], 255 }; break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1] }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 5) & 0b0000000000111111)*255/63);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            color.a = 255;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 6) & 0b0000000000011111)*255/31);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            color.a = (((unsigned short *)srcPtr)[0] & 0b0000000000000001)? 255 : 0;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 12)*255/15);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 8) & 0b0000000000001111)*255/15);
-            color.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 4) & 0b0000000000001111)*255/15);
-            color.a = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000001111)*255/15);
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], ((unsigned char *)srcPtr)[3] }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], 255 }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.a = 255;
+        Texture_Free(atlas.pages[i]);
+        ASC_FREE(packers[i]);
+    }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
-            color.a = 255;
+    ASC_FREE(atlas.pages);
+    ASC_FREE(atlas.packers);
+}
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
-            color.a = (unsigned char)(((float *)srcPtr)[3]*255.0f);
+// Pack image into atlas
+// NOTE: Returned sprite texture id is 0 if image could not be packed
+AtlasSprite Atlas_AddImage(Atlas *atlas, Image image)
+{
+    AtlasSprite sprite = { 0 };
 
-        } break;
-        default: break;
-    }
+    Atlas_AddImages(atlas, &image, 1, &sprite);
 
-    return color;
+    return sprite;
 }
 
-// Set pixel color formatted into destination pointer
-void Color_SetPixel(void *dstPtr, Color color, int format)
+// Pack images into atlas, returns number of sprites packed
+// NOTE: Images are tried on existing pages first, new pages are added while required,
+// images are copied into pages textures so they can be unloaded after packing
+int Atlas_AddImages(Atlas *atlas, const Image *images, int count, AtlasSprite *sprites)
 {
-    switch (format)
-    {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+    int packedCount = 0;
+    int pendingCount = 0;
+    int border = 2*atlas->extrude + atlas->padding;
 
-            ((unsigned char *)dstPtr)[0] = gray;
+    stbrp_rect *rects = (stbrp_rect *)ASC_CALLOC(count, sizeof(stbrp_rect));
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        {
+    for (int i = 0; i < count; i++)
+    {
+        sprites[i] = (AtlasSprite){ 0 };
+
+        // Only uncompressed images fitting into a page can be packed
+        if ((images[i].data == NULL) || (images[i].width <= 0) || (images[i].height <= 0) ||
+            (images[i].format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        {
+            TRACELOG(LOG_WARNING, "ATLAS: Image data is not valid to be packed");
+        }
+        else if (((images[i].width + border) > atlas->width) || ((images[i].height + border) > atlas->height))
+        {
+            TRACELOG(LOG_WARNING, "ATLAS: Image (%ix%i) does not fit into atlas pages (%ix%i)", images[i].width, images[i].height, atlas->width, atlas->height);
+        }
+        else
+        {
+            rects[pendingCount].id = i;
+            rects[pendingCount].w = images[i].width + border;
+            rects[pendingCount].h = images[i].height + border;
+            pendingCount++;
+        }
+    }
+
+    for (int page = 0; pendingCount > 0; page++)
+    {
+        bool newPage = (page == atlas->pageCount);
+
+        if (newPage && !AddAtlasPage(atlas)) break;
+
+        AtlasPacker *packer = ((AtlasPacker **)atlas->packers)[page];
+        stbrp_pack_rects(&packer->context, rects, pendingCount);
+
+        // Upload packed images, not packed ones are kept for next page
+        int remainingCount = 0;
+
+        for (int i = 0; i < pendingCount; i++)
+        {
+            if (rects[i].was_packed)
+            {
+                sprites[rects[i].id] = UpdateAtlasSprite(atlas, page, images[rects[i].id], rects[i].x, rects[i].y);
+                packedCount++;
+            }
+            else rects[remainingCount++] = rects[i];
+        }
+
+        // NOTE: An empty page always packs some image, just in case, avoid adding pages forever
+        if (newPage && (remainingCount == pendingCount)) break;
+
+        pendingCount = remainingCount;
+    }
+
+    ASC_FREE(rects);
+
+    return packedCount;
+}
+
+// Load images from files and pack them into atlas, returns number of sprites packed
+int Atlas_AddFiles(Atlas *atlas, const char **fileNames, int count, AtlasSprite *sprites)
+{
+    Image *images = (Image *)ASC_CALLOC(count, sizeof(Image));
+
+    for (int i = 0; i < count; i++) images[i] = Image_Load(fileNames[i]);
+
+    int packedCount = Atlas_AddImages(atlas, images, count, sprites);
+
+    for (int i = 0; i < count; i++) Image_Free(images[i]);
+    ASC_FREE(images);
+
+    return packedCount;
+}
+
+// Draw an atlas sprite
+void Atlas_DrawSprite(AtlasSprite sprite, Vector2 position, Color tint)
+{
+    Texture_DrawRec(sprite.texture, sprite.source, position, tint);
+}
+
+// Draw an atlas sprite with 'pro' parameters
+void Atlas_DrawSpritePro(AtlasSprite sprite, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    Texture_DrawPro(sprite.texture, sprite.source, dest, origin, rotation, tint);
+}
+
+//------------------------------------------------------------------------------------
+// Tilemap functions
+//------------------------------------------------------------------------------------
+// Load tilemap, tiles are copied (all tiles empty if NULL)
+// NOTE: Chunks are baked into static vertex buffers on first draw, tiles changes only patch
+// baked chunks and tiles animations are applied as texcoords offsets on drawing (no rebake)
+Tilemap Tilemap_Load(Texture2D tileset, int tileWidth, int tileHeight, const int *tiles, int width, int height)
+{
+    Tilemap tilemap = { 0 };
+
+    if ((tileset.id == 0) || (tileWidth <= 0) || (tileHeight <= 0) || (width <= 0) || (height <= 0))
+    {
+        TRACELOG(LOG_WARNING, "TILEMAP: Failed to load tilemap, tileset or size not valid");
+        return tilemap;
+    }
+
+    tilemap.width = width;
+    tilemap.height = height;
+    tilemap.tileWidth = tileWidth;
+    tilemap.tileHeight = tileHeight;
+    tilemap.tileset = tileset;
+    tilemap.tiles = (int *)ASC_MALLOC(width*height*sizeof(int));
+
+    if (tiles != NULL) memcpy(tilemap.tiles, tiles, width*height*sizeof(int));
+    else for (int i = 0; i < width*height; i++) tilemap.tiles[i] = -1;
+
+    int chunkCountX = (width + TILEMAP_CHUNK_SIZE - 1)/TILEMAP_CHUNK_SIZE;
+    int chunkCountY = (height + TILEMAP_CHUNK_SIZE - 1)/TILEMAP_CHUNK_SIZE;
+    TilemapData *data = (TilemapData *)ASC_CALLOC(1, sizeof(TilemapData) + chunkCountX*chunkCountY*sizeof(TilemapChunk));
+
+    data->chunkCountX = chunkCountX;
+    data->chunkCountY = chunkCountY;
+    for (int i = 0; i < chunkCountX*chunkCountY; i++) data->chunks[i].dirty = true;
+
+    if (tilemapCount == 0) LoadTilemapShader();
+    tilemapCount++;
+
+    data->baked = (tilemapShaderId > 0);
+    tilemap.chunks = data;
+
+    TRACELOG(LOG_INFO, "TILEMAP: Tilemap loaded successfully (%ix%i tiles, %i chunks)", width, height, chunkCountX*chunkCountY);
+
+    return tilemap;
+}
+
+// Unload tilemap tiles and chunks buffers from GPU memory (VRAM)
+void Tilemap_Free(Tilemap tilemap)
+{
+    TilemapData *data = (TilemapData *)tilemap.chunks;
+
+    if (data == NULL) return;
+
+    for (int i = 0; i < data->chunkCountX*data->chunkCountY; i++)
+    {
+        if (data->chunks[i].vaoId > 0)
+        {
+            rlUnloadVertexArray(data->chunks[i].vaoId);
+            rlUnloadVertexBuffer(data->chunks[i].vboId);
+        }
+    }
+
+    if (data->eboId > 0) rlUnloadVertexBuffer(data->eboId);
+
+    tilemapCount--;
+
+    if ((tilemapCount == 0) && (tilemapShaderId > 0))
+    {
+        rlUnloadShaderProgram(tilemapShaderId);
+        tilemapShaderId = 0;
+    }
+
+    ASC_FREE(tilemap.tiles);
+    ASC_FREE(data);
+}
+
+// Set tilemap tile (-1 for empty tile)
+// NOTE: If tile chunk is already baked, only tile vertex are updated in chunk vertex buffer
+void Tilemap_SetTile(Tilemap *tilemap, int x, int y, int tile)
+{
+    if ((tilemap->tiles == NULL) || (x < 0) || (y < 0) || (x >= tilemap->width) || (y >= tilemap->height)) return;
+
+    if (tile < 0) tile = -1;
+    if (tilemap->tiles[y*tilemap->width + x] == tile) return;
+
+    tilemap->tiles[y*tilemap->width + x] = tile;
+
+    TilemapData *data = (TilemapData *)tilemap->chunks;
+    int chunkX = x/TILEMAP_CHUNK_SIZE;
+    int chunkY = y/TILEMAP_CHUNK_SIZE;
+    TilemapChunk *chunk = &data->chunks[chunkY*data->chunkCountX + chunkX];
+
+    if ((chunk->vaoId > 0) && !chunk->dirty)
+    {
+        // Chunk tiles vertex are row-major, limited to tilemap width on last chunks column
+        int chunkWidth = tilemap->width - chunkX*TILEMAP_CHUNK_SIZE;
+        if (chunkWidth > TILEMAP_CHUNK_SIZE) chunkWidth = TILEMAP_CHUNK_SIZE;
+
+        int index = (y - chunkY*TILEMAP_CHUNK_SIZE)*chunkWidth + (x - chunkX*TILEMAP_CHUNK_SIZE);
+        float vertices[4*TILEMAP_VERTEX_FLOATS] = { 0 };
+
+        GetTilemapTileVertex(*tilemap, x, y, vertices);
+        rlUpdateVertexBuffer(chunk->vboId, vertices, sizeof(vertices), index*sizeof(vertices));
+    }
+}
+
+// Get tilemap tile (-1 if empty or out of tilemap)
+int Tilemap_GetTile(Tilemap tilemap, int x, int y)
+{
+    if ((tilemap.tiles == NULL) || (x < 0) || (y < 0) || (x >= tilemap.width) || (y >= tilemap.height)) return -1;
+
+    return tilemap.tiles[y*tilemap.width + x];
+}
+
+// Animate tile through following tileset tiles, frame changes every frameTime seconds
+// NOTE: Frames are applied as texcoords offsets on drawing, chunks are only baked again
+// when a tile is animated for the first time or its animation is removed (frameCount < 2)
+bool Tilemap_SetAnimation(Tilemap *tilemap, int tile, int frameCount, float frameTime)
+{
+    TilemapData *data = (TilemapData *)tilemap->chunks;
+
+    if ((data == NULL) || (tile < 0)) return false;
+
+    int slot = -1;
+    for (int i = 0; i < data->animationCount; i++) if (data->animations[i].tile == tile) slot = i;
+
+    bool remove = ((frameCount < 2) || (frameTime <= 0.0f));
+
+    if (remove && (slot == -1)) return true;
+
+    if (!remove && (slot == -1) && (data->animationCount >= TILEMAP_MAX_ANIMATIONS))
+    {
+        TRACELOG(LOG_WARNING, "TILEMAP: Failed to animate tile %i, too many animated tiles (max %i)", tile, TILEMAP_MAX_ANIMATIONS);
+        return false;
+    }
+
+    if ((slot == -1) || remove)
+    {
+        // Animation slot is baked into tiles vertex, chunks containing the tile must be baked again
+        // NOTE: On removal, last animation is moved into removed slot, its tile chunks are also rebaked
+        int moved = (remove && (slot != (data->animationCount - 1)))? data->animations[data->animationCount - 1].tile : -1;
+
+        for (int i = 0; i < tilemap->width*tilemap->height; i++)
+        {
+            if ((tilemap->tiles[i] == tile) || ((moved != -1) && (tilemap->tiles[i] == moved)))
+            {
+                int chunkX = (i%tilemap->width)/TILEMAP_CHUNK_SIZE;
+                int chunkY = (i/tilemap->width)/TILEMAP_CHUNK_SIZE;
+                data->chunks[chunkY*data->chunkCountX + chunkX].dirty = true;
+            }
+        }
+    }
+
+    if (remove)
+    {
+        data->animations[slot] = data->animations[data->animationCount - 1];
+        data->animationCount--;
+    }
+    else
+    {
+        if (slot == -1) slot = data->animationCount++;
+        data->animations[slot] = (TilemapAnimation){ tile, frameCount, frameTime };
+    }
+
+    return true;
+}
+
+// Draw tilemap visible chunks
+// NOTE: Batch is drawn first, every visible chunk is drawn with one draw call (tilemap shader),
+// tiles are drawn through batch if shaders or vertex arrays are not supported (OpenGL 1.1)
+void Tilemap_Draw(Tilemap tilemap, Vector2 position, Color tint)
+{
+    TilemapData *data = (TilemapData *)tilemap.chunks;
+
+    if (data == NULL) return;
+
+    // Animated tiles current frame, as texcoords offsets by animation slot (slot 0 is not animated)
+    float offsets[2*(TILEMAP_MAX_ANIMATIONS + 1)] = { 0 };
+    double time = Time_Get();
+
+    for (int i = 0; i < data->animationCount; i++)
+    {
+        TilemapAnimation animation = data->animations[i];
+        Rectangle first = GetTilemapTileSource(tilemap, animation.tile);
+        Rectangle frame = GetTilemapTileSource(tilemap, animation.tile + (int)(time/animation.frameTime)%animation.frameCount);
+
+        if (frame.width > 0.0f)
+        {
+            offsets[2*(i + 1)] = (frame.x - first.x)/tilemap.tileset.width;
+            offsets[2*(i + 1) + 1] = (frame.y - first.y)/tilemap.tileset.height;
+        }
+    }
+
+    rlPushMatrix();
+    rlTranslatef(position.x, position.y, 0.0f);
+
+    // Bake visible dirty chunks before drawing, tiles fallback to batch if chunks can not be baked
+    int chunkPixelsWidth = TILEMAP_CHUNK_SIZE*tilemap.tileWidth;
+    int chunkPixelsHeight = TILEMAP_CHUNK_SIZE*tilemap.tileHeight;
+
+    for (int i = 0; i < data->chunkCountX*data->chunkCountY; i++)
+    {
+        float x0 = (float)((i%data->chunkCountX)*chunkPixelsWidth);
+        float y0 = (float)((i/data->chunkCountX)*chunkPixelsHeight);
+        float x1 = fminf(x0 + chunkPixelsWidth, (float)(tilemap.width*tilemap.tileWidth));
+        float y1 = fminf(y0 + chunkPixelsHeight, (float)(tilemap.height*tilemap.tileHeight));
+
+        data->chunks[i].visible = rlIsQuadVisible(x0, y0, x0, y1, x1, y1, x1, y0);
+
+        if (data->baked && data->chunks[i].visible && data->chunks[i].dirty) BakeTilemapChunk(tilemap, i%data->chunkCountX, i/data->chunkCountX);
+    }
+
+    if (data->baked)
+    {
+        rlDrawRenderBatchActive();      // Batch geometry drawn before tilemap
+
+        Matrix matMVP = MatrixMultiply(MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()), rlGetMatrixProjection());
+        float color[4] = { 0 };
+        rlGetDiffuseColor(tint.r, tint.g, tint.b, tint.a, color);
+
+        rlEnableShader(tilemapShaderId);
+        rlSetUniformMatrix(tilemapShaderLocs[0], matMVP);
+        rlSetUniform(tilemapShaderLocs[1], color, RL_SHADER_UNIFORM_VEC4, 1);
+        rlSetUniform(tilemapShaderLocs[2], offsets, RL_SHADER_UNIFORM_VEC2, TILEMAP_MAX_ANIMATIONS + 1);
+
+        for (int i = 0; i < data->chunkCountX*data->chunkCountY; i++)
+        {
+            if (!data->chunks[i].visible) continue;
+
+            int chunkWidth = tilemap.width - (i%data->chunkCountX)*TILEMAP_CHUNK_SIZE;
+            int chunkHeight = tilemap.height - (i/data->chunkCountX)*TILEMAP_CHUNK_SIZE;
+            if (chunkWidth > TILEMAP_CHUNK_SIZE) chunkWidth = TILEMAP_CHUNK_SIZE;
+            if (chunkHeight > TILEMAP_CHUNK_SIZE) chunkHeight = TILEMAP_CHUNK_SIZE;
+
+            rlDrawVertexArrayTexture(data->chunks[i].vaoId, tilemap.tileset.id, 6*chunkWidth*chunkHeight);
+        }
+
+        rlDisableShader();
+    }
+    else
+    {
+        for (int i = 0; i < data->chunkCountX*data->chunkCountY; i++)
+        {
+            if (!data->chunks[i].visible) continue;
+
+            int startX = (i%data->chunkCountX)*TILEMAP_CHUNK_SIZE;
+            int startY = (i/data->chunkCountX)*TILEMAP_CHUNK_SIZE;
+            int endX = ((startX + TILEMAP_CHUNK_SIZE) < tilemap.width)? (startX + TILEMAP_CHUNK_SIZE) : tilemap.width;
+            int endY = ((startY + TILEMAP_CHUNK_SIZE) < tilemap.height)? (startY + TILEMAP_CHUNK_SIZE) : tilemap.height;
+
+            for (int y = startY; y < endY; y++)
+            {
+                for (int x = startX; x < endX; x++)
+                {
+                    int tile = tilemap.tiles[y*tilemap.width + x];
+                    Rectangle source = GetTilemapTileSource(tilemap, tile);
+
+                    if (source.width == 0.0f) continue;
+
+                    float u0 = source.x/tilemap.tileset.width;
+                    float v0 = source.y/tilemap.tileset.height;
+
+                    for (int k = 0; k < data->animationCount; k++)
+                    {
+                        if (data->animations[k].tile == tile) { u0 += offsets[2*(k + 1)]; v0 += offsets[2*(k + 1) + 1]; }
+                    }
+
+                    float u1 = u0 + source.width/tilemap.tileset.width;
+                    float v1 = v0 + source.height/tilemap.tileset.height;
+                    float x0 = (float)(x*tilemap.tileWidth);
+                    float y0 = (float)(y*tilemap.tileHeight);
+
+                    rlCheckRenderBatchLimit(4);     // Make sure there is enough free space on the batch buffer
+
+                    rlSetTexture(tilemap.tileset.id);
+                    rlBegin(RL_QUADS);
+
+                        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+
+                        rlTexCoord2f(u0, v0);
+                        rlVertex2f(x0, y0);
+                        rlTexCoord2f(u0, v1);
+                        rlVertex2f(x0, y0 + tilemap.tileHeight);
+                        rlTexCoord2f(u1, v1);
+                        rlVertex2f(x0 + tilemap.tileWidth, y0 + tilemap.tileHeight);
+                        rlTexCoord2f(u1, v0);
+                        rlVertex2f(x0 + tilemap.tileWidth, y0);
+
+                    rlEnd();
+                }
+            }
+        }
+
+        rlSetTexture(0);
+    }
+
+    rlPopMatrix();
+}
+
+//------------------------------------------------------------------------------------
+// Particle system functions
+//------------------------------------------------------------------------------------
+// Load particle system, all particles dead
+// NOTE: Particles are simulated by a compute shader if supported (OpenGL 4.3), on CPU otherwise
+ParticleSystem ParticleSystem_Load(int maxParticles, Texture2D texture)
+{
+    ParticleSystem system = { 0 };
+
+    if (maxParticles <= 0)
+    {
+        TRACELOG(LOG_WARNING, "PARTICLES: Failed to load particle system, particles count not valid");
+        return system;
+    }
+
+    system.maxParticles = maxParticles;
+    system.texture = texture;
+
+    ParticleSystemData *data = (ParticleSystemData *)ASC_CALLOC(1, sizeof(ParticleSystemData));
+    data->seed = 0x9e3779b9;
+
+    if (particleSystemCount == 0) LoadParticlesShaders();
+    particleSystemCount++;
+
+    Particle *particles = (Particle *)ASC_CALLOC(maxParticles, sizeof(Particle));
+
+    if (particlesComputeId > 0)
+    {
+        data->ssboId = rlLoadShaderBuffer((unsigned long long)maxParticles*sizeof(Particle), particles, RL_DYNAMIC_COPY);
+        data->vaoId = rlLoadVertexArray();
+    }
+
+    // Storage buffer failed, particles simulated on CPU
+    if ((data->ssboId == 0) || (data->vaoId == 0))
+    {
+        if (data->ssboId > 0) rlUnloadShaderBuffer(data->ssboId);
+        if (data->vaoId > 0) rlUnloadVertexArray(data->vaoId);
+        data->ssboId = 0;
+        data->vaoId = 0;
+        data->particles = particles;
+    }
+    else ASC_FREE(particles);
+
+    system.data = data;
+
+    TRACELOG(LOG_INFO, "PARTICLES: Particle system loaded successfully (%i particles, %s simulation)", maxParticles, (data->particles == NULL)? "GPU" : "CPU");
+
+    return system;
+}
+
+// Unload particle system buffers
+void ParticleSystem_Free(ParticleSystem system)
+{
+    ParticleSystemData *data = (ParticleSystemData *)system.data;
+
+    if (data == NULL) return;
+
+    if (data->ssboId > 0) rlUnloadShaderBuffer(data->ssboId);
+    if (data->vaoId > 0) rlUnloadVertexArray(data->vaoId);
+    ASC_FREE(data->particles);
+    ASC_FREE(data);
+
+    particleSystemCount--;
+
+    if (particleSystemCount == 0)
+    {
+        if (particlesComputeId > 0) rlUnloadShaderProgram(particlesComputeId);
+        if (particlesShaderId > 0) rlUnloadShaderProgram(particlesShaderId);
+        particlesComputeId = 0;
+        particlesShaderId = 0;
+    }
+}
+
+// Emit particles burst, oldest particles are recycled
+// NOTE: On GPU simulation, bursts are queued and emitted by compute shader on next update
+void ParticleSystem_Emit(ParticleSystem *system, ParticleEmitter emitter, int count)
+{
+    ParticleSystemData *data = (ParticleSystemData *)system->data;
+
+    if ((data == NULL) || (count <= 0)) return;
+    if (count > system->maxParticles) count = system->maxParticles;
+
+    unsigned int colorStart = emitter.colorStart.r | (emitter.colorStart.g << 8) | (emitter.colorStart.b << 16) | ((unsigned int)emitter.colorStart.a << 24);
+    unsigned int colorEnd = emitter.colorEnd.r | (emitter.colorEnd.g << 8) | (emitter.colorEnd.b << 16) | ((unsigned int)emitter.colorEnd.a << 24);
+
+    if (data->particles == NULL)
+    {
+        if (data->emissionCount >= PARTICLES_MAX_EMISSIONS)
+        {
+            TRACELOG(LOG_WARNING, "PARTICLES: Emissions queue full (%i bursts per update), burst discarded", PARTICLES_MAX_EMISSIONS);
+            return;
+        }
+
+        int *range = &data->emitRanges[4*data->emissionCount];
+        float *params = &data->emitParams[12*data->emissionCount];
+
+        GetParticlesRandom(&data->seed);
+
+        range[0] = data->head;
+        range[1] = count;
+        range[2] = (int)colorStart;
+        range[3] = (int)colorEnd;
+        params[0] = emitter.position.x;
+        params[1] = emitter.position.y;
+        params[2] = emitter.area.x;
+        params[3] = emitter.area.y;
+        params[4] = emitter.velocity.x;
+        params[5] = emitter.velocity.y;
+        params[6] = emitter.spread*DEG2RAD;
+        params[7] = emitter.speedVariation;
+        params[8] = emitter.lifetime;
+        params[9] = emitter.sizeStart;
+        params[10] = emitter.sizeEnd;
+        params[11] = (float)(data->seed & 0xffffff);    // Seed kept exact as float
+
+        data->emissionCount++;
+    }
+    else
+    {
+        for (int i = 0; i < count; i++)
+        {
+            Particle *particle = &data->particles[(data->head + i)%system->maxParticles];
+
+            float angle = (GetParticlesRandom(&data->seed) - 0.5f)*emitter.spread*DEG2RAD;
+            float speed = 1.0f + (GetParticlesRandom(&data->seed)*2.0f - 1.0f)*emitter.speedVariation;
+            float vx = emitter.velocity.x*speed;
+            float vy = emitter.velocity.y*speed;
+
+            particle->position.x = emitter.position.x + (GetParticlesRandom(&data->seed) - 0.5f)*emitter.area.x;
+            particle->position.y = emitter.position.y + (GetParticlesRandom(&data->seed) - 0.5f)*emitter.area.y;
+            particle->velocity.x = vx*cosf(angle) - vy*sinf(angle);
+            particle->velocity.y = vx*sinf(angle) + vy*cosf(angle);
+            particle->life = emitter.lifetime;
+            particle->lifetime = emitter.lifetime;
+            particle->sizeStart = emitter.sizeStart;
+            particle->sizeEnd = emitter.sizeEnd;
+            particle->colorStart = colorStart;
+            particle->colorEnd = colorEnd;
+        }
+    }
+
+    data->head = (data->head + count)%system->maxParticles;
+}
+
+// Update particles: emit pending bursts, integrate and age particles
+void ParticleSystem_Update(ParticleSystem *system, float deltaTime)
+{
+    ParticleSystemData *data = (ParticleSystemData *)system->data;
+
+    if (data == NULL) return;
+
+    if (data->particles == NULL)
+    {
+        rlDrawRenderBatchActive();      // Batch geometry drawn before particles buffer is written
+
+        rlEnableShader(particlesComputeId);
+        rlSetUniform(particlesComputeLocs[0], &deltaTime, RL_SHADER_UNIFORM_FLOAT, 1);
+        rlSetUniform(particlesComputeLocs[1], &system->gravity, RL_SHADER_UNIFORM_VEC2, 1);
+        rlSetUniform(particlesComputeLocs[2], &system->maxParticles, RL_SHADER_UNIFORM_INT, 1);
+        rlSetUniform(particlesComputeLocs[3], &data->emissionCount, RL_SHADER_UNIFORM_INT, 1);
+
+        if (data->emissionCount > 0)
+        {
+            rlSetUniform(particlesComputeLocs[4], data->emitRanges, RL_SHADER_UNIFORM_IVEC4, data->emissionCount);
+            rlSetUniform(particlesComputeLocs[5], data->emitParams, RL_SHADER_UNIFORM_VEC4, 3*data->emissionCount);
+        }
+
+        rlBindShaderBuffer(data->ssboId, 0);
+        rlComputeShaderDispatch((system->maxParticles + PARTICLES_WORKGROUP_SIZE - 1)/PARTICLES_WORKGROUP_SIZE, 1, 1);
+        rlComputeShaderBarrier();       // Particles buffer written before it is read by draw shader
+        rlDisableShader();
+
+        data->emissionCount = 0;
+    }
+    else
+    {
+        ParticlesUpdateJob job = { data->particles, system->gravity, deltaTime };
+
+        Job_ParallelFor(UpdateParticlesBatch, &job, system->maxParticles, 4096, NULL);
+    }
+}
+
+// Draw alive particles
+// NOTE: On GPU simulation, particles quads are generated from storage buffer with one instanced draw call
+void ParticleSystem_Draw(ParticleSystem system, Color tint)
+{
+    ParticleSystemData *data = (ParticleSystemData *)system.data;
+
+    if (data == NULL) return;
+
+    unsigned int textureId = (system.texture.id > 0)? system.texture.id : rlGetTextureIdDefault();
+
+    if (data->particles == NULL)
+    {
+        rlDrawRenderBatchActive();      // Batch geometry drawn before particles
+
+        Matrix matMVP = MatrixMultiply(MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()), rlGetMatrixProjection());
+        float color[4] = { 0 };
+        rlGetDiffuseColor(tint.r, tint.g, tint.b, tint.a, color);
+        int premultiplied = rlIsPremultipliedAlpha()? 1 : 0;
+
+        rlEnableShader(particlesShaderId);
+        rlSetUniformMatrix(particlesShaderLocs[0], matMVP);
+        rlSetUniform(particlesShaderLocs[1], color, RL_SHADER_UNIFORM_VEC4, 1);
+        rlSetUniform(particlesShaderLocs[2], &premultiplied, RL_SHADER_UNIFORM_INT, 1);
+        rlBindShaderBuffer(data->ssboId, 0);
+
+        rlDrawVertexArrayTextureInstanced(data->vaoId, textureId, 6, system.maxParticles);
+
+        rlDisableShader();
+    }
+    else
+    {
+        for (int i = 0; i < system.maxParticles; i++)
+        {
+            const Particle *particle = &data->particles[i];
+
+            if (particle->life <= 0.0f) continue;
+
+            float age = 1.0f - particle->life/particle->lifetime;
+            float size = particle->sizeStart + (particle->sizeEnd - particle->sizeStart)*age;
+            float x0 = particle->position.x - size*0.5f;
+            float y0 = particle->position.y - size*0.5f;
+            float x1 = x0 + size;
+            float y1 = y0 + size;
+
+            if (rlIsQuadCulled(x0, y0, x0, y1, x1, y1, x1, y0)) continue;
+
+            unsigned char rgba[4] = { 0 };
+            unsigned char tintRgba[4] = { tint.r, tint.g, tint.b, tint.a };
+
+            for (int k = 0; k < 4; k++)
+            {
+                float start = (float)((particle->colorStart >> (8*k)) & 0xff);
+                float end = (float)((particle->colorEnd >> (8*k)) & 0xff);
+                rgba[k] = (unsigned char)((start + (end - start)*age)*tintRgba[k]/255.0f);
+            }
+
+            rlCheckRenderBatchLimit(4);     // Make sure there is enough free space on the batch buffer
+
+            rlSetTexture(textureId);
+            rlBegin(RL_QUADS);
+
+                rlColor4ub(rgba[0], rgba[1], rgba[2], rgba[3]);
+
+                rlTexCoord2f(0.0f, 0.0f);
+                rlVertex2f(x0, y0);
+                rlTexCoord2f(0.0f, 1.0f);
+                rlVertex2f(x0, y1);
+                rlTexCoord2f(1.0f, 1.0f);
+                rlVertex2f(x1, y1);
+                rlTexCoord2f(1.0f, 0.0f);
+                rlVertex2f(x1, y0);
+
+            rlEnd();
+        }
+
+        rlSetTexture(0);
+    }
+}
+
+// Check if particle system is simulated on GPU
+bool ParticleSystem_IsGPU(ParticleSystem system)
+{
+    ParticleSystemData *data = (ParticleSystemData *)system.data;
+
+    return ((data != NULL) && (data->particles == NULL));
+}
+
+//------------------------------------------------------------------------------------
+// Sprite batch functions
+//------------------------------------------------------------------------------------
+// Load sprite batch, sprites arrays allocated for capacity sprites
+// NOTE: Sources follow Texture_DrawPro() convention (negative width/height flips), origin is normalized to source size
+SpriteBatch SpriteBatch_Load(Texture2D texture, const Rectangle *sources, int sourceCount, Vector2 origin, int capacity)
+{
+    SpriteBatch batch = { 0 };
+    Rectangle whole = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+
+    if (sources == NULL)
+    {
+        sources = &whole;
+        sourceCount = 1;
+    }
+
+    if ((texture.id == 0) || (capacity <= 0) || (sourceCount <= 0) || (sourceCount > 65536))
+    {
+        TRACELOG(LOG_WARNING, "SPRITEBATCH: Failed to load sprite batch, texture, capacity or sources not valid");
+        return batch;
+    }
+
+    batch.capacity = capacity;
+    batch.texture = texture;
+    batch.x = (float *)ASC_MALLOC(capacity*sizeof(float));
+    batch.y = (float *)ASC_MALLOC(capacity*sizeof(float));
+    batch.rotation = (float *)ASC_MALLOC(capacity*sizeof(float));
+    batch.scale = (float *)ASC_MALLOC(capacity*sizeof(float));
+    batch.source = (unsigned short *)ASC_MALLOC(capacity*sizeof(unsigned short));
+    batch.tint = (Color *)ASC_MALLOC(capacity*sizeof(Color));
+    batch.sourceCount = sourceCount;
+    batch.sources = (float *)ASC_MALLOC(8*sourceCount*sizeof(float));
+
+    // Sources quad data: corners relative to origin (left, top, right, bottom) and texcoords (u0, v0, u1, v1)
+    for (int i = 0; i < sourceCount; i++)
+    {
+        Rectangle source = sources[i];
+        float *data = batch.sources + 8*i;
+        bool flipX = false;
+
+        if (source.width < 0) { flipX = true; source.width *= -1; }
+        if (source.height < 0) source.y -= source.height;
+
+        float height = fabsf(source.height);
+
+        data[0] = -origin.x*source.width;
+        data[1] = -origin.y*height;
+        data[2] = data[0] + source.width;
+        data[3] = data[1] + height;
+        data[4] = (flipX? (source.x + source.width) : source.x)/texture.width;
+        data[5] = source.y/texture.height;
+        data[6] = (flipX? source.x : (source.x + source.width))/texture.width;
+        data[7] = (source.y + source.height)/texture.height;
+    }
+
+    return batch;
+}
+
+// Unload sprite batch arrays
+void SpriteBatch_Free(SpriteBatch batch)
+{
+    ASC_FREE(batch.x);
+    ASC_FREE(batch.y);
+    ASC_FREE(batch.rotation);
+    ASC_FREE(batch.scale);
+    ASC_FREE(batch.source);
+    ASC_FREE(batch.tint);
+    ASC_FREE(batch.sources);
+}
+
+// Add sprite, returns sprite index (-1 if batch is full or source not valid)
+int SpriteBatch_Add(SpriteBatch *batch, Vector2 position, float rotation, float scale, int source, Color tint)
+{
+    if ((batch->count >= batch->capacity) || (source < 0) || (source >= batch->sourceCount)) return -1;
+
+    int index = batch->count;
+
+    batch->x[index] = position.x;
+    batch->y[index] = position.y;
+    batch->rotation[index] = rotation;
+    batch->scale[index] = scale;
+    batch->source[index] = (unsigned short)source;
+    batch->tint[index] = tint;
+    batch->count++;
+
+    return index;
+}
+
+// Remove sprite, last sprite is moved into its index (sprites order not kept)
+void SpriteBatch_Remove(SpriteBatch *batch, int index)
+{
+    if ((index < 0) || (index >= batch->count)) return;
+
+    int last = batch->count - 1;
+
+    batch->x[index] = batch->x[last];
+    batch->y[index] = batch->y[last];
+    batch->rotation[index] = batch->rotation[last];
+    batch->scale[index] = batch->scale[last];
+    batch->source[index] = batch->source[last];
+    batch->tint[index] = batch->tint[last];
+    batch->count--;
+}
+
+// Remove all sprites
+void SpriteBatch_Clear(SpriteBatch *batch)
+{
+    batch->count = 0;
+}
+
+// Draw all sprites, quads written straight into render batch vertex buffers
+// NOTE: Sprites are not view culled, rotation sine/cosine are approximated (error ~0.001)
+void SpriteBatch_Draw(SpriteBatch batch)
+{
+    if ((batch.texture.id == 0) || (batch.count == 0)) return;
+
+    rlSetTexture(batch.texture.id);
+    rlBegin(RL_QUADS);
+
+        rlSpriteArray(batch.x, batch.y, batch.rotation, batch.scale, batch.source, (const unsigned char *)batch.tint, batch.sources, batch.count);
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
+//------------------------------------------------------------------------------------
+// Post-processing functions
+//------------------------------------------------------------------------------------
+// Load post-processing chain, without passes scene is drawn as is
+// NOTE: Render textures are acquired from transient pool every frame, only scene and two ping-pong targets in use at once
+PostFX PostFX_Load(void)
+{
+    PostFX fx = { 0 };
+
+    fx.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    fx.data = ASC_CALLOC(1, sizeof(PostFXData));
+
+    return fx;
+}
+
+// Unload post-processing chain fused shaders and passes code
+// NOTE: Full screen passes shaders are provided by user, they are not unloaded
+void PostFX_Free(PostFX fx)
+{
+    PostFXData *data = (PostFXData *)fx.data;
+
+    if (data == NULL) return;
+
+    for (int i = 0; i < fx.stageCount; i++)
+    {
+        if (data->stages[i].ownsShader) Shader_Free(data->stages[i].shader);
+    }
+
+    for (int i = 0; i < fx.passCount; i++) ASC_FREE(data->passes[i].code);
+
+    if (data->scene.id > 0) RenderTexture_Release(data->scene);
+
+    ASC_FREE(data);
+}
+
+// Add full screen shader pass, shader samples previous pass result as texture0 (neighbour texels allowed)
+int PostFX_AddPass(PostFX *fx, Shader shader)
+{
+    PostFXData *data = (PostFXData *)fx->data;
+
+    if ((data == NULL) || (fx->passCount >= POSTFX_MAX_PASSES)) return -1;
+
+    data->passes[fx->passCount].shader = shader;
+    data->passes[fx->passCount].code = NULL;
+    data->dirty = true;
+    fx->passCount++;
+
+    return fx->passCount - 1;
+}
+
+// Add per-pixel pass, code is the body of a GLSL function: vec4 function(vec4 color, vec2 uv, vec4 params)
+// NOTE: Code must only depend on pixel color and uv (no texture sampling), consecutive per-pixel passes are fused in one shader
+int PostFX_AddPixelPass(PostFX *fx, const char *code)
+{
+    PostFXData *data = (PostFXData *)fx->data;
+
+    if ((data == NULL) || (code == NULL) || (fx->passCount >= POSTFX_MAX_PASSES)) return -1;
+
+    int length = (int)strlen(code);
+
+    data->passes[fx->passCount].code = (char *)ASC_MALLOC(length + 1);
+    memcpy(data->passes[fx->passCount].code, code, length + 1);
+    data->passes[fx->passCount].params = (Vector4){ 0 };
+    data->dirty = true;
+    fx->passCount++;
+
+    return fx->passCount - 1;
+}
+
+// Set per-pixel pass params, provided to pass code as params argument
+void PostFX_SetParams(PostFX *fx, int pass, Vector4 params)
+{
+    PostFXData *data = (PostFXData *)fx->data;
+
+    if ((data == NULL) || (pass < 0) || (pass >= fx->passCount)) return;
+
+    data->passes[pass].params = params;
+}
+
+// Begin drawing scene into post-processing render texture (screen size)
+void PostFX_Begin(PostFX *fx)
+{
+    PostFXData *data = (PostFXData *)fx->data;
+
+    if ((data == NULL) || (data->scene.id > 0)) return;
+
+    data->scene = RenderTexture_Acquire((int)Window_GetWidth(), (int)Window_GetHeight(), fx->format);
+
+    if (data->scene.id > 0) RenderTexture_Begin(data->scene);
+}
+
+// End drawing scene, run passes through ping-pong render textures and draw result to screen
+// NOTE: Last stage draws straight to screen, passes overwrite targets (blending disabled)
+void PostFX_End(PostFX *fx)
+{
+    PostFXData *data = (PostFXData *)fx->data;
+
+    if ((data == NULL) || (data->scene.id == 0)) return;
+
+    RenderTexture_Update();
+
+    if (data->dirty) BuildPostFXStages(fx);
+
+    RenderTexture2D source = data->scene;
+    int width = data->scene.texture.width;
+    int height = data->scene.texture.height;
+
+    rlDisableColorBlend();
+
+    if (fx->stageCount == 0) DrawPostFXQuad(source.texture.id);
+
+    for (int i = 0; i < fx->stageCount; i++)
+    {
+        PostFXStage *stage = &data->stages[i];
+        RenderTexture2D target = { 0 };
+
+        if (i < (fx->stageCount - 1))
+        {
+            target = RenderTexture_Acquire(width, height, fx->format);
+            RenderTexture_Begin(target);
+        }
+
+        if (stage->paramsLoc >= 0)
+        {
+            Vector4 params[POSTFX_MAX_PASSES] = { 0 };
+
+            for (int k = 0; k < stage->passCount; k++) params[k] = data->passes[stage->firstPass + k].params;
+
+            Shader_SetValueV(stage->shader, stage->paramsLoc, params, SHADER_UNIFORM_VEC4, stage->passCount);
+        }
+
+        Shader_Begin(stage->shader);
+        DrawPostFXQuad(source.texture.id);
+        Shader_Update();
+
+        if (target.id > 0) RenderTexture_Update();
+        else rlDrawRenderBatchActive();
+
+        // Previous pass result already drawn, its render texture can be reused by next pass
+        if (source.id != data->scene.id) RenderTexture_Release(source);
+        source = target;
+    }
+
+    rlEnableColorBlend();
+
+    RenderTexture_Release(data->scene);
+    data->scene = (RenderTexture2D){ 0 };
+}
+
+//------------------------------------------------------------------------------------
+// Color/pixel related functions
+//------------------------------------------------------------------------------------
+// Get color with alpha applied, alpha goes from 0.0f to 1.0f
+Color Color_Fade(Color color, float alpha)
+{
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+
+    return (Color){color.r, color.g, color.b, (unsigned char)(255.0f*alpha)};
+}
+
+// Get src alpha-blended into dst color with tint
+Color Color_AlphaBlend(Color dst, Color src, Color tint)
+{
+    Color out = WHITE;
+
+    // Apply color tint to source color
+    src.r = (unsigned char)(((unsigned int)src.r*(unsigned int)tint.r) >> 8);
+    src.g = (unsigned char)(((unsigned int)src.g*(unsigned int)tint.g) >> 8);
+    src.b = (unsigned char)(((unsigned int)src.b*(unsigned int)tint.b) >> 8);
+    src.a = (unsigned char)(((unsigned int)src.a*(unsigned int)tint.a) >> 8);
+
+//#define COLORALPHABLEND_FLOAT
+#define COLORALPHABLEND_INTEGERS
+#if defined(COLORALPHABLEND_INTEGERS)
+    if (src.a == 0) out = dst;
+    else if (src.a == 255) out = src;
+    else
+    {
+        unsigned int alpha = (unsigned int)src.a + 1;     // We are shifting by 8 (dividing by 256), so we need to take that excess into account
+        out.a = (unsigned char)(((unsigned int)alpha*256 + (unsigned int)dst.a*(256 - alpha)) >> 8);
+
+        if (out.a > 0)
+        {
+            out.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            out.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            out.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+        }
+    }
+#endif
+#if defined(COLORALPHABLEND_FLOAT)
+    if (src.a == 0) out = dst;
+    else if (src.a == 255) out = src;
+    else
+    {
+        Vector4 fdst = ColorNormalize(dst);
+        Vector4 fsrc = ColorNormalize(src);
+        Vector4 ftint = ColorNormalize(tint);
+        Vector4 fout = { 0 };
+
+        fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
+
+        if (fout.w > 0.0f)
+        {
+            fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
+            fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
+            fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
+        }
+
+        out = (Color){ (unsigned char)(fout.x*255.0f), (unsigned char)(fout.y*255.0f), (unsigned char)(fout.z*255.0f), (unsigned char)(fout.w*255.0f) };
+    }
+#endif
+
+    return out;
+}
+
+// Get color from a pixel from certain format
+Color Color_GetPixel(void *srcPtr, int format)
+{
+    Color color = { 0 };
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], 255 }; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1] }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
+            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 5) & 0b0000000000111111)*255/63);
+            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
+            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 6) & 0b0000000000011111)*255/31);
+            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
+            color.a = (((unsigned short *)srcPtr)[0] & 0b0000000000000001)? 255 : 0;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 12)*255/15);
+            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 8) & 0b0000000000001111)*255/15);
+            color.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 4) & 0b0000000000001111)*255/15);
+            color.a = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000001111)*255/15);
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], ((unsigned char *)srcPtr)[3] }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], 255 }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.g = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.b = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
+            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
+            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
+            color.a = (unsigned char)(((float *)srcPtr)[3]*255.0f);
+
+        } break;
+        default: break;
+    }
+
+    return color;
+}
+
+// Set pixel color formatted into destination pointer
+void Color_SetPixel(void *dstPtr, Color color, int format)
+{
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+
+            ((unsigned char *)dstPtr)[0] = gray;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
             // NOTE: Calculate grayscale equivalent color
             Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
             unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
@@ -4026,3 +5299,646 @@ static int Glyph_GetIndex(Font font, int codepoint)
 #endif
 }
 #endif // SUPPORT_IMAGE_DRAWING
+
+// Add an empty page to atlas (texture and packing state)
+// NOTE: Page texture is initialized to transparent pixels
+static bool AddAtlasPage(Atlas *atlas)
+{
+    unsigned char *data = (unsigned char *)ASC_CALLOC(atlas->width*atlas->height, 4*sizeof(unsigned char));
+    Texture2D page = { 0 };
+
+    page.id = rlLoadTexture(data, atlas->width, atlas->height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+    page.width = atlas->width;
+    page.height = atlas->height;
+    page.mipmaps = 1;
+    page.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    ASC_FREE(data);
+
+    if (page.id == 0)
+    {
+        TRACELOG(LOG_WARNING, "ATLAS: Failed to load atlas page texture");
+        return false;
+    }
+
+    AtlasPacker *packer = (AtlasPacker *)ASC_MALLOC(sizeof(AtlasPacker) + atlas->width*sizeof(stbrp_node));
+    stbrp_init_target(&packer->context, atlas->width, atlas->height, packer->nodes, atlas->width);
+
+    atlas->pages = (Texture2D *)ASC_REALLOC(atlas->pages, (atlas->pageCount + 1)*sizeof(Texture2D));
+    atlas->packers = ASC_REALLOC(atlas->packers, (atlas->pageCount + 1)*sizeof(AtlasPacker *));
+    atlas->pages[atlas->pageCount] = page;
+    ((AtlasPacker **)atlas->packers)[atlas->pageCount] = packer;
+    atlas->pageCount++;
+
+    TRACELOG(LOG_INFO, "ATLAS: [ID %i] Atlas page %i loaded successfully (%ix%i)", page.id, atlas->pageCount - 1, page.width, page.height);
+
+    return true;
+}
+
+// Copy image into atlas page at packed position
+// NOTE: Image border pixels are repeated around it (extrude), padding pixels are not updated
+static AtlasSprite UpdateAtlasSprite(Atlas *atlas, int page, Image image, int x, int y)
+{
+    AtlasSprite sprite = { 0 };
+
+    int width = image.width + 2*atlas->extrude;
+    int height = image.height + 2*atlas->extrude;
+
+    Color *pixels = LoadImageColors(image);
+    Color *data = (Color *)ASC_MALLOC(width*height*sizeof(Color));
+    bool premultiply = rlIsPremultipliedAlpha();
+
+    for (int j = 0; j < height; j++)
+    {
+        int srcY = j - atlas->extrude;
+        if (srcY < 0) srcY = 0;
+        else if (srcY >= image.height) srcY = image.height - 1;
+
+        for (int i = 0; i < width; i++)
+        {
+            int srcX = i - atlas->extrude;
+            if (srcX < 0) srcX = 0;
+            else if (srcX >= image.width) srcX = image.width - 1;
+
+            Color color = pixels[srcY*image.width + srcX];
+
+            // Premultiplied alpha blending requires premultiplied texture color
+            if (premultiply)
+            {
+                color.r = (unsigned char)((color.r*color.a + 127)/255);
+                color.g = (unsigned char)((color.g*color.a + 127)/255);
+                color.b = (unsigned char)((color.b*color.a + 127)/255);
+            }
+
+            data[j*width + i] = color;
+        }
+    }
+
+    rlUpdateTexture(atlas->pages[page].id, x, y, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, data);
+
+    ASC_FREE(data);
+    UnloadImageColors(pixels);
+
+    sprite.texture = atlas->pages[page];
+    sprite.source = (Rectangle){ (float)(x + atlas->extrude), (float)(y + atlas->extrude), (float)image.width, (float)image.height };
+
+    return sprite;
+}
+
+// Load render texture with color texture of given format and depth renderbuffer
+static RenderTexture2D LoadRenderTextureFormat(int width, int height, int format)
+{
+    RenderTexture2D target = { 0 };
+
+    if (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "FBO: Compressed formats not supported for render textures");
+        return target;
+    }
+
+    target.id = rlLoadFramebuffer(width, height);   // Load an empty framebuffer
+
+    if (target.id > 0)
+    {
+        rlEnableFramebuffer(target.id);
+
+        // Create color texture
+        target.texture.id = rlLoadTexture(NULL, width, height, format, 1);
+        target.texture.width = width;
+        target.texture.height = height;
+        target.texture.format = format;
+        target.texture.mipmaps = 1;
+
+        // Create depth renderbuffer/texture
+        target.depth.id = rlLoadTextureDepth(width, height, true);
+        target.depth.width = width;
+        target.depth.height = height;
+        target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
+        target.depth.mipmaps = 1;
+
+        // Attach color texture and depth renderbuffer/texture to FBO
+        rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+        rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
+
+        // Check if fbo is complete with attachments (valid)
+        if (rlFramebufferComplete(target.id)) TRACELOG(LOG_INFO, "FBO: [ID %i] Framebuffer object created successfully", target.id);
+
+        rlDisableFramebuffer();
+    }
+    else TRACELOG(LOG_WARNING, "FBO: Framebuffer object can not be created");
+
+    return target;
+}
+
+// Load tilemap shader, chunk vertex texcoords are offset by tile animation slot
+// NOTE: Animation slot is provided as vertexTexCoord2 attribute (location 5), shader is not loaded on OpenGL 1.1
+static void LoadTilemapShader(void)
+{
+    const char *vsCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute float vertexTexCoord2;   \n"
+    "varying vec2 fragTexCoord;         \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in float vertexTexCoord2;          \n"
+    "out vec2 fragTexCoord;             \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute float vertexTexCoord2;   \n"
+    "varying vec2 fragTexCoord;         \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "uniform vec2 animOffset[16];       \n"     // NOTE: TILEMAP_MAX_ANIMATIONS + 1
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord + animOffset[int(vertexTexCoord2 + 0.5)]; \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 0.0, 1.0); \n"
+    "}                                  \n";
+
+    const char *fsCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*colDiffuse; \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalColor = texture(texture0, fragTexCoord)*colDiffuse; \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+    "varying vec2 fragTexCoord;         \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*colDiffuse; \n"
+    "}                                  \n";
+#else
+    NULL;
+#endif
+
+    if (fsCode == NULL) return;
+
+    tilemapShaderId = rlLoadShaderCode(vsCode, fsCode);
+
+    // Default shader is returned if loading failed, tilemaps are drawn through batch
+    if (tilemapShaderId == rlGetShaderIdDefault())
+    {
+        TRACELOG(LOG_WARNING, "TILEMAP: Failed to load tilemap shader, tilemaps drawn through batch");
+        tilemapShaderId = 0;
+        return;
+    }
+
+    tilemapShaderLocs[0] = rlGetLocationUniform(tilemapShaderId, "mvp");
+    tilemapShaderLocs[1] = rlGetLocationUniform(tilemapShaderId, "colDiffuse");
+    tilemapShaderLocs[2] = rlGetLocationUniform(tilemapShaderId, "animOffset");
+}
+
+// Get tile rectangle in tileset, tiles are indexed left to right, top to bottom
+// NOTE: Returned rectangle is empty if tile is not in tileset
+static Rectangle GetTilemapTileSource(Tilemap tilemap, int tile)
+{
+    Rectangle source = { 0 };
+    int columns = tilemap.tileset.width/tilemap.tileWidth;
+    int rows = tilemap.tileset.height/tilemap.tileHeight;
+
+    if ((tile >= 0) && (tile < columns*rows))
+    {
+        source.x = (float)((tile%columns)*tilemap.tileWidth);
+        source.y = (float)((tile/columns)*tilemap.tileHeight);
+        source.width = (float)tilemap.tileWidth;
+        source.height = (float)tilemap.tileHeight;
+    }
+
+    return source;
+}
+
+// Get tilemap tile vertex data: position (relative to tilemap), texcoords and animation slot
+// NOTE: Empty tiles are degenerated (all zero), so tiles vertex offsets never change
+static void GetTilemapTileVertex(Tilemap tilemap, int x, int y, float *vertices)
+{
+    const TilemapData *data = (const TilemapData *)tilemap.chunks;
+    int tile = tilemap.tiles[y*tilemap.width + x];
+    Rectangle source = GetTilemapTileSource(tilemap, tile);
+
+    memset(vertices, 0, 4*TILEMAP_VERTEX_FLOATS*sizeof(float));
+
+    if (source.width == 0.0f) return;
+
+    float slot = 0.0f;
+    for (int i = 0; i < data->animationCount; i++) if (data->animations[i].tile == tile) slot = (float)(i + 1);
+
+    float x0 = (float)(x*tilemap.tileWidth);
+    float y0 = (float)(y*tilemap.tileHeight);
+    float x1 = x0 + tilemap.tileWidth;
+    float y1 = y0 + tilemap.tileHeight;
+    float u0 = source.x/tilemap.tileset.width;
+    float v0 = source.y/tilemap.tileset.height;
+    float u1 = (source.x + source.width)/tilemap.tileset.width;
+    float v1 = (source.y + source.height)/tilemap.tileset.height;
+
+    // Quad vertex: top-left, bottom-left, bottom-right, top-right (same order as batch quads)
+    const float quad[4][4] = { { x0, y0, u0, v0 }, { x0, y1, u0, v1 }, { x1, y1, u1, v1 }, { x1, y0, u1, v0 } };
+
+    for (int i = 0; i < 4; i++)
+    {
+        memcpy(vertices + i*TILEMAP_VERTEX_FLOATS, quad[i], 4*sizeof(float));
+        vertices[i*TILEMAP_VERTEX_FLOATS + 4] = slot;
+    }
+}
+
+// Bake tilemap chunk tiles into chunk vertex buffer, vertex array is loaded on first bake
+// NOTE: If vertex arrays are not supported, tilemap is drawn through batch
+static void BakeTilemapChunk(Tilemap tilemap, int chunkX, int chunkY)
+{
+    TilemapData *data = (TilemapData *)tilemap.chunks;
+    TilemapChunk *chunk = &data->chunks[chunkY*data->chunkCountX + chunkX];
+
+    int startX = chunkX*TILEMAP_CHUNK_SIZE;
+    int startY = chunkY*TILEMAP_CHUNK_SIZE;
+    int chunkWidth = ((tilemap.width - startX) < TILEMAP_CHUNK_SIZE)? (tilemap.width - startX) : TILEMAP_CHUNK_SIZE;
+    int chunkHeight = ((tilemap.height - startY) < TILEMAP_CHUNK_SIZE)? (tilemap.height - startY) : TILEMAP_CHUNK_SIZE;
+    int dataSize = chunkWidth*chunkHeight*4*TILEMAP_VERTEX_FLOATS*sizeof(float);
+    float *vertices = (float *)ASC_MALLOC(dataSize);
+
+    for (int y = 0; y < chunkHeight; y++)
+    {
+        for (int x = 0; x < chunkWidth; x++) GetTilemapTileVertex(tilemap, startX + x, startY + y, vertices + (y*chunkWidth + x)*4*TILEMAP_VERTEX_FLOATS);
+    }
+
+    if (chunk->vaoId == 0)
+    {
+        chunk->vaoId = rlLoadVertexArray();
+
+        if (chunk->vaoId == 0)
+        {
+            TRACELOG(LOG_WARNING, "TILEMAP: Vertex arrays not supported, tilemap drawn through batch");
+            data->baked = false;
+        }
+        else
+        {
+            int stride = TILEMAP_VERTEX_FLOATS*sizeof(float);
+
+            rlEnableVertexArray(chunk->vaoId);
+
+            chunk->vboId = rlLoadVertexBuffer(vertices, dataSize, false);
+            rlSetVertexAttribute(0, 2, RL_FLOAT, false, stride, (void *)0);                     // Position: vertexPosition
+            rlEnableVertexAttribute(0);
+            rlSetVertexAttribute(1, 2, RL_FLOAT, false, stride, (void *)(2*sizeof(float)));     // Texcoord: vertexTexCoord
+            rlEnableVertexAttribute(1);
+            rlSetVertexAttribute(5, 1, RL_FLOAT, false, stride, (void *)(4*sizeof(float)));     // Animation slot: vertexTexCoord2
+            rlEnableVertexAttribute(5);
+
+            // Quads elements buffer is shared by chunks, its binding is kept by chunk vertex array
+            if (data->eboId == 0)
+            {
+                int quadCount = TILEMAP_CHUNK_SIZE*TILEMAP_CHUNK_SIZE;
+                unsigned short *indices = (unsigned short *)ASC_MALLOC(6*quadCount*sizeof(unsigned short));
+
+                for (int i = 0; i < quadCount; i++)
+                {
+                    indices[6*i] = (unsigned short)(4*i);
+                    indices[6*i + 1] = (unsigned short)(4*i + 1);
+                    indices[6*i + 2] = (unsigned short)(4*i + 2);
+                    indices[6*i + 3] = (unsigned short)(4*i);
+                    indices[6*i + 4] = (unsigned short)(4*i + 2);
+                    indices[6*i + 5] = (unsigned short)(4*i + 3);
+                }
+
+                data->eboId = rlLoadVertexBufferElement(indices, 6*quadCount*sizeof(unsigned short), false);
+                ASC_FREE(indices);
+            }
+            else rlEnableVertexBufferElement(data->eboId);
+
+            rlDisableVertexArray();
+        }
+    }
+    else rlUpdateVertexBuffer(chunk->vboId, vertices, dataSize, 0);
+
+    ASC_FREE(vertices);
+
+    chunk->dirty = false;
+}
+
+// Load particles compute and draw shaders, particles read from storage buffer (binding 0)
+// NOTE: Requires OpenGL 4.3, particle systems are simulated on CPU if not loaded
+static void LoadParticlesShaders(void)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    #define PARTICLE_GLSL_STRUCT \
+    "struct Particle {                  \n" \
+    "    vec2 position;                 \n" \
+    "    vec2 velocity;                 \n" \
+    "    float life;                    \n" \
+    "    float lifetime;                \n" \
+    "    float sizeStart;               \n" \
+    "    float sizeEnd;                 \n" \
+    "    uint colorStart;               \n" \
+    "    uint colorEnd;                 \n" \
+    "};                                 \n"
+
+    const char *csCode =
+    "#version 430                       \n"
+    "layout(local_size_x = 256) in;     \n"     // NOTE: PARTICLES_WORKGROUP_SIZE
+    PARTICLE_GLSL_STRUCT
+    "layout(std430, binding = 0) buffer ParticlesBuffer { Particle particles[]; }; \n"
+    "uniform float deltaTime;           \n"
+    "uniform vec2 gravity;              \n"
+    "uniform int particleCount;         \n"
+    "uniform int emissionCount;         \n"
+    "uniform ivec4 emitRanges[16];      \n"     // NOTE: PARTICLES_MAX_EMISSIONS
+    "uniform vec4 emitParams[48];       \n"
+    "float random(inout uint state)     \n"
+    "{                                  \n"
+    "    state ^= state >> 16; state *= 0x7feb352du; state ^= state >> 15; state *= 0x846ca68bu; state ^= state >> 16; \n"
+    "    return float(state >> 8)/16777216.0; \n"
+    "}                                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    int i = int(gl_GlobalInvocationID.x); \n"
+    "    if (i >= particleCount) return; \n"
+    "    Particle p = particles[i];     \n"
+    "    for (int e = 0; e < emissionCount; e++) \n"
+    "    {                              \n"
+    "        int offset = i - emitRanges[e].x; \n"
+    "        if (offset < 0) offset += particleCount; \n"
+    "        if (offset >= emitRanges[e].y) continue; \n"
+    "        vec4 p0 = emitParams[3*e]; \n"
+    "        vec4 p1 = emitParams[3*e + 1]; \n"
+    "        vec4 p2 = emitParams[3*e + 2]; \n"
+    "        uint state = uint(i)*747796405u + uint(p2.w); \n"
+    "        float angle = (random(state) - 0.5)*p1.z; \n"
+    "        vec2 v = p1.xy*(1.0 + (random(state)*2.0 - 1.0)*p1.w); \n"
+    "        p.position = p0.xy + (vec2(random(state), random(state)) - 0.5)*p0.zw; \n"
+    "        p.velocity = vec2(v.x*cos(angle) - v.y*sin(angle), v.x*sin(angle) + v.y*cos(angle)); \n"
+    "        p.life = p2.x;             \n"
+    "        p.lifetime = p2.x;         \n"
+    "        p.sizeStart = p2.y;        \n"
+    "        p.sizeEnd = p2.z;          \n"
+    "        p.colorStart = uint(emitRanges[e].z); \n"
+    "        p.colorEnd = uint(emitRanges[e].w); \n"
+    "    }                              \n"
+    "    if (p.life > 0.0)              \n"
+    "    {                              \n"
+    "        p.velocity += gravity*deltaTime; \n"
+    "        p.position += p.velocity*deltaTime; \n"
+    "        p.life -= deltaTime;       \n"
+    "    }                              \n"
+    "    particles[i] = p;              \n"
+    "}                                  \n";
+
+    // Particle quads generated from instance particle, dead particles degenerated (zero size)
+    const char *vsCode =
+    "#version 430                       \n"
+    PARTICLE_GLSL_STRUCT
+    "layout(std430, binding = 0) readonly buffer ParticlesBuffer { Particle particles[]; }; \n"
+    "uniform mat4 mvp;                  \n"
+    "uniform int premultiplied;         \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+    "const vec2 corners[6] = vec2[6](vec2(0.0, 0.0), vec2(0.0, 1.0), vec2(1.0, 1.0), vec2(0.0, 0.0), vec2(1.0, 1.0), vec2(1.0, 0.0)); \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    Particle p = particles[gl_InstanceID]; \n"
+    "    vec2 corner = corners[gl_VertexID]; \n"
+    "    float age = (p.lifetime > 0.0)? 1.0 - p.life/p.lifetime : 1.0; \n"
+    "    float size = (p.life > 0.0)? mix(p.sizeStart, p.sizeEnd, age) : 0.0; \n"
+    "    fragTexCoord = corner;         \n"
+    "    fragColor = mix(unpackUnorm4x8(p.colorStart), unpackUnorm4x8(p.colorEnd), age); \n"
+    "    if (premultiplied == 1) fragColor.rgb *= fragColor.a; \n"
+    "    gl_Position = mvp*vec4(p.position + (corner - 0.5)*size, 0.0, 1.0); \n"
+    "}                                  \n";
+
+    const char *fsCode =
+    "#version 430                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalColor = texture(texture0, fragTexCoord)*fragColor*colDiffuse; \n"
+    "}                                  \n";
+
+    #undef PARTICLE_GLSL_STRUCT
+
+    unsigned int csId = rlCompileShader(csCode, RL_COMPUTE_SHADER);
+    if (csId > 0) particlesComputeId = rlLoadComputeShaderProgram(csId);
+    particlesShaderId = rlLoadShaderCode(vsCode, fsCode);
+
+    // Default shader is returned if loading failed, both programs required for GPU simulation
+    if ((particlesComputeId == 0) || (particlesShaderId == rlGetShaderIdDefault()))
+    {
+        TRACELOG(LOG_WARNING, "PARTICLES: Failed to load particles shaders, particles simulated on CPU");
+        if (particlesComputeId > 0) rlUnloadShaderProgram(particlesComputeId);
+        if ((particlesShaderId > 0) && (particlesShaderId != rlGetShaderIdDefault())) rlUnloadShaderProgram(particlesShaderId);
+        particlesComputeId = 0;
+        particlesShaderId = 0;
+        return;
+    }
+
+    particlesComputeLocs[0] = rlGetLocationUniform(particlesComputeId, "deltaTime");
+    particlesComputeLocs[1] = rlGetLocationUniform(particlesComputeId, "gravity");
+    particlesComputeLocs[2] = rlGetLocationUniform(particlesComputeId, "particleCount");
+    particlesComputeLocs[3] = rlGetLocationUniform(particlesComputeId, "emissionCount");
+    particlesComputeLocs[4] = rlGetLocationUniform(particlesComputeId, "emitRanges");
+    particlesComputeLocs[5] = rlGetLocationUniform(particlesComputeId, "emitParams");
+
+    particlesShaderLocs[0] = rlGetLocationUniform(particlesShaderId, "mvp");
+    particlesShaderLocs[1] = rlGetLocationUniform(particlesShaderId, "colDiffuse");
+    particlesShaderLocs[2] = rlGetLocationUniform(particlesShaderId, "premultiplied");
+#endif
+}
+
+// Get random value in [0.0f, 1.0f) from xorshift state (state advanced)
+static float GetParticlesRandom(unsigned int *state)
+{
+    unsigned int x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+
+    return (float)(x >> 8)/16777216.0f;
+}
+
+// Update particles [start, end): integrate velocity and position, age alive particles
+static void UpdateParticlesBatch(void *data, int start, int end)
+{
+    ParticlesUpdateJob *job = (ParticlesUpdateJob *)data;
+
+    for (int i = start; i < end; i++)
+    {
+        Particle *particle = &job->particles[i];
+
+        if (particle->life <= 0.0f) continue;
+
+        particle->velocity.x += job->gravity.x*job->deltaTime;
+        particle->velocity.y += job->gravity.y*job->deltaTime;
+        particle->position.x += particle->velocity.x*job->deltaTime;
+        particle->position.y += particle->velocity.y*job->deltaTime;
+        particle->life -= job->deltaTime;
+    }
+}
+
+// Build post-processing stages: full screen passes run alone, consecutive per-pixel passes fused in one generated shader
+static void BuildPostFXStages(PostFX *fx)
+{
+    PostFXData *data = (PostFXData *)fx->data;
+
+    for (int i = 0; i < fx->stageCount; i++)
+    {
+        if (data->stages[i].ownsShader) Shader_Free(data->stages[i].shader);
+    }
+
+    fx->stageCount = 0;
+
+    for (int i = 0; i < fx->passCount; )
+    {
+        PostFXStage *stage = &data->stages[fx->stageCount];
+
+        stage->firstPass = i;
+        stage->passCount = 1;
+        stage->paramsLoc = -1;
+        stage->ownsShader = false;
+
+        if (data->passes[i].code == NULL) stage->shader = data->passes[i].shader;
+        else
+        {
+            while (((i + stage->passCount) < fx->passCount) && (data->passes[i + stage->passCount].code != NULL)) stage->passCount++;
+
+            stage->shader = LoadPostFXShader(&data->passes[i], stage->passCount);
+
+            // Default shader is returned if loading failed, passes skipped
+            if (stage->shader.id == rlGetShaderIdDefault())
+            {
+                TRACELOG(LOG_WARNING, "POSTFX: Failed to load per-pixel passes shader (passes %i to %i), passes skipped", i, i + stage->passCount - 1);
+                Shader_Free(stage->shader);
+                i += stage->passCount;
+                continue;
+            }
+
+            stage->ownsShader = true;
+
+            // NOTE: Params uniform could be optimized out by shader compiler if no pass uses it
+            stage->paramsLoc = Shader_GetLoc(stage->shader, "fxParams");
+        }
+
+        i += stage->passCount;
+        fx->stageCount++;
+    }
+
+    data->dirty = false;
+
+    TRACELOG(LOG_INFO, "POSTFX: Post-processing chain built (%i passes, %i full screen passes)", fx->passCount, fx->stageCount);
+}
+
+// Load fused per-pixel passes shader, passes code wrapped as functions applied in order to texel color
+static Shader LoadPostFXShader(const PostFXPass *passes, int count)
+{
+    const char *header =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "#define TEXTURE texture2D          \n"
+    "#define FINAL_COLOR gl_FragColor   \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "#define TEXTURE texture            \n"
+    "#define FINAL_COLOR finalColor     \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "#define TEXTURE texture2D          \n"
+    "#define FINAL_COLOR gl_FragColor   \n"
+#else
+    NULL;
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n";
+#endif
+
+    Shader shader = { 0 };
+
+    if (header == NULL) return shader;
+
+    int size = (int)strlen(header) + 256;
+    for (int i = 0; i < count; i++) size += (int)strlen(passes[i].code) + 128;
+
+    char *code = (char *)ASC_MALLOC(size);
+    int length = sprintf(code, "%suniform vec4 fxParams[%i];\n", header, count);
+
+    for (int i = 0; i < count; i++) length += sprintf(code + length, "vec4 fx%i(vec4 color, vec2 uv, vec4 params)\n{\n%s\n}\n", i, passes[i].code);
+
+    length += sprintf(code + length, "void main()\n{\n    vec4 color = TEXTURE(texture0, fragTexCoord);\n");
+    for (int i = 0; i < count; i++) length += sprintf(code + length, "    color = fx%i(color, fragTexCoord, fxParams[%i]);\n", i, i);
+    sprintf(code + length, "    FINAL_COLOR = color*colDiffuse*fragColor;\n}\n");
+
+    shader = Shader_LoadData(NULL, code);
+
+    ASC_FREE(code);
+
+    return shader;
+}
+
+// Draw texture as full screen quad, vertex defined in normalized device coordinates (render textures are vertically flipped)
+static void DrawPostFXQuad(unsigned int textureId)
+{
+    rlMatrixMode(RL_PROJECTION);
+    rlPushMatrix();
+    rlLoadIdentity();
+    rlMatrixMode(RL_MODELVIEW);
+
+    rlCheckRenderBatchLimit(4);     // Make sure there is enough free space on the batch buffer
+
+    rlSetTexture(textureId);
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(255, 255, 255, 255);
+
+        rlTexCoord2f(0.0f, 1.0f);
+        rlVertex2f(-1.0f, 1.0f);
+        rlTexCoord2f(0.0f, 0.0f);
+        rlVertex2f(-1.0f, -1.0f);
+        rlTexCoord2f(1.0f, 0.0f);
+        rlVertex2f(1.0f, -1.0f);
+        rlTexCoord2f(1.0f, 1.0f);
+        rlVertex2f(1.0f, 1.0f);
+
+    rlEnd();
+    rlSetTexture(0);
+
+    rlDrawRenderBatchActive();      // Quad drawn with identity projection
+
+    rlMatrixMode(RL_PROJECTION);
+    rlPopMatrix();
+    rlMatrixMode(RL_MODELVIEW);
+}
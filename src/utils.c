@@ -52,6 +52,25 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+#if defined(_WIN32)
+    // NOTE: Declared here to avoid windows.h inclusion (Rectangle, CloseWindow... symbols collide)
+    void *__stdcall CreateThread(void *attributes, size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+    unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+    int __stdcall CloseHandle(void *handle);
+    int __stdcall SwitchToThread(void);
+    unsigned long __stdcall GetActiveProcessorCount(unsigned short groupNumber);
+    void __stdcall InitializeSRWLock(void **lock);
+    void __stdcall AcquireSRWLockExclusive(void **lock);
+    void __stdcall ReleaseSRWLockExclusive(void **lock);
+    void __stdcall InitializeConditionVariable(void **cond);
+    int __stdcall SleepConditionVariableSRW(void **cond, void **lock, unsigned long milliseconds, unsigned long flags);
+    void __stdcall WakeConditionVariable(void **cond);
+    void __stdcall WakeAllConditionVariable(void **cond);
+#else
+    #include <sched.h>                  // Required for: sched_yield()
+    #include <unistd.h>                 // Required for: sysconf()
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -98,6 +117,12 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+#if defined(_WIN32)
+static unsigned long __stdcall ThreadEntry(void *param);   // Win32 thread entry point, calls Thread.func
+#else
+static void *ThreadEntry(void *param);                      // POSIX thread entry point, calls Thread.func
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -342,6 +367,145 @@ bool File_SaveStr(const char *fileName, char *text)
     return success;
 }
 
+// Create and start a thread
+// NOTE: Thread struct must remain valid until ThreadJoin()
+bool ThreadCreate(Thread *thread, ThreadFunc func, void *arg)
+{
+    thread->func = func;
+    thread->arg = arg;
+
+#if defined(_WIN32)
+    thread->handle = CreateThread(NULL, 0, ThreadEntry, thread, 0, NULL);
+    return (thread->handle != NULL);
+#else
+    return (pthread_create(&thread->handle, NULL, ThreadEntry, thread) == 0);
+#endif
+}
+
+// Wait for thread to finish and release it
+void ThreadJoin(Thread *thread)
+{
+#if defined(_WIN32)
+    WaitForSingleObject(thread->handle, 0xFFFFFFFF);    // INFINITE
+    CloseHandle(thread->handle);
+    thread->handle = NULL;
+#else
+    pthread_join(thread->handle, NULL);
+#endif
+}
+
+// Yield calling thread time slice
+void ThreadYield(void)
+{
+#if defined(_WIN32)
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+// Get number of logical processors available
+int GetCpuCoreCount(void)
+{
+    int count = 1;
+
+#if defined(_WIN32)
+    count = (int)GetActiveProcessorCount(0xFFFF);       // ALL_PROCESSOR_GROUPS
+#elif defined(_SC_NPROCESSORS_ONLN)
+    count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    return (count > 0)? count : 1;
+}
+
+// Initialize mutex
+void MutexInit(Mutex *mutex)
+{
+#if defined(_WIN32)
+    InitializeSRWLock(&mutex->lock);
+#else
+    pthread_mutex_init(&mutex->lock, NULL);
+#endif
+}
+
+// Destroy mutex
+// NOTE: SRW locks do not need to be destroyed
+void MutexDestroy(Mutex *mutex)
+{
+#if !defined(_WIN32)
+    pthread_mutex_destroy(&mutex->lock);
+#endif
+}
+
+// Lock mutex
+void MutexLock(Mutex *mutex)
+{
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&mutex->lock);
+#else
+    pthread_mutex_lock(&mutex->lock);
+#endif
+}
+
+// Unlock mutex
+void MutexUnlock(Mutex *mutex)
+{
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive(&mutex->lock);
+#else
+    pthread_mutex_unlock(&mutex->lock);
+#endif
+}
+
+// Initialize condition variable
+void ConditionInit(Condition *cond)
+{
+#if defined(_WIN32)
+    InitializeConditionVariable(&cond->cond);
+#else
+    pthread_cond_init(&cond->cond, NULL);
+#endif
+}
+
+// Destroy condition variable
+void ConditionDestroy(Condition *cond)
+{
+#if !defined(_WIN32)
+    pthread_cond_destroy(&cond->cond);
+#endif
+}
+
+// Wait for condition signal, mutex must be locked
+// NOTE: Spurious wakeups are possible, always check predicate in a loop
+void ConditionWait(Condition *cond, Mutex *mutex)
+{
+#if defined(_WIN32)
+    SleepConditionVariableSRW(&cond->cond, &mutex->lock, 0xFFFFFFFF, 0);
+#else
+    pthread_cond_wait(&cond->cond, &mutex->lock);
+#endif
+}
+
+// Wake one thread waiting on condition
+void ConditionSignal(Condition *cond)
+{
+#if defined(_WIN32)
+    WakeConditionVariable(&cond->cond);
+#else
+    pthread_cond_signal(&cond->cond);
+#endif
+}
+
+// Wake all threads waiting on condition
+void ConditionBroadcast(Condition *cond)
+{
+#if defined(_WIN32)
+    WakeAllConditionVariable(&cond->cond);
+#else
+    pthread_cond_broadcast(&cond->cond);
+#endif
+}
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
@@ -388,6 +552,25 @@ FILE *android_fopen(const char *fileName, const char *mode)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Thread entry point, calls user function
+#if defined(_WIN32)
+static unsigned long __stdcall ThreadEntry(void *param)
+{
+    Thread *thread = (Thread *)param;
+    thread->func(thread->arg);
+
+    return 0;
+}
+#else
+static void *ThreadEntry(void *param)
+{
+    Thread *thread = (Thread *)param;
+    thread->func(thread->arg);
+
+    return NULL;
+}
+#endif
+
 #if defined(PLATFORM_ANDROID)
 static int android_read(void *cookie, char *buf, int size)
 {
@@ -34,6 +34,10 @@
     #include <android/asset_manager.h>      // Required for: AAssetManager
 #endif
 
+#if !defined(_WIN32)
+    #include <pthread.h>                    // Required for: pthread_t, pthread_mutex_t, pthread_cond_t
+#endif
+
 #if defined(SUPPORT_TRACELOG)
     #define TRACELOG(level, ...) TraceLog(level, __VA_ARGS__)
 
@@ -57,7 +61,35 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Thread entry point
+typedef void (*ThreadFunc)(void *arg);
+
+// Thread, Mutex and Condition are thin wrappers over Win32 threads/SRW locks or POSIX threads
+typedef struct Thread {
+#if defined(_WIN32)
+    void *handle;                   // Thread handle (HANDLE)
+#else
+    pthread_t handle;               // Thread id
+#endif
+    ThreadFunc func;                // Thread entry point
+    void *arg;                      // Thread entry point argument
+} Thread;
+
+typedef struct Mutex {
+#if defined(_WIN32)
+    void *lock;                     // SRWLOCK (pointer sized)
+#else
+    pthread_mutex_t lock;           // POSIX mutex
+#endif
+} Mutex;
+
+typedef struct Condition {
+#if defined(_WIN32)
+    void *cond;                     // CONDITION_VARIABLE (pointer sized)
+#else
+    pthread_cond_t cond;            // POSIX condition variable
+#endif
+} Condition;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -71,6 +103,21 @@
 extern "C" {            // Prevents name mangling of functions
 #endif
 
+// Threading functions
+bool ThreadCreate(Thread *thread, ThreadFunc func, void *arg);         // Create and start a thread, returns false on failure
+void ThreadJoin(Thread *thread);                                       // Wait for thread to finish and release it
+void ThreadYield(void);                                                // Yield calling thread time slice
+int GetCpuCoreCount(void);                                             // Get number of logical processors available
+void MutexInit(Mutex *mutex);                                          // Initialize mutex
+void MutexDestroy(Mutex *mutex);                                       // Destroy mutex
+void MutexLock(Mutex *mutex);                                          // Lock mutex
+void MutexUnlock(Mutex *mutex);                                        // Unlock mutex
+void ConditionInit(Condition *cond);                                   // Initialize condition variable
+void ConditionDestroy(Condition *cond);                                // Destroy condition variable
+void ConditionWait(Condition *cond, Mutex *mutex);                     // Wait for condition signal, mutex must be locked
+void ConditionSignal(Condition *cond);                                 // Wake one thread waiting on condition
+void ConditionBroadcast(Condition *cond);                              // Wake all threads waiting on condition
+
 #if defined(PLATFORM_ANDROID)
 void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initialize asset manager from android app
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!